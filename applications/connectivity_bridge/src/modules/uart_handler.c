@@ -42,9 +42,19 @@ static const struct device *devices[] = {
 struct uart_rx_buf {
 	atomic_t ref_counter;
 	size_t len;
+	uint8_t dev_idx;
 	uint8_t buf[UART_BUF_SIZE];
 };
 
+/* Received data not yet submitted as an event. Consecutive RX_RDY chunks
+ * from the same buffer block are merged here, so that a burst of short
+ * chunks is forwarded as a single uart_data_event.
+ */
+struct uart_rx_pending {
+	uint8_t *buf;
+	size_t len;
+};
+
 struct uart_tx_buf {
 	struct ring_buf rb;
 	uint8_t buf[UART_BUF_SIZE];
@@ -53,6 +63,8 @@ struct uart_tx_buf {
 BUILD_ASSERT((sizeof(struct uart_rx_buf) % UART_SLAB_ALIGNMENT) == 0);
 
 /* Blocks from the same slab is used for RX for all UART instances */
+/* Each instance may hold at most CONFIG_BRIDGE_UART_BUF_COUNT blocks (credits), */
+/* so that one busy instance cannot starve the other one of RX buffers */
 /* TX has inidividual ringbuffers per UART instance */
 
 K_MEM_SLAB_DEFINE(uart_rx_slab, UART_SLAB_BLOCK_SIZE, UART_SLAB_BLOCK_COUNT, UART_SLAB_ALIGNMENT);
@@ -63,12 +75,24 @@ static uint32_t uart_default_baudrate[UART_DEVICE_COUNT];
 static int subscriber_count[UART_DEVICE_COUNT];
 static bool enable_rx_retry[UART_DEVICE_COUNT];
 static atomic_t uart_tx_started[UART_DEVICE_COUNT];
+static atomic_t rx_credits_used[UART_DEVICE_COUNT];
+/* RX buffer was not provided due to lack of credits */
+static atomic_t rx_stalled[UART_DEVICE_COUNT];
+/* RX is disabled and waits for a credit to be returned */
+static atomic_t rx_resume_pending[UART_DEVICE_COUNT];
+static struct uart_rx_pending rx_pending[UART_DEVICE_COUNT];
+static struct k_spinlock rx_pending_lock;
 
 static void enable_uart_rx(uint8_t dev_idx);
 static void disable_uart_rx(uint8_t dev_idx);
 static void set_uart_power_state(uint8_t dev_idx, bool active);
 static int uart_tx_start(uint8_t dev_idx);
 static void uart_tx_finish(uint8_t dev_idx, size_t len);
+static void rx_flush_work_handler(struct k_work *work);
+static void rx_resume_work_handler(struct k_work *work);
+
+static K_WORK_DEFINE(rx_flush_work, rx_flush_work_handler);
+static K_WORK_DEFINE(rx_resume_work, rx_resume_work_handler);
 
 static inline struct uart_rx_buf *block_start_get(uint8_t *buf)
 {
@@ -83,7 +107,7 @@ static inline struct uart_rx_buf *block_start_get(uint8_t *buf)
 	return (struct uart_rx_buf *) &uart_rx_slab.buffer[block_num * UART_SLAB_BLOCK_SIZE];
 }
 
-static struct uart_rx_buf *uart_rx_buf_alloc(void)
+static struct uart_rx_buf *uart_rx_buf_alloc(uint8_t dev_idx)
 {
 	struct uart_rx_buf *buf;
 	int err;
@@ -93,12 +117,19 @@ static struct uart_rx_buf *uart_rx_buf_alloc(void)
 	/* This code uses a reference counter to keep track of the number of */
 	/* references within a single RX buffer block */
 
+	if (atomic_inc(&rx_credits_used[dev_idx]) >= CONFIG_BRIDGE_UART_BUF_COUNT) {
+		atomic_dec(&rx_credits_used[dev_idx]);
+		return NULL;
+	}
+
 	err = k_mem_slab_alloc(&uart_rx_slab, (void **) &buf, K_NO_WAIT);
 	if (err) {
+		atomic_dec(&rx_credits_used[dev_idx]);
 		return NULL;
 	}
 
 	atomic_set(&buf->ref_counter, 1);
+	buf->dev_idx = dev_idx;
 
 	return buf;
 }
@@ -119,7 +150,81 @@ static void uart_rx_buf_unref(void *buf)
 
 	/* ref_counter is the uart_buf->ref_counter value prior to decrement */
 	if (ref_counter == 1) {
+		uint8_t dev_idx = uart_buf->dev_idx;
+
 		k_mem_slab_free(&uart_rx_slab, (void **)&uart_buf);
+		atomic_dec(&rx_credits_used[dev_idx]);
+
+		if (atomic_get(&rx_resume_pending[dev_idx])) {
+			k_work_submit(&rx_resume_work);
+		}
+	}
+}
+
+static void uart_data_event_submit(uint8_t dev_idx, uint8_t *buf, size_t len)
+{
+	struct uart_data_event *event = new_uart_data_event();
+
+	event->dev_idx = dev_idx;
+	event->buf = buf;
+	event->len = len;
+	APP_EVENT_SUBMIT(event);
+}
+
+/* Append received data to the pending chunk of the instance. If the data does not */
+/* directly follow the pending chunk in the same block, the pending chunk is submitted */
+/* and replaced. The pending chunk holds one reference to its block. */
+/* Pending chunks are only submitted with rx_pending_lock held, so that the events */
+/* of an instance are submitted in the order in which the data was received. */
+static void rx_pending_add(uint8_t dev_idx, uint8_t *buf, size_t len)
+{
+	struct uart_rx_pending *pending = &rx_pending[dev_idx];
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rx_pending_lock);
+	if ((pending->len > 0) &&
+	    (pending->buf + pending->len == buf) &&
+	    (block_start_get(pending->buf) == block_start_get(buf))) {
+		pending->len += len;
+	} else {
+		if (pending->len > 0) {
+			uart_data_event_submit(dev_idx, pending->buf, pending->len);
+		}
+
+		uart_rx_buf_ref(buf);
+		pending->buf = buf;
+		pending->len = len;
+	}
+	k_spin_unlock(&rx_pending_lock, key);
+
+	k_work_submit(&rx_flush_work);
+}
+
+static void rx_flush_work_handler(struct k_work *work)
+{
+	k_spinlock_key_t key;
+
+	for (int i = 0; i < UART_DEVICE_COUNT; ++i) {
+		key = k_spin_lock(&rx_pending_lock);
+		if (rx_pending[i].len > 0) {
+			uart_data_event_submit(i, rx_pending[i].buf, rx_pending[i].len);
+			rx_pending[i].len = 0;
+		}
+		k_spin_unlock(&rx_pending_lock, key);
+	}
+}
+
+static void rx_resume_work_handler(struct k_work *work)
+{
+	for (int i = 0; i < UART_DEVICE_COUNT; ++i) {
+		if (atomic_get(&rx_credits_used[i]) >= CONFIG_BRIDGE_UART_BUF_COUNT) {
+			continue;
+		}
+
+		if (atomic_cas(&rx_resume_pending[i], true, false) && (subscriber_count[i] > 0)) {
+			LOG_DBG("UART_%d RX resumed", i);
+			enable_uart_rx(i);
+		}
 	}
 }
 
@@ -127,19 +232,12 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 			  void *user_data)
 {
 	int dev_idx = (int) user_data;
-	struct uart_data_event *event;
 	struct uart_rx_buf *buf;
 	int err;
 
 	switch (evt->type) {
 	case UART_RX_RDY:
-		uart_rx_buf_ref(evt->data.rx.buf);
-
-		event = new_uart_data_event();
-		event->dev_idx = dev_idx;
-		event->buf = &evt->data.rx.buf[evt->data.rx.offset];
-		event->len = evt->data.rx.len;
-		APP_EVENT_SUBMIT(event);
+		rx_pending_add(dev_idx, &evt->data.rx.buf[evt->data.rx.offset], evt->data.rx.len);
 		break;
 	case UART_RX_BUF_RELEASED:
 		if (evt->data.rx_buf.buf) {
@@ -147,9 +245,12 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 		}
 		break;
 	case UART_RX_BUF_REQUEST:
-		buf = uart_rx_buf_alloc();
+		buf = uart_rx_buf_alloc(dev_idx);
 		if (buf == NULL) {
-			LOG_WRN("UART_%d RX overflow", dev_idx);
+			/* Out of credits: let RX stop at the end of the current buffer */
+			/* and resume it once the subscribers have released a block. */
+			LOG_DBG("UART_%d RX stalled", dev_idx);
+			atomic_set(&rx_stalled[dev_idx], true);
 			break;
 		}
 
@@ -160,7 +261,10 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 		}
 		break;
 	case UART_RX_DISABLED:
-		if (enable_rx_retry[dev_idx]) {
+		if (atomic_cas(&rx_stalled[dev_idx], true, false)) {
+			atomic_set(&rx_resume_pending[dev_idx], true);
+			k_work_submit(&rx_resume_work);
+		} else if (enable_rx_retry[dev_idx]) {
 			enable_uart_rx(dev_idx);
 			enable_rx_retry[dev_idx] = false;
 		} else if (UART_SET_PM_STATE) {
@@ -253,7 +357,7 @@ static void enable_uart_rx(uint8_t dev_idx)
 		return;
 	}
 
-	buf = uart_rx_buf_alloc();
+	buf = uart_rx_buf_alloc(dev_idx);
 	if (!buf) {
 		LOG_ERR("uart_rx_buf_alloc error");
 		return;
@@ -272,6 +376,15 @@ static void disable_uart_rx(uint8_t dev_idx)
 	const struct device *dev = devices[dev_idx];
 	int err;
 
+	atomic_set(&rx_stalled[dev_idx], false);
+	if (atomic_set(&rx_resume_pending[dev_idx], false)) {
+		/* RX is already disabled, waiting for credits */
+		if (UART_SET_PM_STATE) {
+			set_uart_power_state(dev_idx, false);
+		}
+		return;
+	}
+
 	err = uart_rx_disable(dev);
 	if (err) {
 		LOG_ERR("uart_rx_disable: %d", err);
@@ -464,6 +577,8 @@ static bool app_event_handler(const struct app_event_header *aeh)
 				enable_rx_retry[i] = false;
 
 				atomic_set(&uart_tx_started[i], false);
+				atomic_set(&rx_stalled[i], false);
+				atomic_set(&rx_resume_pending[i], false);
 
 				ring_buf_init(
 					&uart_tx_ringbufs[i].rb,
@@ -612,7 +612,7 @@ static int do_ftp_mput(void)
 
 /**@brief API to handle FTP AT command
  */
-int handle_at_ftp(enum at_cmd_type cmd_type)
+static int handle_at_ftp(enum at_cmd_type cmd_type)
 {
 	int ret;
 	char op_str[16];
@@ -635,6 +635,7 @@ int handle_at_ftp(enum at_cmd_type cmd_type)
 
 	return ret;
 }
+SLM_AT_CMD(XFTP, handle_at_ftp);
 
 /**@brief API to initialize FTP AT commands handler
  */
@@ -140,7 +140,7 @@ static int do_tftp_put(int family, const char *server, uint16_t port, const char
  *  AT#XTFTP? READ is not supported
  *  AT#XTFTP=?
  */
-int handle_at_tftp(enum at_cmd_type cmd_type)
+static int handle_at_tftp(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -220,3 +220,4 @@ int handle_at_tftp(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTFTP, handle_at_tftp);
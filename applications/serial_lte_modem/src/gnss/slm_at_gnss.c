@@ -493,7 +493,7 @@ static void gnss_event_handler(int event)
  *  AT#XGPS?
  *  AT#XGPS=?
  */
-int handle_at_gps(enum at_cmd_type cmd_type)
+static int handle_at_gps(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -552,6 +552,7 @@ int handle_at_gps(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XGPS, handle_at_gps);
 
 #if defined(CONFIG_SLM_NRF_CLOUD) && defined(CONFIG_NRF_CLOUD_AGPS)
 /**@brief handle AT#XAGPS commands
@@ -559,7 +560,7 @@ int handle_at_gps(enum at_cmd_type cmd_type)
  *  AT#XAGPS?
  *  AT#XAGPS=?
  */
-int handle_at_agps(enum at_cmd_type cmd_type)
+static int handle_at_agps(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -636,6 +637,7 @@ int handle_at_agps(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XAGPS, handle_at_agps);
 #endif /* CONFIG_NRF_CLOUD_AGPS */
 
 #if defined(CONFIG_SLM_NRF_CLOUD) && defined(CONFIG_NRF_CLOUD_PGPS)
@@ -644,7 +646,7 @@ int handle_at_agps(enum at_cmd_type cmd_type)
  *  AT#XPGPS?
  *  AT#XPGPS=?
  */
-int handle_at_pgps(enum at_cmd_type cmd_type)
+static int handle_at_pgps(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -723,6 +725,7 @@ int handle_at_pgps(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XPGPS, handle_at_pgps);
 #endif /* CONFIG_NRF_CLOUD_PGPS */
 
 /**@brief handle AT#XGPSDEL commands
@@ -730,7 +733,7 @@ int handle_at_pgps(enum at_cmd_type cmd_type)
  *  AT#XGPSDEL? READ command not supported
  *  AT#XGPSDEL=?
  */
-int handle_at_gps_delete(enum at_cmd_type cmd_type)
+static int handle_at_gps_delete(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint32_t mask;
@@ -755,6 +758,7 @@ int handle_at_gps_delete(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XGPSDEL, handle_at_gps_delete);
 
 /**@brief API to initialize GNSS AT commands handler
  */
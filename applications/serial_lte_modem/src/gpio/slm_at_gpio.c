@@ -203,7 +203,7 @@ static int do_gpio_pin_operate(uint16_t op, gpio_pin_t pin, uint16_t value)
  *  AT#XGPIOCFG?
  *  AT#XGPIOCFG=? Test command not supported
  */
-int handle_at_gpio_configure(enum at_cmd_type cmd_type)
+static int handle_at_gpio_configure(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t pin = 0xff, op = 0xff;
@@ -232,13 +232,14 @@ int handle_at_gpio_configure(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XGPIOCFG, handle_at_gpio_configure);
 
 /**@brief handle AT#XGPIO commands
  *  AT#XGPIO=<pin>,<op>[,<value>]
  *  AT#XGPIO? READ command not supported
  *  AT#XGPIO=? TEST command not supported
  */
-int handle_at_gpio_operate(enum at_cmd_type cmd_type)
+static int handle_at_gpio_operate(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t pin = 0xff, op = 0xff, value = 0xff;
@@ -282,6 +283,7 @@ int handle_at_gpio_operate(enum at_cmd_type cmd_type)
 	}
 	return err;
 }
+SLM_AT_CMD(XGPIO, handle_at_gpio_operate);
 
 int slm_at_gpio_init(void)
 {
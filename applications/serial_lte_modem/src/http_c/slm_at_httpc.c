@@ -421,7 +421,7 @@ static int do_http_request(void)
  *  AT#XHTTPCCON? READ command not supported
  *  AT#XHTTPCCON=?
  */
-int handle_at_httpc_connect(enum at_cmd_type cmd_type)
+static int handle_at_httpc_connect(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -484,6 +484,7 @@ int handle_at_httpc_connect(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XHTTPCCON, handle_at_httpc_connect);
 
 static void httpc_thread_fn(void *arg1, void *arg2, void *arg3)
 {
@@ -555,7 +556,7 @@ static int http_headers_preprocess(size_t size)
  *  AT#XHTTPCREQ? READ command not supported
  *  AT#XHTTPCREQ=?
  */
-int handle_at_httpc_request(enum at_cmd_type cmd_type)
+static int handle_at_httpc_request(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int param_count;
@@ -649,6 +650,7 @@ int handle_at_httpc_request(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XHTTPCREQ, handle_at_httpc_request);
 
 int slm_at_httpc_init(void)
 {
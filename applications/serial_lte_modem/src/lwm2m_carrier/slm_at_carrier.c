@@ -761,7 +761,7 @@ static int do_carrier_request_link_up(void)
 
 /**@brief API to handle Carrier AT command
  */
-int handle_at_carrier(enum at_cmd_type cmd_type)
+static int handle_at_carrier(enum at_cmd_type cmd_type)
 {
 	int ret;
 	char op_str[SLM_CARRIER_OP_STR_MAX];
@@ -784,6 +784,7 @@ int handle_at_carrier(enum at_cmd_type cmd_type)
 
 	return ret;
 }
+SLM_AT_CMD(XCARRIER, handle_at_carrier);
 
 int slm_at_carrier_init(void)
 {
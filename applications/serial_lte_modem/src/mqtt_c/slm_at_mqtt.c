@@ -442,7 +442,7 @@ static int do_mqtt_subscribe(uint16_t op,
  *  AT#XMQTTCON?
  *  AT#XMQTTCON=?
  */
-int handle_at_mqtt_connect(enum at_cmd_type cmd_type)
+static int handle_at_mqtt_connect(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -525,6 +525,7 @@ int handle_at_mqtt_connect(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XMQTTCON, handle_at_mqtt_connect);
 
 static int mqtt_datamode_callback(uint8_t op, const uint8_t *data, int len, uint8_t flags)
 {
@@ -550,7 +551,7 @@ static int mqtt_datamode_callback(uint8_t op, const uint8_t *data, int len, uint
  *  AT#XMQTTPUB? READ command not supported
  *  AT#XMQTTPUB=?
  */
-int handle_at_mqtt_publish(enum at_cmd_type cmd_type)
+static int handle_at_mqtt_publish(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 
@@ -624,13 +625,14 @@ int handle_at_mqtt_publish(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XMQTTPUB, handle_at_mqtt_publish);
 
 /**@brief handle AT#XMQTTSUB commands
  *  AT#XMQTTSUB=<topic>,<qos>
  *  AT#XMQTTSUB? READ command not supported
  *  AT#XMQTTSUB=?
  */
-int handle_at_mqtt_subscribe(enum at_cmd_type cmd_type)
+static int handle_at_mqtt_subscribe(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t qos;
@@ -665,13 +667,14 @@ int handle_at_mqtt_subscribe(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XMQTTSUB, handle_at_mqtt_subscribe);
 
 /**@brief handle AT#XMQTTUNSUB commands
  *  AT#XMQTTUNSUB=<topic>
  *  AT#XMQTTUNSUB? READ command not supported
  *  AT#XMQTTUNSUB=?
  */
-int handle_at_mqtt_unsubscribe(enum at_cmd_type cmd_type)
+static int handle_at_mqtt_unsubscribe(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char topic[MQTT_MAX_TOPIC_LEN];
@@ -703,6 +706,7 @@ int handle_at_mqtt_unsubscribe(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XMQTTUNSUB, handle_at_mqtt_unsubscribe);
 
 int slm_at_mqtt_init(void)
 {
@@ -601,7 +601,7 @@ static int nrf_cloud_datamode_callback(uint8_t op, const uint8_t *data, int len,
  *  AT#XNRFCLOUD?
  *  AT#XNRFCLOUD=?
  */
-int handle_at_nrf_cloud(enum at_cmd_type cmd_type)
+static int handle_at_nrf_cloud(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -662,6 +662,7 @@ int handle_at_nrf_cloud(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XNRFCLOUD, handle_at_nrf_cloud);
 
 #if defined(CONFIG_NRF_CLOUD_LOCATION)
 /**@brief handle AT#XCELLPOS commands
@@ -669,7 +670,7 @@ int handle_at_nrf_cloud(enum at_cmd_type cmd_type)
  *  AT#XCELLPOS?
  *  AT#XCELLPOS=?
  */
-int handle_at_cellpos(enum at_cmd_type cmd_type)
+static int handle_at_cellpos(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -714,13 +715,14 @@ int handle_at_cellpos(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XCELLPOS, handle_at_cellpos);
 
 /**@brief handle AT#XWIFIPOS commands
  *  AT#XWIFIPOS=<op>[,<ssid>,<mac>[,<ssid>,<mac>[...]]]
  *  AT#XWIFIPOS?
  *  AT#XWIFIPOS=?
  */
-int handle_at_wifipos(enum at_cmd_type cmd_type)
+static int handle_at_wifipos(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint32_t count = at_params_valid_count_get(&at_param_list);
@@ -815,6 +817,7 @@ int handle_at_wifipos(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XWIFIPOS, handle_at_wifipos);
 #endif
 
 /**@brief API to initialize nRF Cloud AT commands handler
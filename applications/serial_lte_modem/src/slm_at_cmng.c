@@ -42,7 +42,7 @@ extern struct at_param_list at_param_list;
  *  AT#XCMNG? READ command not supported
  *  AT#XCMNG=? READ command not supported
  */
-int handle_at_xcmng(enum at_cmd_type cmd_type)
+static int handle_at_xcmng(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op, type;
@@ -148,6 +148,7 @@ int handle_at_xcmng(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XCMNG, handle_at_xcmng);
 
 /**@brief API to initialize CMNG AT commands handler
  */
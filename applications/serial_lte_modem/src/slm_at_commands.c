@@ -66,9 +66,6 @@ enum sleep_modes {
 	SLEEP_MODE_IDLE
 };
 
-/**@brief AT command handler type. */
-typedef int (*slm_at_handler_t) (enum at_cmd_type);
-
 static struct slm_work_info {
 	struct k_work_delayable uart_work;
 	struct k_work_delayable sleep_work;
@@ -132,6 +129,8 @@ static int handle_at_slmver(enum at_cmd_type type)
 
 	return ret;
 }
+SLM_AT_CMD(XSLMVER, handle_at_slmver);
+
 static void go_sleep_wk(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -175,6 +174,7 @@ static int handle_at_sleep(enum at_cmd_type type)
 
 	return ret;
 }
+SLM_AT_CMD(XSLEEP, handle_at_sleep);
 
 /**@brief handle AT#XSHUTDOWN commands
  *  AT#XSHUTDOWN
@@ -195,6 +195,7 @@ static int handle_at_shutdown(enum at_cmd_type type)
 
 	return ret;
 }
+SLM_AT_CMD(XSHUTDOWN, handle_at_shutdown);
 
 /**@brief handle AT#XRESET commands
  *  AT#XRESET
@@ -215,6 +216,7 @@ static int handle_at_reset(enum at_cmd_type type)
 
 	return ret;
 }
+SLM_AT_CMD(XRESET, handle_at_reset);
 
 /**@brief handle AT#XUUID commands
  *  AT#XUUID
@@ -240,6 +242,7 @@ static int handle_at_uuid(enum at_cmd_type type)
 
 	return ret;
 }
+SLM_AT_CMD(XUUID, handle_at_uuid);
 
 static void set_uart_wk(struct k_work *work)
 {
@@ -309,6 +312,7 @@ static int handle_at_slmuart(enum at_cmd_type type)
 	}
 	return ret;
 }
+SLM_AT_CMD(XSLMUART, handle_at_slmuart);
 
 /**@brief handle AT#XDATACTRL commands
  *  AT#XDATACTRL=<time_limit>
@@ -348,269 +352,127 @@ static int handle_at_datactrl(enum at_cmd_type cmd_type)
 
 	return ret;
 }
+SLM_AT_CMD(XDATACTRL, handle_at_datactrl);
 
 /**@brief handle AT#XCLAC commands
  *  AT#XCLAC
  *  AT#XCLAC? not supported
  *  AT#XCLAC=? not supported
  */
-int handle_at_clac(enum at_cmd_type cmd_type);
-
-/* TCP proxy commands */
-int handle_at_tcp_server(enum at_cmd_type cmd_type);
-int handle_at_tcp_client(enum at_cmd_type cmd_type);
-int handle_at_tcp_send(enum at_cmd_type cmd_type);
-int handle_at_tcp_hangup(enum at_cmd_type cmd_type);
-
-/* UDP proxy commands */
-int handle_at_udp_server(enum at_cmd_type cmd_type);
-int handle_at_udp_client(enum at_cmd_type cmd_type);
-int handle_at_udp_send(enum at_cmd_type cmd_type);
-
-/* Socket-type TCPIP commands */
-int handle_at_socket(enum at_cmd_type cmd_type);
-int handle_at_secure_socket(enum at_cmd_type cmd_type);
-int handle_at_socket_select(enum at_cmd_type cmd_type);
-int handle_at_socketopt(enum at_cmd_type cmd_type);
-int handle_at_secure_socketopt(enum at_cmd_type cmd_type);
-int handle_at_bind(enum at_cmd_type cmd_type);
-int handle_at_connect(enum at_cmd_type cmd_type);
-int handle_at_listen(enum at_cmd_type cmd_type);
-int handle_at_accept(enum at_cmd_type cmd_type);
-int handle_at_send(enum at_cmd_type cmd_type);
-int handle_at_recv(enum at_cmd_type cmd_type);
-int handle_at_sendto(enum at_cmd_type cmd_type);
-int handle_at_recvfrom(enum at_cmd_type cmd_type);
-int handle_at_poll(enum at_cmd_type cmd_type);
-int handle_at_getaddrinfo(enum at_cmd_type cmd_type);
-
-#if defined(CONFIG_SLM_NATIVE_TLS)
-int handle_at_xcmng(enum at_cmd_type cmd_type);
-#endif
-
-/* ICMP commands */
-int handle_at_icmp_ping(enum at_cmd_type cmd_type);
-
-#if defined(CONFIG_SLM_SMS)
-/* SMS commands */
-int handle_at_sms(enum at_cmd_type cmd_type);
-#endif
-
-/* FOTA commands */
-int handle_at_fota(enum at_cmd_type cmd_type);
-
-#if defined(CONFIG_SLM_NRF_CLOUD)
-int handle_at_nrf_cloud(enum at_cmd_type cmd_type);
-#if defined(CONFIG_NRF_CLOUD_LOCATION)
-int handle_at_cellpos(enum at_cmd_type cmd_type);
-int handle_at_wifipos(enum at_cmd_type cmd_type);
-#endif
-#endif
-
-#if defined(CONFIG_SLM_GNSS)
-int handle_at_gps(enum at_cmd_type cmd_type);
-int handle_at_gps_delete(enum at_cmd_type cmd_type);
-#if defined(CONFIG_SLM_NRF_CLOUD) && defined(CONFIG_NRF_CLOUD_AGPS)
-int handle_at_agps(enum at_cmd_type cmd_type);
-#endif
-#if defined(CONFIG_SLM_NRF_CLOUD) && defined(CONFIG_NRF_CLOUD_PGPS)
-int handle_at_pgps(enum at_cmd_type cmd_type);
-#endif
-#endif
-
-#if defined(CONFIG_SLM_FTPC)
-int handle_at_ftp(enum at_cmd_type cmd_type);
-#endif
-#if defined(CONFIG_SLM_TFTPC)
-int handle_at_tftp(enum at_cmd_type cmd_type);
-#endif
-
-#if defined(CONFIG_SLM_MQTTC)
-int handle_at_mqtt_connect(enum at_cmd_type cmd_type);
-int handle_at_mqtt_publish(enum at_cmd_type cmd_type);
-int handle_at_mqtt_subscribe(enum at_cmd_type cmd_type);
-int handle_at_mqtt_unsubscribe(enum at_cmd_type cmd_type);
-#endif
-
-#if defined(CONFIG_SLM_HTTPC)
-int handle_at_httpc_connect(enum at_cmd_type cmd_type);
-int handle_at_httpc_request(enum at_cmd_type cmd_type);
-#endif
-
-#if defined(CONFIG_SLM_TWI)
-int handle_at_twi_list(enum at_cmd_type cmd_type);
-int handle_at_twi_write(enum at_cmd_type cmd_type);
-int handle_at_twi_read(enum at_cmd_type cmd_type);
-int handle_at_twi_write_read(enum at_cmd_type cmd_type);
-#endif
-
-#if defined(CONFIG_SLM_GPIO)
-int handle_at_gpio_configure(enum at_cmd_type cmd_type);
-int handle_at_gpio_operate(enum at_cmd_type cmd_type);
-#endif
-
-#if defined(CONFIG_SLM_CARRIER)
-int handle_at_carrier(enum at_cmd_type cmd_type);
-#endif
-
-static struct slm_at_cmd {
-	char *string;
-	slm_at_handler_t handler;
-} slm_at_cmd_list[] = {
-	/* Generic commands */
-	{"AT#XSLMVER", handle_at_slmver},
-	{"AT#XSLEEP", handle_at_sleep},
-	{"AT#XSHUTDOWN", handle_at_shutdown},
-	{"AT#XRESET", handle_at_reset},
-	{"AT#XUUID", handle_at_uuid},
-	{"AT#XCLAC", handle_at_clac},
-	{"AT#XSLMUART", handle_at_slmuart},
-	{"AT#XDATACTRL", handle_at_datactrl},
-
-	/* TCP proxy commands */
-	{"AT#XTCPSVR", handle_at_tcp_server},
-	{"AT#XTCPCLI", handle_at_tcp_client},
-	{"AT#XTCPSEND", handle_at_tcp_send},
-	{"AT#XTCPHANGUP", handle_at_tcp_hangup},
-
-	/* UDP proxy commands */
-	{"AT#XUDPSVR", handle_at_udp_server},
-	{"AT#XUDPCLI", handle_at_udp_client},
-	{"AT#XUDPSEND", handle_at_udp_send},
-
-	/* Socket-type TCPIP commands */
-	{"AT#XSOCKET", handle_at_socket},
-	{"AT#XSSOCKET", handle_at_secure_socket},
-	{"AT#XSOCKETSELECT", handle_at_socket_select},
-	{"AT#XSOCKETOPT", handle_at_socketopt},
-	{"AT#XSSOCKETOPT", handle_at_secure_socketopt},
-	{"AT#XBIND", handle_at_bind},
-	{"AT#XCONNECT", handle_at_connect},
-	{"AT#XLISTEN", handle_at_listen},
-	{"AT#XACCEPT", handle_at_accept},
-	{"AT#XSEND", handle_at_send},
-	{"AT#XRECV", handle_at_recv},
-	{"AT#XSENDTO", handle_at_sendto},
-	{"AT#XRECVFROM", handle_at_recvfrom},
-	{"AT#XPOLL", handle_at_poll},
-	{"AT#XGETADDRINFO", handle_at_getaddrinfo},
-
-#if defined(CONFIG_SLM_NATIVE_TLS)
-	{"AT#XCMNG", handle_at_xcmng},
-#endif
-	/* ICMP commands */
-	{"AT#XPING", handle_at_icmp_ping},
-
-#if defined(CONFIG_SLM_SMS)
-	/* SMS commands */
-	{"AT#XSMS", handle_at_sms},
-#endif
-
-	/* FOTA commands */
-	{"AT#XFOTA", handle_at_fota},
-
-#if defined(CONFIG_SLM_NRF_CLOUD)
-	{"AT#XNRFCLOUD", handle_at_nrf_cloud},
-#if defined(CONFIG_NRF_CLOUD_LOCATION)
-	{"AT#XCELLPOS", handle_at_cellpos},
-	{"AT#XWIFIPOS", handle_at_wifipos},
-#endif
-#endif
-
-#if defined(CONFIG_SLM_GNSS)
-	/* GNSS commands */
-	{"AT#XGPS", handle_at_gps},
-	{"AT#XGPSDEL", handle_at_gps_delete},
-#if defined(CONFIG_SLM_NRF_CLOUD) && defined(CONFIG_NRF_CLOUD_AGPS)
-	{"AT#XAGPS", handle_at_agps},
-#endif
-#if defined(CONFIG_SLM_NRF_CLOUD) && defined(CONFIG_NRF_CLOUD_PGPS)
-	{"AT#XPGPS", handle_at_pgps},
-#endif
-#endif
+static int handle_at_clac(enum at_cmd_type cmd_type)
+{
+	int ret = -EINVAL;
 
-#if defined(CONFIG_SLM_FTPC)
-	/* FTP commands */
-	{"AT#XFTP", handle_at_ftp},
-#endif
-#if defined(CONFIG_SLM_TFTPC)
-	/* TFTP commands */
-	{"AT#XTFTP", handle_at_tftp},
-#endif
+	if (cmd_type == AT_CMD_TYPE_SET_COMMAND) {
+		STRUCT_SECTION_FOREACH(slm_at_cmd, cmd) {
+			rsp_send("%s\r\n", cmd->string);
+		}
+		ret = 0;
+	}
 
-#if defined(CONFIG_SLM_MQTTC)
-	{"AT#XMQTTCON", handle_at_mqtt_connect},
-	{"AT#XMQTTPUB", handle_at_mqtt_publish},
-	{"AT#XMQTTSUB", handle_at_mqtt_subscribe},
-	{"AT#XMQTTUNSUB", handle_at_mqtt_unsubscribe},
-#endif
+	return ret;
+}
+SLM_AT_CMD(XCLAC, handle_at_clac);
 
-#if defined(CONFIG_SLM_HTTPC)
-	{"AT#XHTTPCCON", handle_at_httpc_connect},
-	{"AT#XHTTPCREQ", handle_at_httpc_request},
-#endif
+/* Compare the command name of at_cmd, name_len characters long, with an SLM command string. */
+static int cmd_name_cmp(const char *at_cmd, size_t name_len, const char *slm_cmd)
+{
+	int diff;
 
-#if defined(CONFIG_SLM_TWI)
-	{"AT#XTWILS", handle_at_twi_list},
-	{"AT#XTWIW", handle_at_twi_write},
-	{"AT#XTWIR", handle_at_twi_read},
-	{"AT#XTWIWR", handle_at_twi_write_read},
-#endif
+	for (size_t i = 0; i < name_len; i++) {
+		diff = toupper((int)at_cmd[i]) - (int)slm_cmd[i];
+		if (diff != 0 || slm_cmd[i] == '\0') {
+			return diff;
+		}
+	}
 
-#if defined(CONFIG_SLM_GPIO)
-	{"AT#XGPIOCFG", handle_at_gpio_configure},
-	{"AT#XGPIO", handle_at_gpio_operate},
-#endif
+	return -(int)slm_cmd[name_len];
+}
 
-#if defined(CONFIG_SLM_CARRIER)
-	{"AT#XCARRIER", handle_at_carrier},
-#endif
+static const struct slm_at_cmd *slm_at_cmd_find(const char *at_cmd)
+{
+	const struct slm_at_cmd *cmd;
+	size_t lo = 0;
+	size_t hi;
+	size_t mid;
+	size_t name_len;
+	int diff;
+
+	/* All SLM proprietary commands are of the form AT#<body>. */
+	if (at_cmd[0] == '\0' || at_cmd[1] == '\0' || at_cmd[2] != '#') {
+		return NULL;
+	}
+
+	name_len = 3;
+	while (isalnum((int)at_cmd[name_len])) {
+		name_len++;
+	}
+
+	STRUCT_SECTION_COUNT(slm_at_cmd, &hi);
+
+	/* The linker sorts the entries by name, see SLM_AT_CMD(). */
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		STRUCT_SECTION_GET(slm_at_cmd, mid, &cmd);
+		diff = cmd_name_cmp(at_cmd, name_len, cmd->string);
+		if (diff == 0) {
+			return cmd;
+		} else if (diff < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
 
-};
+	return NULL;
+}
 
-int handle_at_clac(enum at_cmd_type cmd_type)
+int slm_at_parse(const char *at_cmd)
 {
-	int ret = -EINVAL;
+	int ret;
+	const struct slm_at_cmd *cmd = slm_at_cmd_find(at_cmd);
+	enum at_cmd_type type;
 
-	if (cmd_type == AT_CMD_TYPE_SET_COMMAND) {
-		int total = ARRAY_SIZE(slm_at_cmd_list);
+	if (cmd == NULL) {
+		return -ENOENT;
+	}
 
-		for (int i = 0; i < total; i++) {
-			rsp_send("%s\r\n", slm_at_cmd_list[i].string);
-		}
-		ret = 0;
+	type = at_parser_cmd_type_get(at_cmd);
+	at_params_list_clear(&at_param_list);
+	ret = at_parser_params_from_str(at_cmd, NULL, &at_param_list);
+	if (ret) {
+		LOG_ERR("Failed to parse AT command %d", ret);
+		return -EINVAL;
 	}
 
-	return ret;
+	return cmd->handler(type);
 }
 
-int slm_at_parse(const char *at_cmd)
+/* Verify that the command table is sorted, as the lookup relies on it. */
+static int slm_at_cmd_list_check(void)
 {
-	int ret = -ENOENT;
-	int total = ARRAY_SIZE(slm_at_cmd_list);
+	const struct slm_at_cmd *prev = NULL;
 
-	for (int i = 0; i < total; i++) {
-		if (slm_util_cmd_casecmp(at_cmd, slm_at_cmd_list[i].string)) {
-			enum at_cmd_type type = at_parser_cmd_type_get(at_cmd);
-
-			at_params_list_clear(&at_param_list);
-			ret = at_parser_params_from_str(at_cmd, NULL, &at_param_list);
-			if (ret) {
-				LOG_ERR("Failed to parse AT command %d", ret);
-				return -EINVAL;
-			}
-			ret = slm_at_cmd_list[i].handler(type);
-			break;
+	STRUCT_SECTION_FOREACH(slm_at_cmd, cmd) {
+		if (prev != NULL && strcmp(prev->string, cmd->string) >= 0) {
+			LOG_ERR("AT command table not sorted at %s", cmd->string);
+			return -EINVAL;
 		}
+		prev = cmd;
 	}
 
-	return ret;
+	return 0;
 }
 
 int slm_at_init(void)
 {
 	int err;
 
+	err = slm_at_cmd_list_check();
+	if (err) {
+		return -EFAULT;
+	}
+
 	k_work_init_delayable(&slm_work.uart_work, set_uart_wk);
 	k_work_init_delayable(&slm_work.sleep_work, go_sleep_wk);
 
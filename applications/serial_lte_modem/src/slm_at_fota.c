@@ -307,7 +307,7 @@ static void fota_dl_handler(const struct fota_download_evt *evt)
  *  AT#XFOTA? TEST command not supported
  *  AT#XFOTA=?
  */
-int handle_at_fota(enum at_cmd_type cmd_type)
+static int handle_at_fota(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -387,6 +387,7 @@ int handle_at_fota(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XFOTA, handle_at_fota);
 
 /**@brief API to initialize FOTA AT commands handler
  */
@@ -28,6 +28,7 @@ LOG_MODULE_REGISTER(slm_at_host, CONFIG_SLM_LOG_LEVEL);
 #define HEXDUMP_DATAMODE_MAX    16
 
 const char *slm_quit_str = CONFIG_SLM_DATAMODE_TERMINATOR;
+#define QUIT_STR_LEN (sizeof(CONFIG_SLM_DATAMODE_TERMINATOR) - 1)
 
 /* Operation mode variables */
 enum slm_operation_mode {
@@ -131,11 +132,43 @@ static bool exit_datamode(void)
 	return ret;
 }
 
+/* Lock mutex_data, before calling. Returns the number of bytes consumed from data. */
+static size_t datamode_send(const uint8_t *data, size_t len, uint8_t flags)
+{
+	int size_sent;
+	size_t size_finish;
+
+	LOG_HEXDUMP_DBG(data, MIN(len, HEXDUMP_DATAMODE_MAX), "RX-DATA");
+
+	k_mutex_lock(&mutex_mode, K_FOREVER);
+	if (datamode_handler) {
+		size_sent = datamode_handler(DATAMODE_SEND, data, len, flags);
+		if (size_sent > 0) {
+			size_finish = size_sent;
+		} else if (size_sent == 0) {
+			size_finish = len;
+		} else {
+			LOG_WRN("Raw send failed, %d dropped", len);
+			size_finish = len;
+		}
+	} else {
+		LOG_WRN("no handler, %d dropped", len);
+		size_finish = len;
+	}
+	k_mutex_unlock(&mutex_mode);
+
+#if defined(CONFIG_SLM_DATAMODE_URC)
+	rsp_send("\r\n#XDATAMODE: %d\r\n", size_finish);
+#endif
+
+	return size_finish;
+}
+
 /* Lock mutex_data, before calling. */
 static void raw_send(uint8_t flags)
 {
 	uint8_t *data = NULL;
-	int size_send, size_sent, size_all, size_finish;
+	int size_send, size_all;
 
 	/* NOTE ring_buf_get_claim() might not return full size */
 	do {
@@ -144,34 +177,9 @@ static void raw_send(uint8_t flags)
 		if (size_all != size_send) {
 			flags |= SLM_DATAMODE_FLAGS_MORE_DATA;
 		}
-		LOG_INF("Raw send: size_send: %d, data %p", size_send, (void *)data);
+		LOG_DBG("Raw send: size_send: %d, data %p", size_send, (void *)data);
 		if (data != NULL && size_send > 0) {
-
-			/* Raw data sending */
-			size_finish = 0;
-
-			LOG_HEXDUMP_DBG(data, MIN(size_send, HEXDUMP_DATAMODE_MAX), "RX-DATA");
-			k_mutex_lock(&mutex_mode, K_FOREVER);
-			if (datamode_handler && size_send > 0) {
-				size_sent = datamode_handler(DATAMODE_SEND, data, size_send, flags);
-				if (size_sent > 0) {
-					size_finish += size_sent;
-				} else if (size_sent == 0) {
-					size_finish += size_send;
-				} else {
-					LOG_WRN("Raw send failed, %d dropped", size_send);
-					size_finish += size_send;
-				}
-				(void)ring_buf_get_finish(&data_rb, size_finish);
-			} else {
-				LOG_WRN("no handler, %d dropped", size_send);
-				(void)ring_buf_get_finish(&data_rb, size_send + size_finish);
-			}
-			k_mutex_unlock(&mutex_mode);
-
-#if defined(CONFIG_SLM_DATAMODE_URC)
-			rsp_send("\r\n#XDATAMODE: %d\r\n", size_finish);
-#endif
+			(void)ring_buf_get_finish(&data_rb, datamode_send(data, size_send, flags));
 		} else {
 			break;
 		}
@@ -225,55 +233,102 @@ static void inactivity_timer_handler(struct k_timer *timer)
 }
 K_TIMER_DEFINE(inactivity_timer, inactivity_timer_handler, NULL);
 
+/* Lock mutex_data, before calling. */
+static void write_data(const uint8_t *buf, size_t len)
+{
+	size_t sent;
+
+	/* With nothing buffered, hand the data to the handler straight from the UART RX
+	 * buffer. Whatever the handler does not consume is buffered as usual.
+	 */
+	if (IS_ENABLED(CONFIG_SLM_DATAMODE_ZERO_COPY) && len > 0 && ring_buf_is_empty(&data_rb)) {
+		sent = datamode_send(buf, len, SLM_DATAMODE_FLAGS_NONE);
+		buf += MIN(sent, len);
+		len -= MIN(sent, len);
+	}
+
+	write_data_buf(buf, len);
+}
+
 /* Search for quit_str and send data prior to that. Tracks quit_str over several calls. */
 static size_t raw_rx_handler(const uint8_t *buf, const size_t len)
 {
-	size_t processed;
-	bool quit_str_match;
-	bool prev_quit_str_match;
-	uint8_t quit_str_match_count;
-	uint8_t prev_quit_str_match_count;
+	const char *candidate;
+	size_t processed = 0;
+	size_t data_len;
+	size_t match_count = 0;
+	bool quit_str_match = false;
 
 	k_mutex_lock(&mutex_data, K_FOREVER);
 
-	/* Initialize from previous time.*/
-	prev_quit_str_match_count = quit_str_partial_match;
-	quit_str_match = false;
-	quit_str_match_count = prev_quit_str_match_count;
-	if (prev_quit_str_match_count != 0) {
-		prev_quit_str_match = true;
-	}
+	/* Continue a partial quit_str match from the end of the previous buffer. */
+	if (quit_str_partial_match > 0) {
+		match_count = quit_str_partial_match;
+		while (processed < len && match_count < QUIT_STR_LEN &&
+		       buf[processed] == slm_quit_str[match_count]) {
+			processed++;
+			match_count++;
+		}
 
-	/* Find quit_str or partial match at the end of the buffer. */
-	for (processed = 0; processed < len && quit_str_match == false; processed++) {
-		if (buf[processed] == slm_quit_str[quit_str_match_count]) {
-			quit_str_match_count++;
-			if (quit_str_match_count == strlen(slm_quit_str)) {
-				quit_str_match = true;
-			}
-		} else {
-			/* No match. Possible previous partial quit_str match is data. */
-			quit_str_match_count = 0;
-			prev_quit_str_match = false;
+		if (match_count == QUIT_STR_LEN) {
+			quit_str_match = true;
+			goto exit;
+		}
+		if (processed == len) {
+			quit_str_partial_match = match_count;
+			k_mutex_unlock(&mutex_data);
+			return processed;
 		}
+
+		/* No match. Previous partial quit_str match is data, rescan this buffer. */
+		write_data_buf(slm_quit_str, quit_str_partial_match);
+		quit_str_partial_match = 0;
+		processed = 0;
 	}
 
-	if (prev_quit_str_match == false) {
-		/* Write data which was previously interpreted as a possible partial quit_str. */
-		write_data_buf(slm_quit_str, prev_quit_str_match_count);
+	/* Jump between occurrences of the first quit_str character instead of
+	 * matching byte by byte. Everything before a candidate is data.
+	 */
+	data_len = len;
+	while (processed < len) {
+		candidate = memchr(buf + processed, slm_quit_str[0], len - processed);
+		if (candidate == NULL) {
+			data_len = len;
+			processed = len;
+			break;
+		}
 
-		/* Write data from buf until the start of the possible (partial) quit_str. */
-		write_data_buf(buf, processed - quit_str_match_count);
-	} else {
-		/* Nothing to write this round.*/
+		data_len = (const uint8_t *)candidate - buf;
+		processed = data_len;
+		match_count = 0;
+		while (processed < len && match_count < QUIT_STR_LEN &&
+		       buf[processed] == slm_quit_str[match_count]) {
+			processed++;
+			match_count++;
+		}
+
+		if (match_count == QUIT_STR_LEN) {
+			quit_str_match = true;
+			break;
+		}
+		if (processed == len) {
+			/* Possible partial quit_str at the end of the buffer. */
+			quit_str_partial_match = match_count;
+			break;
+		}
+
+		/* Mismatch, continue after the candidate. */
+		data_len = len;
+		processed = (const uint8_t *)candidate - buf + 1;
 	}
 
+	write_data(buf, data_len);
+
+exit:
 	if (quit_str_match) {
 		raw_send(SLM_DATAMODE_FLAGS_NONE);
 		(void)exit_datamode();
 		quit_str_partial_match = 0;
-	} else {
-		quit_str_partial_match = quit_str_match_count;
 	}
 
 	k_mutex_unlock(&mutex_data);
@@ -578,7 +633,7 @@ static size_t null_handler(const uint8_t *buf, const size_t len)
 	for (processed = 0; processed < len && match == false; processed++) {
 		if (buf[processed] == slm_quit_str[match_count]) {
 			match_count++;
-			if (match_count == strlen(slm_quit_str)) {
+			if (match_count == QUIT_STR_LEN) {
 				match = true;
 			}
 		} else {
@@ -588,7 +643,7 @@ static size_t null_handler(const uint8_t *buf, const size_t len)
 	}
 
 	if (match) {
-		dropped_count -= strlen(slm_quit_str);
+		dropped_count -= QUIT_STR_LEN;
 		dropped_count += ring_buf_size_get(&data_rb);
 		LOG_WRN("Terminating datamode, %d dropped", dropped_count);
 		(void)exit_datamode();
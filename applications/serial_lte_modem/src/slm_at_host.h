@@ -14,6 +14,7 @@
  */
 
 #include <zephyr/types.h>
+#include <zephyr/sys/iterable_sections.h>
 #include <ctype.h>
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
@@ -23,6 +24,31 @@
 #define SLM_DATAMODE_FLAGS_NONE		0
 #define SLM_DATAMODE_FLAGS_MORE_DATA	1 << 0
 
+/**@brief AT command handler type. */
+typedef int (*slm_at_handler_t)(enum at_cmd_type);
+
+/**@brief SLM proprietary AT command. */
+struct slm_at_cmd {
+	const char *string;		/* Command string, e.g. "AT#XSLMVER" */
+	slm_at_handler_t handler;	/* Command handler */
+};
+
+/**
+ * @brief Register an SLM proprietary AT command.
+ *
+ * The linker sorts the registered commands by name, which lets the AT host look commands
+ * up with a binary search. The name is therefore the command without the "AT#" prefix,
+ * in upper case.
+ *
+ * @param name Command name, e.g. XSLMVER for AT#XSLMVER.
+ * @param handler_fn Command handler.
+ */
+#define SLM_AT_CMD(name, handler_fn)						\
+	STRUCT_SECTION_ITERABLE(slm_at_cmd, slm_at_cmd_##name) = {		\
+		.string = "AT#" #name,						\
+		.handler = handler_fn,						\
+	}
+
 /**@brief Operations in datamode. */
 enum slm_datamode_operation {
 	DATAMODE_SEND,  /* Send data in datamode */
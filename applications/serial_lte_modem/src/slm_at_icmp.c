@@ -531,7 +531,7 @@ static int ping_test_handler(const char *target)
  *  AT#XPING? READ command not supported
  *  AT#XPING=? TEST command not supported
  */
-int handle_at_icmp_ping(enum at_cmd_type cmd_type)
+static int handle_at_icmp_ping(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char target[SLM_MAX_URL];
@@ -582,6 +582,7 @@ int handle_at_icmp_ping(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XPING, handle_at_icmp_ping);
 
 /**@brief API to initialize ICMP AT commands handler
  */
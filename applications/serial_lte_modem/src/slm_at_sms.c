@@ -180,7 +180,7 @@ static int do_sms_send(const char *number, const char *message)
  *  AT#XSMS? READ command not supported
  *  AT#XSMS=?
  */
-int handle_at_sms(enum at_cmd_type cmd_type)
+static int handle_at_sms(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -228,6 +228,7 @@ int handle_at_sms(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSMS, handle_at_sms);
 
 /**@brief API to initialize SMS AT commands handler
  */
@@ -953,7 +953,7 @@ static int socket_datamode_callback(uint8_t op, const uint8_t *data, int len, ui
  *  AT#XSOCKET?
  *  AT#XSOCKET=?
  */
-int handle_at_socket(enum at_cmd_type cmd_type)
+static int handle_at_socket(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -1017,13 +1017,14 @@ int handle_at_socket(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSOCKET, handle_at_socket);
 
 /**@brief handle AT#XSOCKET commands
  *  AT#XSSOCKET=<op>[,<type>,<role>,<sec_tag>[,<peer_verify>[,<cid>]]]
  *  AT#XSSOCKET?
  *  AT#XSSOCKET=?
  */
-int handle_at_secure_socket(enum at_cmd_type cmd_type)
+static int handle_at_secure_socket(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -1115,13 +1116,14 @@ int handle_at_secure_socket(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSSOCKET, handle_at_secure_socket);
 
 /**@brief handle AT#XSOCKETSELECT commands
  *  AT#XSOCKETSELECT=<fd>
  *  AT#XSOCKETSELECT?
  *  AT#XSOCKETSELECT=?
  */
-int handle_at_socket_select(enum at_cmd_type cmd_type)
+static int handle_at_socket_select(enum at_cmd_type cmd_type)
 {
 	int err = 0;
 	int fd;
@@ -1166,13 +1168,14 @@ int handle_at_socket_select(enum at_cmd_type cmd_type)
 	return err;
 
 }
+SLM_AT_CMD(XSOCKETSELECT, handle_at_socket_select);
 
 /**@brief handle AT#XSOCKETOPT commands
  *  AT#XSOCKETOPT=<op>,<name>[,<value>]
  *  AT#XSOCKETOPT? READ command not supported
  *  AT#XSOCKETOPT=?
  */
-int handle_at_socketopt(enum at_cmd_type cmd_type)
+static int handle_at_socketopt(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -1214,13 +1217,14 @@ int handle_at_socketopt(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSOCKETOPT, handle_at_socketopt);
 
 /**@brief handle AT#XSSOCKETOPT commands
  *  AT#XSSOCKETOPT=<op>,<name>[,<value>]
  *  AT#XSSOCKETOPT? READ command not supported
  *  AT#XSSOCKETOPT=?
  */
-int handle_at_secure_socketopt(enum at_cmd_type cmd_type)
+static int handle_at_secure_socketopt(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -1277,13 +1281,14 @@ int handle_at_secure_socketopt(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSSOCKETOPT, handle_at_secure_socketopt);
 
 /**@brief handle AT#XBIND commands
  *  AT#XBIND=<port>
  *  AT#XBIND?
  *  AT#XBIND=? TEST command not supported
  */
-int handle_at_bind(enum at_cmd_type cmd_type)
+static int handle_at_bind(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t port;
@@ -1303,13 +1308,14 @@ int handle_at_bind(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XBIND, handle_at_bind);
 
 /**@brief handle AT#XCONNECT commands
  *  AT#XCONNECT=<url>,<port>
  *  AT#XCONNECT?
  *  AT#XCONNECT=? TEST command not supported
  */
-int handle_at_connect(enum at_cmd_type cmd_type)
+static int handle_at_connect(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char url[SLM_MAX_URL] = {0};
@@ -1340,13 +1346,14 @@ int handle_at_connect(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XCONNECT, handle_at_connect);
 
 /**@brief handle AT#XLISTEN commands
  *  AT#XLISTEN
  *  AT#XLISTEN? READ command not supported
  *  AT#XLISTEN=? TEST command not supported
  */
-int handle_at_listen(enum at_cmd_type cmd_type)
+static int handle_at_listen(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 
@@ -1366,13 +1373,14 @@ int handle_at_listen(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XLISTEN, handle_at_listen);
 
 /**@brief handle AT#XACCEPT commands
  *  AT#XACCEPT=<timeout>
  *  AT#XACCEPT? READ command not supported
  *  AT#XACCEPT=? TEST command not supported
  */
-int handle_at_accept(enum at_cmd_type cmd_type)
+static int handle_at_accept(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int timeout;
@@ -1406,13 +1414,14 @@ int handle_at_accept(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XACCEPT, handle_at_accept);
 
 /**@brief handle AT#XSEND commands
  *  AT#XSEND[=<data>]
  *  AT#XSEND? READ command not supported
  *  AT#XSEND=? TEST command not supported
  */
-int handle_at_send(enum at_cmd_type cmd_type)
+static int handle_at_send(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char data[SLM_MAX_PAYLOAD_SIZE + 1] = {0};
@@ -1438,13 +1447,14 @@ int handle_at_send(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSEND, handle_at_send);
 
 /**@brief handle AT#XRECV commands
  *  AT#XRECV=<timeout>
  *  AT#XRECV? READ command not supported
  *  AT#XRECV=? TEST command not supported
  */
-int handle_at_recv(enum at_cmd_type cmd_type)
+static int handle_at_recv(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int timeout;
@@ -1471,13 +1481,14 @@ int handle_at_recv(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XRECV, handle_at_recv);
 
 /**@brief handle AT#XSENDTO commands
  *  AT#XSENDTO=<url>,<port>[<data>]
  *  AT#XSENDTO? READ command not supported
  *  AT#XSENDTO=? TEST command not supported
  */
-int handle_at_sendto(enum at_cmd_type cmd_type)
+static int handle_at_sendto(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int size;
@@ -1513,13 +1524,14 @@ int handle_at_sendto(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XSENDTO, handle_at_sendto);
 
 /**@brief handle AT#XRECVFROM commands
  *  AT#XRECVFROM=<timeout>[,<flags>]
  *  AT#XRECVFROM? READ command not supported
  *  AT#XRECVFROM=? TEST command not supported
  */
-int handle_at_recvfrom(enum at_cmd_type cmd_type)
+static int handle_at_recvfrom(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int timeout;
@@ -1546,13 +1558,14 @@ int handle_at_recvfrom(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XRECVFROM, handle_at_recvfrom);
 
 /**@brief handle AT#XGETADDRINFO commands
  *  AT#XGETADDRINFO=<url>
  *  AT#XGETADDRINFO? READ command not supported
  *  AT#XGETADDRINFO=? TEST command not supported
  */
-int handle_at_getaddrinfo(enum at_cmd_type cmd_type)
+static int handle_at_getaddrinfo(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char hostname[NI_MAXHOST];
@@ -1608,13 +1621,14 @@ int handle_at_getaddrinfo(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XGETADDRINFO, handle_at_getaddrinfo);
 
 /**@brief handle AT#XPOLL commands
  *  AT#XPOLL=<timeout>[,<handle1>[,<handle2> ...<handle8>]
  *  AT#XPOLL? READ command not support
  *  AT#XPOLL=? TEST command not support
  */
-int handle_at_poll(enum at_cmd_type cmd_type)
+static int handle_at_poll(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int timeout, handle;
@@ -1660,6 +1674,7 @@ int handle_at_poll(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XPOLL, handle_at_poll);
 
 /**@brief API to initialize Socket AT commands handler
  */
@@ -653,7 +653,7 @@ static void tcpcli_thread_func(void *p1, void *p2, void *p3)
  *  AT#XTCPSVR?
  *  AT#XTCPSVR=?
  */
-int handle_at_tcp_server(enum at_cmd_type cmd_type)
+static int handle_at_tcp_server(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -706,13 +706,14 @@ int handle_at_tcp_server(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTCPSVR, handle_at_tcp_server);
 
 /**@brief handle AT#XTCPCLI commands
  *  AT#XTCPCLI=<op>[,<url>,<port>[,[sec_tag]]
  *  AT#XTCPCLI?
  *  AT#XTCPCLI=?
  */
-int handle_at_tcp_client(enum at_cmd_type cmd_type)
+static int handle_at_tcp_client(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -771,13 +772,14 @@ int handle_at_tcp_client(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTCPCLI, handle_at_tcp_client);
 
 /**@brief handle AT#XTCPSEND commands
  *  AT#XTCPSEND[=<data>]
  *  AT#XTCPSEND? READ command not supported
  *  AT#XTCPSEND=? TEST command not supported
  */
-int handle_at_tcp_send(enum at_cmd_type cmd_type)
+static int handle_at_tcp_send(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char data[SLM_MAX_PAYLOAD_SIZE + 1] = {0};
@@ -803,13 +805,14 @@ int handle_at_tcp_send(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTCPSEND, handle_at_tcp_send);
 
 /**@brief handle AT#XTCPHANGUP commands
  *  AT#XTCPHANGUP=<handle>
  *  AT#XTCPHANGUP? READ command not supported
  *  AT#XTCPHANGUP=?
  */
-int handle_at_tcp_hangup(enum at_cmd_type cmd_type)
+static int handle_at_tcp_hangup(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	int handle;
@@ -841,6 +844,7 @@ int handle_at_tcp_hangup(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTCPHANGUP, handle_at_tcp_hangup);
 
 /**@brief API to initialize TCP proxy AT commands handler
  */
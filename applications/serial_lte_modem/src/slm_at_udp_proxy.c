@@ -440,7 +440,7 @@ static int udp_datamode_callback(uint8_t op, const uint8_t *data, int len, uint8
  *  AT#XUDPSVR? READ command not supported
  *  AT#XUDPSVR=?
  */
-int handle_at_udp_server(enum at_cmd_type cmd_type)
+static int handle_at_udp_server(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -484,13 +484,14 @@ int handle_at_udp_server(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XUDPSVR, handle_at_udp_server);
 
 /**@brief handle AT#XUDPCLI commands
  *  AT#XUDPCLI=<op>[,<url>,<port>[,<sec_tag>]
  *  AT#XUDPCLI? READ command not supported
  *  AT#XUDPCLI=?
  */
-int handle_at_udp_client(enum at_cmd_type cmd_type)
+static int handle_at_udp_client(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t op;
@@ -545,13 +546,14 @@ int handle_at_udp_client(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XUDPCLI, handle_at_udp_client);
 
 /**@brief handle AT#XUDPSEND commands
  *  AT#XUDPSEND[=<data>]
  *  AT#XUDPSEND? READ command not supported
  *  AT#XUDPSEND=? TEST command not supported
  */
-int handle_at_udp_send(enum at_cmd_type cmd_type)
+static int handle_at_udp_send(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	char data[SLM_MAX_PAYLOAD_SIZE + 1] = {0};
@@ -577,6 +579,7 @@ int handle_at_udp_send(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XUDPSEND, handle_at_udp_send);
 
 /**@brief API to initialize UDP Proxy AT commands handler
  */
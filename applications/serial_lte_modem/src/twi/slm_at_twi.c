@@ -154,7 +154,7 @@ static int do_twi_write_read(uint16_t index, uint16_t dev_addr, const uint8_t *t
  *  AT#XTWILS? READ command not supported
  *  AT#XTWILS=? TEST command not supported
  */
-int handle_at_twi_list(enum at_cmd_type cmd_type)
+static int handle_at_twi_list(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 
@@ -170,13 +170,14 @@ int handle_at_twi_list(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTWILS, handle_at_twi_list);
 
 /**@brief handle AT#XTWIW commands
  *  AT#XTWIW=<index>,<dev_addr>,<data>
  *  AT#XTWIW? READ command not supported
  *  AT#XTWIW=?
  */
-int handle_at_twi_write(enum at_cmd_type cmd_type)
+static int handle_at_twi_write(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t index, dev_addr;
@@ -220,13 +221,14 @@ int handle_at_twi_write(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTWIW, handle_at_twi_write);
 
 /**@brief handle AT#XTWIR commands
  *  AT#XTWIR=<index>,<dev_addr>,<num_read>
  *  AT#XTWIR? READ command not supported
  *  AT#XTWIR=?
  */
-int handle_at_twi_read(enum at_cmd_type cmd_type)
+static int handle_at_twi_read(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t index, dev_addr, num_read;
@@ -272,13 +274,14 @@ int handle_at_twi_read(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTWIR, handle_at_twi_read);
 
 /**@brief handle AT#XTWIWR commands
  *  AT#XTWIWR=<index>,<dev_addr>,<data>,<num_read>
  *  AT#XTWIWR? READ command not supported
  *  AT#XTWIWR=?
  */
-int handle_at_twi_write_read(enum at_cmd_type cmd_type)
+static int handle_at_twi_write_read(enum at_cmd_type cmd_type)
 {
 	int err = -EINVAL;
 	uint16_t index, dev_addr, num_read;
@@ -330,6 +333,7 @@ int handle_at_twi_write_read(enum at_cmd_type cmd_type)
 
 	return err;
 }
+SLM_AT_CMD(XTWIWR, handle_at_twi_write_read);
 
 int slm_at_twi_init(void)
 {
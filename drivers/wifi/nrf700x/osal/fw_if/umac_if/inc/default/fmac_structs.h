@@ -311,6 +311,12 @@ struct tx_config {
 	unsigned int outstanding_descs[WIFI_NRF_FMAC_AC_MAX];
 	/** Peer who will be get the next opportunity for TX. */
 	unsigned int curr_peer_opp[WIFI_NRF_FMAC_AC_MAX];
+	/** Number of frames in each of the data_pending_txq queues. */
+	unsigned int pend_q_len[MAX_SW_PEERS][WIFI_NRF_FMAC_AC_MAX];
+	/** Per-AC bitmap of the peers which have frames in data_pending_txq. */
+	unsigned int pend_peer_map[WIFI_NRF_FMAC_AC_MAX];
+	/** Per-peer/per-AC deficit round robin credit in bytes. */
+	int drr_deficit[MAX_SW_PEERS][WIFI_NRF_FMAC_AC_MAX];
 	/** Access category which will get the next spare descriptor. */
 	unsigned int next_spare_desc_ac;
 	/** Frame context information. */
@@ -68,6 +68,9 @@ enum wifi_nrf_status tx_cmd_init(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 				 int desc,
 				 int peer_id);
 
+void tx_peer_pend_q_flush(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+			  unsigned int peer_id);
+
 unsigned int tx_buff_req_free(struct wifi_nrf_fmac_dev_ctx *fmac_ctx,
 			      unsigned int desc,
 			      unsigned char *ac);
@@ -13,6 +13,7 @@
 #include "fmac_peer.h"
 #include "host_rpu_umac_if.h"
 #include "fmac_util.h"
+#include "fmac_tx.h"
 
 int wifi_nrf_fmac_peer_get_id(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 			      const unsigned char *mac_addr)
@@ -103,6 +104,10 @@ void wifi_nrf_fmac_peer_remove(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 	vif_ctx = fmac_dev_ctx->vif_ctx[if_idx];
 	peer = &fmac_dev_ctx->tx_config.peers[peer_id];
 
+#ifdef CONFIG_NRF700X_DATA_TX
+	tx_peer_pend_q_flush(fmac_dev_ctx, peer_id);
+#endif /* CONFIG_NRF700X_DATA_TX */
+
 	wifi_nrf_osal_mem_set(fmac_dev_ctx->fpriv->opriv,
 			      peer,
 			      0x0,
@@ -132,6 +137,9 @@ void wifi_nrf_fmac_peers_flush(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 	for (i = 0; i < MAX_PEERS; i++) {
 		peer = &fmac_dev_ctx->tx_config.peers[i];
 		if (peer->if_idx == if_idx) {
+#ifdef CONFIG_NRF700X_DATA_TX
+			tx_peer_pend_q_flush(fmac_dev_ctx, i);
+#endif /* CONFIG_NRF700X_DATA_TX */
 
 			wifi_nrf_osal_mem_set(fmac_dev_ctx->fpriv->opriv,
 					      peer,
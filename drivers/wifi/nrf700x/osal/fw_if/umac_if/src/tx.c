@@ -72,16 +72,80 @@ static unsigned short get_spare_desc_q_map(struct wifi_nrf_fmac_dev_ctx *fmac_de
 }
 
 
+/* The length of the pending queues is tracked alongside the queues, so that
+ * the scheduler does not have to query the OSAL queues for every frame.
+ */
+static enum wifi_nrf_status pend_q_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+					   void *nwb,
+					   unsigned int ac,
+					   unsigned int peer_id)
+{
+	enum wifi_nrf_status status = WIFI_NRF_STATUS_FAIL;
+
+	status = wifi_nrf_utils_q_enqueue(fmac_dev_ctx->fpriv->opriv,
+					  fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac],
+					  nwb);
+
+	if (status == WIFI_NRF_STATUS_SUCCESS) {
+		fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac]++;
+		fmac_dev_ctx->tx_config.pend_peer_map[ac] |= (1 << peer_id);
+	}
+
+	return status;
+}
+
+
+static void *pend_q_dequeue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+			    unsigned int ac,
+			    unsigned int peer_id)
+{
+	void *nwb = NULL;
+
+	nwb = wifi_nrf_utils_q_dequeue(fmac_dev_ctx->fpriv->opriv,
+				       fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac]);
+
+	if (nwb && --fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac] == 0) {
+		fmac_dev_ctx->tx_config.pend_peer_map[ac] &= ~(1 << peer_id);
+	}
+
+	return nwb;
+}
+
+
+void tx_peer_pend_q_flush(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+			  unsigned int peer_id)
+{
+	void *nwb = NULL;
+	unsigned int ac = 0;
+
+	wifi_nrf_osal_spinlock_take(fmac_dev_ctx->fpriv->opriv,
+				    fmac_dev_ctx->tx_config.tx_lock);
+
+	for (ac = 0; ac < WIFI_NRF_FMAC_AC_MAX; ac++) {
+		while ((nwb = pend_q_dequeue(fmac_dev_ctx, ac, peer_id))) {
+			wifi_nrf_osal_nbuf_free(fmac_dev_ctx->fpriv->opriv,
+						nwb);
+		}
+
+		/* A new peer taking the same ID starts without credit */
+		fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac] = 0;
+		fmac_dev_ctx->tx_config.pend_peer_map[ac] &= ~(1 << peer_id);
+		fmac_dev_ctx->tx_config.drr_deficit[peer_id][ac] = 0;
+	}
+
+	wifi_nrf_osal_spinlock_rel(fmac_dev_ctx->fpriv->opriv,
+				   fmac_dev_ctx->tx_config.tx_lock);
+}
+
+
 int pending_frames_count(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 			 int peer_id)
 {
 	int count = 0;
 	int ac = 0;
-	void *queue = NULL;
 
 	for (ac = WIFI_NRF_FMAC_AC_VO; ac >= 0; --ac) {
-		queue = fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
-		count += wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv, queue);
+		count += fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac];
 	}
 
 	return count;
@@ -94,7 +158,6 @@ enum wifi_nrf_status update_pend_q_bmp(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ct
 {
 	enum wifi_nrf_status status = WIFI_NRF_STATUS_FAIL;
 	struct wifi_nrf_fmac_vif_ctx *vif_ctx = NULL;
-	void *pend_pkt_q = NULL;
 	int len = 0;
 	unsigned char vif_id = 0;
 	unsigned char *bmp = NULL;
@@ -109,9 +172,7 @@ enum wifi_nrf_status update_pend_q_bmp(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ct
 	if (vif_ctx->if_type == NRF_WIFI_IFTYPE_AP &&
 	    peer_id < MAX_PEERS) {
 		bmp = &fmac_dev_ctx->tx_config.peers[peer_id].pend_q_bmp;
-		pend_pkt_q = fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
-
-		len = wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv, pend_pkt_q);
+		len = fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac];
 
 		if (len == 0) {
 			*bmp = *bmp & ~(1 << ac);
@@ -246,13 +307,12 @@ int tx_aggr_check(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 		return false;
 	}
 
-	pending_pkt_queue = fmac_dev_ctx->tx_config.data_pending_txq[peer][ac];
-
-	if (wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-				 pending_pkt_queue) == 0) {
+	if (fmac_dev_ctx->tx_config.pend_q_len[peer][ac] == 0) {
 		return false;
 	}
 
+	pending_pkt_queue = fmac_dev_ctx->tx_config.data_pending_txq[peer][ac];
+
 	nwb = wifi_nrf_utils_q_peek(fmac_dev_ctx->fpriv->opriv,
 				    pending_pkt_queue);
 
@@ -282,8 +342,6 @@ int get_peer_from_wakeup_q(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 {
 	int peer_id = -1;
 	struct peers_info *peer = NULL;
-	void *pend_q = NULL;
-	unsigned int pend_q_len;
 	void *client_q = NULL;
 	void *list_node = NULL;
 
@@ -297,11 +355,7 @@ int get_peer_from_wakeup_q(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 							 list_node);
 
 		if (peer != NULL && peer->ps_token_count) {
-
-			pend_q = fmac_dev_ctx->tx_config.data_pending_txq[peer->peer_id][ac];
-			pend_q_len = wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv, pend_q);
-
-			if (pend_q_len) {
+			if (fmac_dev_ctx->tx_config.pend_q_len[peer->peer_id][ac]) {
 				peer->ps_token_count--;
 				return peer->peer_id;
 			}
@@ -316,17 +370,31 @@ int get_peer_from_wakeup_q(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+static bool tx_peer_ready(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+			  unsigned int peer_id,
+			  unsigned int ac)
+{
+	if (!(fmac_dev_ctx->tx_config.pend_peer_map[ac] & (1 << peer_id))) {
+		return false;
+	}
+
+	return fmac_dev_ctx->tx_config.peers[peer_id].ps_state != NRF_WIFI_CLIENT_PS_MODE;
+}
+
+
+/* Peers are served with deficit round robin per AC. When a peer gets its turn,
+ * its credit is topped up with one A-MPDU worth of bytes and the peer keeps
+ * the turn until the credit is used up or its queue runs empty. Frame bytes
+ * are used as the airtime estimate, so a peer sending large frames does not
+ * starve peers sending small ones.
+ */
 int tx_curr_peer_opp_get(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 			 unsigned int ac)
 {
-
 	unsigned int i = 0;
 	unsigned int curr_peer_opp = 0;
 	unsigned int init_peer_opp = 0;
-	unsigned int pend_q_len;
-	void *pend_q = NULL;
 	int peer_id = -1;
-	unsigned char ps_state = 0;
 
 	if (ac == WIFI_NRF_FMAC_AC_MC) {
 		return MAX_PEERS;
@@ -338,33 +406,33 @@ int tx_curr_peer_opp_get(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 		return peer_id;
 	}
 
+	/* No pending frames for any peer in that AC. */
+	if (!(fmac_dev_ctx->tx_config.pend_peer_map[ac] & ((1 << MAX_PEERS) - 1))) {
+		return -1;
+	}
+
 	init_peer_opp = fmac_dev_ctx->tx_config.curr_peer_opp[ac];
 
-	for (i = 0; i < MAX_PEERS; i++) {
-		curr_peer_opp = (init_peer_opp + i) % MAX_PEERS;
+	if (tx_peer_ready(fmac_dev_ctx, init_peer_opp, ac) &&
+	    fmac_dev_ctx->tx_config.drr_deficit[init_peer_opp][ac] > 0) {
+		return init_peer_opp;
+	}
 
-		ps_state = fmac_dev_ctx->tx_config.peers[curr_peer_opp].ps_state;
+	for (i = 1; i <= MAX_PEERS; i++) {
+		curr_peer_opp = (init_peer_opp + i) % MAX_PEERS;
 
-		if (ps_state == NRF_WIFI_CLIENT_PS_MODE) {
+		if (!tx_peer_ready(fmac_dev_ctx, curr_peer_opp, ac)) {
 			continue;
 		}
 
-		pend_q = fmac_dev_ctx->tx_config.data_pending_txq[curr_peer_opp][ac];
-		pend_q_len = wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-						  pend_q);
+		fmac_dev_ctx->tx_config.curr_peer_opp[ac] = curr_peer_opp;
+		fmac_dev_ctx->tx_config.drr_deficit[curr_peer_opp][ac] +=
+			fmac_dev_ctx->fpriv->avail_ampdu_len_per_token;
 
-		if (pend_q_len) {
-			fmac_dev_ctx->tx_config.curr_peer_opp[ac] =
-				(curr_peer_opp + 1) % MAX_PEERS;
-			break;
-		}
-	}
-
-	if (i != MAX_PEERS) {
-		peer_id = curr_peer_opp;
+		return curr_peer_opp;
 	}
 
-	return peer_id;
+	return -1;
 }
 
 size_t _tx_pending_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
@@ -379,8 +447,9 @@ size_t _tx_pending_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 	void *nwb = NULL;
 	void *first_nwb = NULL;
 	int max_txq_len = fmac_dev_ctx->fpriv->data_config.max_tx_aggregation;
-	int avail_ampdu_len_per_token = fmac_dev_ctx->fpriv->avail_ampdu_len_per_token;
+	int ampdu_len_limit = fmac_dev_ctx->fpriv->avail_ampdu_len_per_token;
 	int ampdu_len = 0;
+	int frame_len = 0;
 
 	peer_id = tx_curr_peer_opp_get(fmac_dev_ctx, ac);
 
@@ -389,35 +458,38 @@ size_t _tx_pending_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 		return 0;
 	}
 
-	pend_pkt_q = fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
-
-	if (wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-				 pend_pkt_q) == 0) {
+	if (fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac] == 0) {
 		return 0;
 	}
 
+	/* Unicast peers do not aggregate beyond their round robin credit */
+	if (peer_id < MAX_PEERS &&
+	    fmac_dev_ctx->tx_config.drr_deficit[peer_id][ac] < ampdu_len_limit) {
+		ampdu_len_limit = fmac_dev_ctx->tx_config.drr_deficit[peer_id][ac];
+	}
+
+	pend_pkt_q = fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
+
 	pkt_info = &fmac_dev_ctx->tx_config.pkt_info_p[desc];
 	txq = pkt_info->pkt;
 
+	len = wifi_nrf_utils_list_len(fmac_dev_ctx->fpriv->opriv, txq);
+
 	/* Aggregate Only MPDU's with same RA, same Rate,
 	 * same Rate flags, same Tx Info flags
 	 */
-	if (wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-				 pend_pkt_q)) {
-		first_nwb = wifi_nrf_utils_q_peek(fmac_dev_ctx->fpriv->opriv,
-						  pend_pkt_q);
-	}
+	first_nwb = wifi_nrf_utils_q_peek(fmac_dev_ctx->fpriv->opriv,
+					  pend_pkt_q);
 
-	while (wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-				    pend_pkt_q)) {
+	while (fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac]) {
 		nwb = wifi_nrf_utils_q_peek(fmac_dev_ctx->fpriv->opriv,
 					    pend_pkt_q);
 
-		ampdu_len += TX_BUF_HEADROOM +
+		frame_len = TX_BUF_HEADROOM +
 			wifi_nrf_osal_nbuf_data_size(fmac_dev_ctx->fpriv->opriv,
 						     (void *)nwb);
 
-		if (ampdu_len >= avail_ampdu_len_per_token) {
+		if (ampdu_len + frame_len >= ampdu_len_limit) {
 			break;
 		}
 
@@ -425,38 +497,47 @@ size_t _tx_pending_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 				    first_nwb,
 				    ac,
 				    peer_id) ||
-			(wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-					      txq) >= max_txq_len)) {
+			(len >= max_txq_len)) {
 			break;
 		}
 
-		nwb = wifi_nrf_utils_q_dequeue(fmac_dev_ctx->fpriv->opriv,
-					       pend_pkt_q);
+		nwb = pend_q_dequeue(fmac_dev_ctx, ac, peer_id);
 
 		wifi_nrf_utils_list_add_tail(fmac_dev_ctx->fpriv->opriv,
 					     txq,
 					     nwb);
+		ampdu_len += frame_len;
+		len++;
 	}
 
 	/* If our criterion rejects all pending frames, or
 	 * pend_q is empty, send only 1
 	 */
-	if (!wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-				  txq)) {
-		nwb = wifi_nrf_utils_q_dequeue(fmac_dev_ctx->fpriv->opriv,
-					       pend_pkt_q);
+	if (!len) {
+		nwb = pend_q_dequeue(fmac_dev_ctx, ac, peer_id);
 
 		wifi_nrf_utils_list_add_tail(fmac_dev_ctx->fpriv->opriv,
 					     txq,
 					     nwb);
+		ampdu_len += TX_BUF_HEADROOM +
+			wifi_nrf_osal_nbuf_data_size(fmac_dev_ctx->fpriv->opriv,
+						     (void *)nwb);
+		len++;
 	}
 
-	len = wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv, txq);
-
 	if (len > 0) {
 		fmac_dev_ctx->tx_config.pkt_info_p[desc].peer_id = peer_id;
 	}
 
+	if (peer_id < MAX_PEERS) {
+		/* A peer with nothing left to send does not keep its credit */
+		if (fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac] == 0) {
+			fmac_dev_ctx->tx_config.drr_deficit[peer_id][ac] = 0;
+		} else {
+			fmac_dev_ctx->tx_config.drr_deficit[peer_id][ac] -= ampdu_len;
+		}
+	}
+
 	update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
 
 	return len;
@@ -735,8 +816,6 @@ enum wifi_nrf_status tx_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 				unsigned int peer_id)
 {
 	enum wifi_nrf_status status = WIFI_NRF_STATUS_FAIL;
-	void *queue = NULL;
-	int qlen = 0;
 
 	if (!fmac_dev_ctx || !nwb) {
 		wifi_nrf_osal_log_err(fmac_dev_ctx->fpriv->opriv,
@@ -745,18 +824,17 @@ enum wifi_nrf_status tx_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 		goto out;
 	}
 
-	queue = fmac_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
+	if (fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac] >=
+	    CONFIG_NRF700X_MAX_TX_PENDING_QLEN) {
+		goto out;
+	}
 
-	qlen = wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv, queue);
+	status = pend_q_enqueue(fmac_dev_ctx, nwb, ac, peer_id);
 
-	if (qlen >= CONFIG_NRF700X_MAX_TX_PENDING_QLEN) {
+	if (status != WIFI_NRF_STATUS_SUCCESS) {
 		goto out;
 	}
 
-	wifi_nrf_utils_q_enqueue(fmac_dev_ctx->fpriv->opriv,
-				 queue,
-				 nwb);
-
 	status = update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
 
 
@@ -806,8 +884,7 @@ enum wifi_nrf_fmac_tx_status tx_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_c
 	 */
 
 	if ((fmac_dev_ctx->tx_config.outstanding_descs[ac]) >= fpriv->num_tx_tokens_per_ac) {
-		if (wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-					 pend_pkt_q)) {
+		if (fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac]) {
 			first_nwb = wifi_nrf_utils_q_peek(fmac_dev_ctx->fpriv->opriv,
 							  pend_pkt_q);
 
@@ -831,8 +908,7 @@ enum wifi_nrf_fmac_tx_status tx_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_c
 		if (aggr_status) {
 			max_cmds = fmac_dev_ctx->fpriv->data_config.max_tx_aggregation;
 
-			if (wifi_nrf_utils_q_len(fmac_dev_ctx->fpriv->opriv,
-						 pend_pkt_q) < max_cmds) {
+			if (fmac_dev_ctx->tx_config.pend_q_len[peer_id][ac] < max_cmds) {
 				goto out;
 			}
 		}
@@ -1217,6 +1293,12 @@ enum wifi_nrf_status tx_init(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx)
 
 	for (j = 0; j < WIFI_NRF_FMAC_AC_MAX; j++) {
 		fmac_dev_ctx->tx_config.curr_peer_opp[j] = 0;
+		fmac_dev_ctx->tx_config.pend_peer_map[j] = 0;
+
+		for (i = 0; i < MAX_SW_PEERS; i++) {
+			fmac_dev_ctx->tx_config.pend_q_len[i][j] = 0;
+			fmac_dev_ctx->tx_config.drr_deficit[i][j] = 0;
+		}
 	}
 
 	fmac_dev_ctx->tx_config.buf_pool_bmp_p =
@@ -199,13 +199,43 @@ struct nwb {
 	int hostbuffer;
 	void *cleanup_ctx;
 	void (*cleanup_cb)();
+	bool from_slab;
 };
 
+/* The nwb descriptors and the linked list nodes are allocated for every frame,
+ * so they are taken from slabs. The heap is only used when a slab runs out.
+ */
+K_MEM_SLAB_DEFINE_STATIC(nwb_slab, sizeof(struct nwb), CONFIG_NRF700X_NWB_SLAB_COUNT, 4);
+K_MEM_SLAB_DEFINE_STATIC(llist_node_slab, sizeof(struct zep_shim_llist_node),
+			 CONFIG_NRF700X_LLIST_NODE_SLAB_COUNT, 4);
+
+static struct nwb *nwb_desc_alloc(void)
+{
+	struct nwb *nwb;
+
+	if (k_mem_slab_alloc(&nwb_slab, (void **)&nwb, K_NO_WAIT) == 0) {
+		memset(nwb, 0, sizeof(*nwb));
+		nwb->from_slab = true;
+		return nwb;
+	}
+
+	return k_calloc(sizeof(struct nwb), sizeof(char));
+}
+
+static void nwb_desc_free(struct nwb *nwb)
+{
+	if (nwb->from_slab) {
+		k_mem_slab_free(&nwb_slab, (void **)&nwb);
+	} else {
+		k_free(nwb);
+	}
+}
+
 static void *zep_shim_nbuf_alloc(unsigned int size)
 {
 	struct nwb *nwb;
 
-	nwb = (struct nwb *)k_calloc(sizeof(struct nwb), sizeof(char));
+	nwb = nwb_desc_alloc();
 
 	if (!nwb)
 		return NULL;
@@ -213,7 +243,7 @@ static void *zep_shim_nbuf_alloc(unsigned int size)
 	nwb->priv = k_calloc(size, sizeof(char));
 
 	if (!nwb->priv) {
-		k_free(nwb);
+		nwb_desc_free(nwb);
 		return NULL;
 	}
 
@@ -232,9 +262,9 @@ static void zep_shim_nbuf_free(void *nbuf)
 
 	nwb = nbuf;
 
-	k_free(((struct nwb *)nbuf)->priv);
+	k_free(nwb->priv);
 
-	k_free(nbuf);
+	nwb_desc_free(nwb);
 }
 
 static void zep_shim_nbuf_headroom_res(void *nbuf, unsigned int size)
@@ -297,6 +327,20 @@ static void *zep_shim_nbuf_data_pull(void *nbuf, unsigned int size)
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_core.h>
 
+#ifdef CONFIG_NRF700X_RX_ZERO_COPY
+static void rx_ext_buf_destroy(struct net_buf *buf)
+{
+	struct nwb *nwb = *(struct nwb **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	zep_shim_nbuf_free(nwb);
+}
+
+/* Fragments that point to the data of received nwbs */
+NET_BUF_POOL_HEAP_DEFINE(rx_ext_pool, CONFIG_NRF700X_RX_NUM_BUFS, sizeof(struct nwb *),
+			 rx_ext_buf_destroy);
+#endif /* CONFIG_NRF700X_RX_ZERO_COPY */
+
 void *net_pkt_to_nbuf(struct net_pkt *pkt)
 {
 	struct nwb *nwb;
@@ -335,6 +379,30 @@ void *net_pkt_from_nbuf(void *iface, void *frm)
 
 	data = zep_shim_nbuf_data_get(nwb);
 
+#ifdef CONFIG_NRF700X_RX_ZERO_COPY
+	struct net_buf *buf;
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, K_MSEC(100));
+
+	if (!pkt) {
+		goto out;
+	}
+
+	buf = net_buf_alloc_with_data(&rx_ext_pool, data, len, K_MSEC(100));
+
+	if (!buf) {
+		net_pkt_unref(pkt);
+		pkt = NULL;
+		goto out;
+	}
+
+	/* The nwb is freed together with the fragment */
+	*(struct nwb **)net_buf_user_data(buf) = nwb;
+	net_pkt_append_buffer(pkt, buf);
+
+	return pkt;
+#endif /* CONFIG_NRF700X_RX_ZERO_COPY */
+
 	pkt = net_pkt_rx_alloc_with_buffer(iface, len, AF_UNSPEC, 0, K_MSEC(100));
 
 	if (!pkt) {
@@ -356,7 +424,12 @@ static void *zep_shim_llist_node_alloc(void)
 {
 	struct zep_shim_llist_node *llist_node = NULL;
 
-	llist_node = k_calloc(sizeof(*llist_node), sizeof(char));
+	if (k_mem_slab_alloc(&llist_node_slab, (void **)&llist_node, K_NO_WAIT) == 0) {
+		memset(llist_node, 0, sizeof(*llist_node));
+		llist_node->from_slab = true;
+	} else {
+		llist_node = k_calloc(sizeof(*llist_node), sizeof(char));
+	}
 
 	if (!llist_node) {
 		LOG_ERR("%s: Unable to allocate memory for linked list node\n", __func__);
@@ -370,7 +443,13 @@ static void *zep_shim_llist_node_alloc(void)
 
 static void zep_shim_llist_node_free(void *llist_node)
 {
-	k_free(llist_node);
+	struct zep_shim_llist_node *zep_llist_node = llist_node;
+
+	if (zep_llist_node->from_slab) {
+		k_mem_slab_free(&llist_node_slab, (void **)&zep_llist_node);
+	} else {
+		k_free(zep_llist_node);
+	}
 }
 
 static void *zep_shim_llist_node_data_get(void *llist_node)
@@ -48,6 +48,7 @@ struct zep_shim_intr_priv {
 struct zep_shim_llist_node {
 	sys_dnode_t head;
 	void *data;
+	bool from_slab;
 };
 
 struct zep_shim_llist {
@@ -12,6 +12,7 @@
 #define BT_ADV_PROV_H_
 
 #include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/sys/atomic.h>
 
 /**
  * @defgroup bt_le_adv_prov Bluetooth LE advertising providers subsystem
@@ -75,10 +76,37 @@ typedef int (*bt_le_adv_prov_data_get)(struct bt_data *d,
 				       const struct bt_le_adv_prov_adv_state *state,
 				       struct bt_le_adv_prov_feedback *fb);
 
+/** Structure describing cached data of advertising data provider.
+ *
+ * The structure is managed by the subsystem and must not be accessed directly.
+ */
+struct bt_le_adv_prov_provider_cache {
+	/** Data returned by the provider. */
+	struct bt_data d;
+
+	/** Feedback reported by the provider. */
+	struct bt_le_adv_prov_feedback fb;
+
+	/** Value returned by the provider. */
+	int err;
+
+	/** Pairing mode used to get the data. */
+	bool pairing_mode;
+
+	/** Grace period state used to get the data. */
+	bool in_grace_period;
+
+	/** Information if the cached data is up to date. */
+	atomic_t valid;
+};
+
 /** Structure describing advertising data provider. */
 struct bt_le_adv_prov_provider {
 	/** Function used to get provider's data. */
 	bt_le_adv_prov_data_get get_data;
+
+	/** Cache of provider's data or NULL if the provider's data is not cached. */
+	struct bt_le_adv_prov_provider_cache *cache;
 };
 
 /** Register advertising data provider.
@@ -107,6 +135,50 @@ struct bt_le_adv_prov_provider {
 		.get_data = get_data_fn,							 \
 	}
 
+/** Register advertising data provider with cached data.
+ *
+ * The macro statically registers an advertising data provider that caches its data. The provider's
+ * callback is called again only if the provider's data is invalidated using
+ * @ref BT_LE_ADV_PROV_PROVIDER_INVALIDATE, if the pairing mode or the grace period state changes, if
+ * RPA is rotated or if a new advertising session is started. Otherwise, the subsystem reuses
+ * the data returned by the previous call. The data pointed by the provided @ref bt_data structure
+ * must remain valid and unchanged until the provider's data is invalidated.
+ *
+ * @param pname		Provider name.
+ * @param get_data_fn	Function used to get provider's advertising data.
+ */
+#define BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_CACHED(pname, get_data_fn)				 \
+	static struct bt_le_adv_prov_provider_cache _bt_le_adv_prov_cache_##pname;		 \
+	STRUCT_SECTION_ITERABLE_ALTERNATE(bt_le_adv_prov_ad, bt_le_adv_prov_provider, pname) = { \
+		.get_data = get_data_fn,							 \
+		.cache = &_bt_le_adv_prov_cache_##pname,					 \
+	}
+
+/** Register scan response data provider with cached data.
+ *
+ * The macro works like @ref BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_CACHED, but the provider appends
+ * data to scan response packet.
+ *
+ * @param pname		Provider name.
+ * @param get_data_fn	Function used to get provider's scan response data.
+ */
+#define BT_LE_ADV_PROV_SD_PROVIDER_REGISTER_CACHED(pname, get_data_fn)				 \
+	static struct bt_le_adv_prov_provider_cache _bt_le_adv_prov_cache_##pname;		 \
+	STRUCT_SECTION_ITERABLE_ALTERNATE(bt_le_adv_prov_sd, bt_le_adv_prov_provider, pname) = { \
+		.get_data = get_data_fn,							 \
+		.cache = &_bt_le_adv_prov_cache_##pname,					 \
+	}
+
+/** Invalidate cached data of the provider.
+ *
+ * The provider registered with cached data must use the macro to inform the subsystem that its
+ * data has changed. The provider's callback is called during the next advertising data update.
+ *
+ * @param pname		Provider name.
+ */
+#define BT_LE_ADV_PROV_PROVIDER_INVALIDATE(pname) \
+	atomic_set(&_bt_le_adv_prov_cache_##pname.valid, false)
+
 /** Get number of advertising data packet providers.
  *
  * The number of advertising data packet providers defines maximum number of elements in advertising
@@ -160,6 +232,28 @@ int bt_le_adv_prov_get_sd(struct bt_data *sd, size_t *sd_len,
 			  const struct bt_le_adv_prov_adv_state *state,
 			  struct bt_le_adv_prov_feedback *fb);
 
+/** Check if advertising data has changed.
+ *
+ * The function compares advertising data filled by the last successful call of
+ * @ref bt_le_adv_prov_get_ad with advertising data filled by the call before. The module that
+ * controls Bluetooth advertising can use the function to skip updating advertising data that has
+ * not changed.
+ *
+ * @return true if the advertising data has changed or if the subsystem cannot tell.
+ *         Otherwise, false is returned.
+ */
+bool bt_le_adv_prov_ad_changed(void);
+
+/** Check if scan response data has changed.
+ *
+ * The function works like @ref bt_le_adv_prov_ad_changed, but for the data filled by
+ * @ref bt_le_adv_prov_get_sd.
+ *
+ * @return true if the scan response data has changed or if the subsystem cannot tell.
+ *         Otherwise, false is returned.
+ */
+bool bt_le_adv_prov_sd_changed(void);
+
 #ifdef __cplusplus
 }
 #endif
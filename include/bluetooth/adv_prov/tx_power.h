@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_ADV_PROV_TX_POWER_H_
+#define BT_ADV_PROV_TX_POWER_H_
+
+/**
+ * @defgroup bt_le_adv_prov_tx_power TX Power advertising data provider API
+ * @brief TX Power advertising data provider API
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Invalidate TX power cached by the TX Power advertising provider.
+ *
+ * The provider reads the advertising TX power from the Bluetooth controller only when a new
+ * advertising session is started or RPA is rotated. User shall call this function after changing
+ * the advertising TX power during an advertising session, so that the TX power is read again
+ * during the next advertising data update.
+ */
+void bt_le_adv_prov_tx_power_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* BT_ADV_PROV_TX_POWER_H_ */
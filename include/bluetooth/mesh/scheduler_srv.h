@@ -76,6 +76,14 @@ struct bt_mesh_scheduler_srv {
 		 * in the Schedule Register.
 		 */
 		uint16_t active_bitmap;
+		/* Active entries as a binary min-heap ordered by
+		 * the calculated TAI-time.
+		 */
+		uint8_t queue[BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT];
+		/* Position of each active entry in the queue. */
+		uint8_t queue_pos[BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT];
+		/* Number of entries in the queue. */
+		uint8_t queue_len;
 		/* The Schedule Register state is a 16-entry,
 		 * zero-based, indexed array
 		 */
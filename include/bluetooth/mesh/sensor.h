@@ -385,15 +385,17 @@ struct bt_mesh_sensor {
 		/** Sensor threshold specification. */
 		struct bt_mesh_sensor_threshold threshold;
 
-		/** Linked list node. */
-		sys_snode_t node;
-
 		/** The previously published sensor value. */
 		struct sensor_value prev;
 
 		/** Sequence number of the previous publication. */
 		uint16_t seq;
 
+		/** Number of server publications after the previous publication
+		 *  before the sensor is due to be sampled again.
+		 */
+		uint16_t pub_due;
+
 		/** Minimum possible interval for fast cadence value publishing.
 		 *  The value is represented as 2 to the power of N milliseconds.
 		 *
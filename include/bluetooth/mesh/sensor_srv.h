@@ -62,10 +62,18 @@ struct bt_mesh_sensor_srv;
 struct bt_mesh_sensor_srv {
 	/** Sensors owned by this server. */
 	struct bt_mesh_sensor *const *sensor_array;
-	/** Ordered linked list of sensors. */
-	sys_slist_t sensors;
+	/** Sensors sorted by sensor ID. */
+	struct bt_mesh_sensor *sensors[CONFIG_BT_MESH_SENSOR_SRV_SENSORS_MAX];
 	/** Publish sequence counter */
 	uint16_t seq;
+	/** Number of publications to skip before the next sensor is due. */
+	uint16_t pub_idle;
+	/** Base period the publication schedule was calculated for. */
+	uint32_t sched_base_period;
+	/** Period divisor the publication schedule was calculated for. */
+	uint8_t sched_period_div;
+	/** Highest fast period divisor of the sensors. */
+	uint8_t pub_div_max;
 	/** Number of sensors. */
 	uint8_t sensor_count;
 
@@ -31,17 +31,27 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+/* In the single-producer single-consumer mode, the blocks in the slab buffer
+ * are used as a ring. The indexes run from 0 to 2 * elements_max - 1, so that
+ * a full ring can be told apart from an empty one. The producer only writes
+ * spsc_alloc and spsc_lock, the consumer only writes spsc_get and spsc_free.
+ */
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
 	struct k_mem_slab mem_slab;
 	struct k_msgq msgq;
+	atomic_t spsc_alloc;
+	atomic_t spsc_lock;
+	atomic_t spsc_get;
+	atomic_t spsc_free;
 	uint32_t elements_max;
 	size_t block_size_max;
+	bool spsc;
 	bool initialized;
 };
 
-#define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
+#define _DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, spsc_in)                      \
 	char __aligned(WB_UP(1))                                                                   \
 		_msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = { 0 };    \
 	char __aligned(WB_UP(1))                                                                   \
@@ -50,8 +60,27 @@ struct data_fifo {
 				  .slab_buffer = _slab_buffer_##name,                              \
 				  .block_size_max = block_size_max_in,                             \
 				  .elements_max = elements_max_in,                                 \
+				  .spsc = spsc_in,                                                 \
 				  .initialized = false }
 
+#define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
+	_DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, false)
+
+/**
+ * @brief Define a data_fifo in the lock-free single-producer single-consumer mode.
+ *
+ * The FIFO is used through the same API as one defined with DATA_FIFO_DEFINE,
+ * but no locks are taken and no data is copied. This requires that:
+ * - Only one context at a time gets vacant blocks and locks them,
+ *   and only one context at a time gets filled blocks and frees them.
+ * - Blocks are locked and freed in the order in which they were taken.
+ * - data_fifo_empty is only called when neither side is using the FIFO.
+ *
+ * A call that has to wait for a block polls the FIFO once per system tick.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	_DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, true)
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -68,7 +97,9 @@ struct data_fifo {
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory allocated.
- * @retval value	Return values from k_mem_slab_alloc.
+ * @retval value	Return values from k_mem_slab_alloc. In the
+ *			single-producer single-consumer mode, -ENOMEM if no
+ *			block is vacant and -EAGAIN if the wait timed out.
  */
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout);
@@ -91,7 +122,9 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
  * @retval -EINVAL	The supplied size is zero.
  * @retval -ESPIPE	A generic return value if an error occurs in k_msg_put.
  *			Since data has already been added to the slab, there
- *			must be space in the message queue.
+ *			must be space in the message queue. In the
+ *			single-producer single-consumer mode, the block is not
+ *			the oldest one that has been taken and not locked.
  */
 int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
 
@@ -111,7 +144,9 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory pointer retrieved.
- * @retval value	Return values from k_msgq_get.
+ * @retval value	Return values from k_msgq_get. In the single-producer
+ *			single-consumer mode, -ENOMSG if no block is filled
+ *			and -EAGAIN if the wait timed out.
  */
 int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
 				      k_timeout_t timeout);
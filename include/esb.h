@@ -297,9 +297,14 @@ bool esb_is_idle(void);
  *  module is in PRX mode, the payload is queued for when a packet is received
  *  that requires an acknowledgement with payload.
  *
+ *  The function can be called while a slot is claimed with
+ *  @ref esb_write_payload_claim. The payload is then queued in the next free
+ *  slot, and the claimed slot is queued after it when it is finished.
+ *
  *  @param[in]   payload     The payload.
  *
  * @retval 0 If successful.
+ * @retval -ENOMEM If the TX queue is full. A claimed slot counts as used.
  *           Otherwise, a (negative) error code is returned.
  */
 int esb_write_payload(const struct esb_payload *payload);
@@ -313,6 +318,60 @@ int esb_write_payload(const struct esb_payload *payload);
  */
 int esb_read_rx_payload(struct esb_payload *payload);
 
+/** @brief Claim a payload slot for transmission or acknowledgement.
+ *
+ *  This function gives direct access to the next free entry of the TX queue,
+ *  so that the application can build the payload in place instead of
+ *  copying it with @ref esb_write_payload. Fill in the @c length, @c pipe,
+ *  @c noack and @c data fields and then call @ref esb_write_payload_finish.
+ *
+ *  Only one slot can be claimed at a time. Flushing or popping the TX queue
+ *  releases the claimed slot.
+ *
+ *  @param[out] payload	Pointer to the claimed payload slot.
+ *
+ * @retval 0 If successful.
+ * @retval -EBUSY If a slot is already claimed.
+ * @retval -ENOMEM If the TX queue is full.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_write_payload_claim(struct esb_payload **payload);
+
+/** @brief Queue or release the payload slot claimed with @ref esb_write_payload_claim.
+ *
+ *  @param[in] commit	If true, the payload is queued. If false, the slot is
+ *			released without queuing the payload.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If no slot is claimed, or the claimed slot was released by
+ *                 flushing or popping the TX queue.
+ * @retval -EMSGSIZE If the payload length is invalid. The slot is released.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_write_payload_finish(bool commit);
+
+/** @brief Access the oldest received payload in place.
+ *
+ *  The payload stays in the RX queue until @ref esb_read_rx_payload_finish
+ *  is called, so it can be processed without being copied.
+ *
+ *  @param[out] payload	Pointer to the received payload.
+ *
+ * @retval 0 If successful.
+ * @retval -ENODATA If the RX queue is empty.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_read_rx_payload_claim(const struct esb_payload **payload);
+
+/** @brief Remove the payload accessed with @ref esb_read_rx_payload_claim from the RX queue.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If no payload is claimed, or the claimed payload was removed
+ *                 by reading or flushing the RX queue.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_read_rx_payload_finish(void);
+
 /** @brief Start transmitting data.
  *
  * @retval 0 If successful.
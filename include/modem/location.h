@@ -145,12 +145,44 @@ struct location_data_details_gnss {
 	uint8_t satellites_tracked;
 	/** PVT data. */
 	struct nrf_modem_gnss_pvt_data_frame pvt_data;
+	/**
+	 * Elapsed time of the A-GPS and P-GPS assistance data requests in milliseconds.
+	 *
+	 * When A-GPS data is downloaded using nRF Cloud REST, this includes downloading and
+	 * processing the data. When the data is received asynchronously, for example, using
+	 * nRF Cloud MQTT or when CONFIG_LOCATION_SERVICE_EXTERNAL is enabled, only the time
+	 * taken to send the request is included.
+	 */
+	uint32_t elapsed_time_assistance;
+};
+
+/** Location details for cellular positioning. */
+struct location_data_details_cellular {
+	/** Elapsed time of the LTE neighbor cell measurement in milliseconds. */
+	uint32_t elapsed_time_scan;
+};
+
+/** Location details for Wi-Fi positioning. */
+struct location_data_details_wifi {
+	/** Elapsed time of the Wi-Fi scan in milliseconds. */
+	uint32_t elapsed_time_scan;
 };
 
 /** Location details. */
 struct location_data_details {
+	/** Elapsed time of the location method in milliseconds. */
+	uint32_t elapsed_time_method;
+	/**
+	 * Elapsed time of the cloud request that resolves cellular and Wi-Fi data into
+	 * a location, in milliseconds.
+	 */
+	uint32_t elapsed_time_cloud_request;
 	/** Location details for GNSS. */
 	struct location_data_details_gnss gnss;
+	/** Location details for cellular positioning. */
+	struct location_data_details_cellular cellular;
+	/** Location details for Wi-Fi positioning. */
+	struct location_data_details_wifi wifi;
 };
 #endif
 
@@ -221,6 +221,23 @@ enum at_param_type modem_info_type_get(enum modem_info info);
  */
 int modem_info_params_get(struct modem_param_info *modem_param);
 
+/** @brief Obtain multiple modem parameters.
+ *
+ * Parameters that are read with the same AT command are obtained with
+ * a single AT command, and the response is parsed once for all of them.
+ * Parameters that do not change while the modem is running, or while
+ * the same SIM card is in use, are cached if @kconfig{CONFIG_MODEM_INFO_CACHE}
+ * is enabled.
+ *
+ * @param params Array of pointers to the parameters to obtain.
+ *               The information type of each parameter must be set.
+ * @param count Number of parameters in the array.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int modem_info_params_batch_get(struct lte_param *const *params, size_t count);
+
 /** @brief Obtain the UUID of the modem firmware build.
  *
  * The UUID is represented as a string, for example:
@@ -99,6 +99,33 @@ void nrf_cloud_log_control_set(int log_level);
  */
 int nrf_cloud_log_control_get(void);
 
+/** @brief Statistics of the nRF Cloud logging backend. */
+struct nrf_cloud_log_stats {
+	/** Total number of lines logged */
+	uint32_t lines_rendered;
+	/** Total number of bytes (before TLS) logged */
+	uint32_t bytes_rendered;
+	/** Total number of lines sent */
+	uint32_t lines_sent;
+	/** Total number of bytes (before TLS) sent */
+	uint32_t bytes_sent;
+	/** Total number of lines dropped by the logging subsystem, because the
+	 *  backend buffers were full, or because sending them failed
+	 */
+	uint32_t lines_dropped;
+};
+
+/**
+ * @brief Get the statistics of the nRF Cloud logging backend.
+ *
+ * Only available when CONFIG_NRF_CLOUD_LOG_BACKEND=y.
+ *
+ * @param[out] log_stats Statistics.
+ * @retval 0 on success.
+ * @retval -EINVAL if log_stats is NULL.
+ */
+int nrf_cloud_log_stats_get(struct nrf_cloud_log_stats *const log_stats);
+
 #if defined(CONFIG_NRF_CLOUD_LOG_DIRECT)
 #if defined(CONFIG_NRF_CLOUD_MQTT)
 /**
@@ -51,7 +51,10 @@ struct rest_client_req_context {
 	 */
 	int connect_socket;
 
-	/** Defines whether the connection should remain after API call. Default: false. */
+	/** Defines whether the connection should remain after API call. Default: false.
+	 *  If false and the library opens the connection, the connection is returned into
+	 *  the connection pool when CONFIG_REST_CLIENT_CONN_POOL is enabled.
+	 */
 	bool keep_alive;
 
 	/** Security tag. Default: REST_CLIENT_SEC_TAG_NO_SEC. */
@@ -160,6 +163,15 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
  */
 void rest_client_request_defaults_set(struct rest_client_req_context *req_ctx);
 
+/**
+ * @brief Closes all idle connections in the connection pool.
+ *
+ * @details Intended to be used when the pooled connections are known to be unusable,
+ *          for example, after the network connection has been lost.
+ *          Does nothing if CONFIG_REST_CLIENT_CONN_POOL is disabled.
+ */
+void rest_client_conn_pool_flush(void);
+
 /** @} */
 
 #endif /* REST_CLIENT_H__ */
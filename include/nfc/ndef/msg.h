@@ -57,6 +57,34 @@ int nfc_ndef_msg_encode(struct nfc_ndef_msg_desc const *ndef_msg_desc,
 			uint8_t *msg_buffer,
 			uint32_t *msg_len);
 
+/**
+ * @brief Encode a part of an NDEF message.
+ *
+ * This function encodes the part of an NDEF message that starts at the given
+ * offset within the message. The encoded bytes are the same as the ones
+ * generated by @ref nfc_ndef_msg_encode at that offset. Use the function to
+ * provide a large message in chunks, for example when the NFC reader reads
+ * it, without a buffer for the whole message.
+ *
+ * The records preceding the part are not encoded, only their length is
+ * calculated. See @ref nfc_ndef_record_encode_part for how the payloads of
+ * the records within the part are encoded.
+ *
+ * @param ndef_msg_desc Pointer to the message descriptor.
+ * @param offset Offset of the part within the message.
+ * @param buffer Pointer to the part destination.
+ * @param len Requested length of the part as input. Size of the encoded
+ * part as output. The part is shorter than requested if the message ends
+ * before.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_msg_encode_part(struct nfc_ndef_msg_desc const *ndef_msg_desc,
+			     uint32_t offset,
+			     uint8_t *buffer,
+			     uint32_t *len);
+
 /**
  * @brief Clear an NDEF message.
  *
@@ -261,6 +261,39 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 			   uint8_t *record_buffer,
 			   uint32_t *record_len);
 
+/**
+ * @brief Encode a part of an NDEF record.
+ *
+ * @details This function encodes the part of an NDEF record that starts at
+ * the given offset within the record. The encoded bytes are the same as
+ * the ones generated by @ref nfc_ndef_record_encode at that offset, so
+ * a record can be encoded in chunks without a buffer for the whole record.
+ *
+ * The binary payload of a record created with
+ * @ref NFC_NDEF_RECORD_BIN_DATA_DEF is copied directly from the binary data
+ * and the payload of a record with a nested NDEF message is encoded in parts
+ * as well. Other payload constructors generate the payload in the destination
+ * buffer if the part contains the whole payload, or in a temporary buffer of
+ * CONFIG_NFC_NDEF_RECORD_ENCODE_PART_BUF_SIZE bytes otherwise.
+ *
+ * @param ndef_record_desc Pointer to the record descriptor.
+ * @param record_location Location of the record within the NDEF message.
+ * @param offset Offset of the part within the record.
+ * @param buffer Pointer to the part destination.
+ * @param len Requested length of the part as input. Size of the encoded
+ * part as output. The part is shorter than requested if the record ends
+ * before.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_record_encode_part(
+			struct nfc_ndef_record_desc const *ndef_record_desc,
+			enum nfc_ndef_record_location const record_location,
+			uint32_t offset,
+			uint8_t *buffer,
+			uint32_t *len);
+
 /**
  * @brief Construct the payload for an NFC NDEF record from binary data.
  *
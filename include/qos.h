@@ -41,9 +41,10 @@ extern "C" {
 /**
  * @brief Set this flag to require acknowledging of a message.
  *
- * @details By setting this flag the caller will be notified periodically with the
+ * @details By setting this flag the caller will be notified with the
  *	    QOS_EVT_MESSAGE_TIMER_EXPIRED event until qos_message_remove() has been called with
- *	    the corresponding message.
+ *	    the corresponding message. The time between notifications doubles every time the
+ *	    message is notified, up to CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_MAX_SECONDS.
  */
 #define QOS_FLAG_RELIABILITY_ACK_REQUIRED 0x02
 
@@ -73,6 +74,15 @@ enum qos_evt_type {
 	 *  Payload is of type @ref qos_data.
 	 */
 	QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
+
+	/** One or more messages have timed out together, or have been notified using the
+	 *  qos_message_notify_all() API call. Notified instead of QOS_EVT_MESSAGE_TIMER_EXPIRED
+	 *  when CONFIG_QOS_MESSAGE_TIMER_EXPIRED_BATCH is enabled.
+	 *  Payload is of type @ref qos_batch. (batch)
+	 *
+	 *  The messages are only valid in the callback.
+	 */
+	QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH,
 };
 
 /** @brief Structure used to keep track of unACKed messages. */
@@ -115,12 +125,22 @@ struct qos_data {
 	bool heap_allocated;
 };
 
+/** @brief Messages notified together in a single event. */
+struct qos_batch {
+	/** Array of messages. */
+	const struct qos_data *messages;
+	/** Number of messages in the array. */
+	size_t count;
+};
+
 /** @brief Library callback event structure. */
 struct qos_evt {
 	/** Event type notified by the library. */
 	enum qos_evt_type type;
 	/** Payload and corresponding metadata. */
 	struct qos_data message;
+	/** Messages notified with the QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH event. */
+	struct qos_batch batch;
 };
 
 /** @brief QoS library event handler.
@@ -141,6 +161,11 @@ int qos_init(qos_evt_handler_t evt_handler);
  *	   When this API is called, the event QOS_EVT_MESSAGE_NEW is always notified with the
  *	   corresponding message.
  *
+ *	   If CONFIG_QOS_SPILL_QUEUE is enabled, a message that does not fit in the internal list
+ *	   is stored in flash instead, and notified with the QOS_EVT_MESSAGE_REMOVED_FROM_LIST
+ *	   event. The stored message is notified with the QOS_EVT_MESSAGE_NEW event once it is
+ *	   added back to the internal list.
+ *
  *  @param message Pointer to the corresponding message
  *
  *  @retval 0 on success.
@@ -176,7 +201,9 @@ bool qos_message_has_flag(const struct qos_data *message, uint32_t flag);
 void qos_message_print(const struct qos_data *message);
 
 /** @brief Generate message ID that counts from QOS_MESSAGE_ID_BASE message ID base.
- *	   Count is reset if UINT16_MAX is reached.
+ *	   Count is reset if UINT16_MAX is reached. IDs of pending messages and of messages
+ *	   stored in flash are skipped. After a reboot, the count continues after the newest
+ *	   stored message.
  *
  *  @retval Message ID.
  */
@@ -185,9 +212,23 @@ uint16_t qos_message_id_get_next(void);
 /** @brief Notify all pending messages.
  *         All messages that are currently stored in the internal list will be notified via the
  *	   QOS_EVT_MESSAGE_TIMER_EXPIRED event. This API does not clear the internal pending list.
+ *	   If CONFIG_QOS_SPILL_QUEUE is enabled, messages stored in flash are added back to the
+ *	   internal list first, as long as there is room.
  */
 void qos_message_notify_all(void);
 
+/** @brief Move all pending messages to flash.
+ *	   All messages that are currently stored in the internal list are stored in flash and
+ *	   notified with the QOS_EVT_MESSAGE_REMOVED_FROM_LIST event. Use this API when the
+ *	   connection is lost for a longer period of time or before a reboot, so that the
+ *	   messages are not lost. Messages that cannot be stored are kept in the internal list.
+ *
+ *  @retval 0 on success.
+ *  @retval -ENOTSUP If CONFIG_QOS_SPILL_QUEUE is disabled.
+ *  @retval -ENOSPC If one or more messages could not be stored.
+ */
+int qos_message_spill_all(void);
+
 /** @brief Remove all pending messages.
  *         All messages that are currently stored in the internal list will removed. Each message
  *	   will be notified in the QOS_EVT_MESSAGE_REMOVED_FROM_LIST callback event.
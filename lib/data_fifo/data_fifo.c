@@ -41,6 +41,176 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+/* Ring indexes wrap at twice the number of blocks, which makes the distance
+ * between two indexes range from 0 (empty) to elements_max (full).
+ */
+static uint32_t spsc_idx_next(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return (idx + 1) % (2 * data_fifo->elements_max);
+}
+
+static uint32_t spsc_idx_distance(struct data_fifo *data_fifo, uint32_t from, uint32_t to)
+{
+	return (to + 2 * data_fifo->elements_max - from) % (2 * data_fifo->elements_max);
+}
+
+static uint32_t spsc_idx_slot(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return (idx < data_fifo->elements_max) ? idx : (idx - data_fifo->elements_max);
+}
+
+static void *spsc_block_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + spsc_idx_slot(data_fifo, idx) * data_fifo->block_size_max;
+}
+
+static struct data_fifo_msgq *spsc_msg_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[spsc_idx_slot(data_fifo, idx)];
+}
+
+/** @brief Wait for a condition, polling once per tick.
+ *
+ * @retval 0		The condition is met.
+ * @retval -EBUSY	The condition is not met and timeout is K_NO_WAIT.
+ * @retval -EAGAIN	The condition was not met before the timeout expired.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, bool (*cond)(struct data_fifo *data_fifo),
+		     k_timeout_t timeout)
+{
+	uint64_t end;
+
+	if (cond(data_fifo)) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
+	end = sys_clock_timeout_end_calc(timeout);
+
+	do {
+		if (!K_TIMEOUT_EQ(timeout, K_FOREVER) && (sys_clock_tick_get() >= end)) {
+			return -EAGAIN;
+		}
+
+		k_sleep(K_TICKS(1));
+	} while (!cond(data_fifo));
+
+	return 0;
+}
+
+static bool spsc_vacant(struct data_fifo *data_fifo)
+{
+	return spsc_idx_distance(data_fifo, atomic_get(&data_fifo->spsc_free),
+				 atomic_get(&data_fifo->spsc_alloc)) < data_fifo->elements_max;
+}
+
+static bool spsc_filled(struct data_fifo *data_fifo)
+{
+	return atomic_get(&data_fifo->spsc_get) != atomic_get(&data_fifo->spsc_lock);
+}
+
+static int spsc_first_vacant_get(struct data_fifo *data_fifo, void **data, k_timeout_t timeout)
+{
+	uint32_t alloc_idx;
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_vacant, timeout);
+	if (ret) {
+		return (ret == -EBUSY) ? -ENOMEM : ret;
+	}
+
+	alloc_idx = atomic_get(&data_fifo->spsc_alloc);
+	*data = spsc_block_get(data_fifo, alloc_idx);
+	atomic_set(&data_fifo->spsc_alloc, spsc_idx_next(data_fifo, alloc_idx));
+
+	return 0;
+}
+
+static int spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	uint32_t lock_idx = atomic_get(&data_fifo->spsc_lock);
+	struct data_fifo_msgq *msg;
+
+	if ((lock_idx == atomic_get(&data_fifo->spsc_alloc)) ||
+	    (*data != spsc_block_get(data_fifo, lock_idx))) {
+		LOG_ERR("Block %p is not the oldest vacant block taken", *data);
+		return -ESPIPE;
+	}
+
+	msg = spsc_msg_get(data_fifo, lock_idx);
+	msg->block_ptr = *data;
+	msg->size = size;
+
+	/* Publish the block to the consumer after its size has been stored. */
+	atomic_set(&data_fifo->spsc_lock, spsc_idx_next(data_fifo, lock_idx));
+
+	return 0;
+}
+
+static int spsc_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+				k_timeout_t timeout)
+{
+	uint32_t get_idx;
+	struct data_fifo_msgq *msg;
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_filled, timeout);
+	if (ret) {
+		return (ret == -EBUSY) ? -ENOMSG : ret;
+	}
+
+	get_idx = atomic_get(&data_fifo->spsc_get);
+	msg = spsc_msg_get(data_fifo, get_idx);
+	*data = msg->block_ptr;
+	*size = msg->size;
+	atomic_set(&data_fifo->spsc_get, spsc_idx_next(data_fifo, get_idx));
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void **data)
+{
+	uint32_t free_idx = atomic_get(&data_fifo->spsc_free);
+
+	if ((free_idx == atomic_get(&data_fifo->spsc_get)) ||
+	    (*data != spsc_block_get(data_fifo, free_idx))) {
+		LOG_ERR("Block %p is not the oldest filled block taken", *data);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	/* Hand the block back to the producer once the consumer is done with it. */
+	atomic_set(&data_fifo->spsc_free, spsc_idx_next(data_fifo, free_idx));
+}
+
+/* The indexes are read in the order in which they follow each other in the ring,
+ * so that every index read is at or ahead of the ones read before it.
+ */
+static int spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+			     uint32_t *locked_num)
+{
+	uint32_t free_idx = atomic_get(&data_fifo->spsc_free);
+	uint32_t get_idx = atomic_get(&data_fifo->spsc_get);
+	uint32_t lock_idx = atomic_get(&data_fifo->spsc_lock);
+	uint32_t alloc_idx = atomic_get(&data_fifo->spsc_alloc);
+
+	*alloced_num = spsc_idx_distance(data_fifo, free_idx, alloc_idx);
+	*locked_num = spsc_idx_distance(data_fifo, get_idx, lock_idx);
+
+	return 0;
+}
+
+static void spsc_reset(struct data_fifo *data_fifo)
+{
+	atomic_set(&data_fifo->spsc_alloc, 0);
+	atomic_set(&data_fifo->spsc_lock, 0);
+	atomic_set(&data_fifo->spsc_get, 0);
+	atomic_set(&data_fifo->spsc_free, 0);
+}
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -48,6 +218,10 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (data_fifo->spsc) {
+		return spsc_first_vacant_get(data_fifo, data, timeout);
+	}
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +240,10 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+	if (data_fifo->spsc) {
+		return spsc_block_lock(data_fifo, data, size);
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -93,6 +271,10 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 
 	struct data_fifo_msgq msgq_tmp;
 
+	if (data_fifo->spsc) {
+		return spsc_last_filled_get(data_fifo, data, size, timeout);
+	}
+
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
 	if (ret) {
 		return ret;
@@ -108,6 +290,11 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void **data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+	if (data_fifo->spsc) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +307,10 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+	if (data_fifo->spsc) {
+		return spsc_num_used_get(data_fifo, alloced_num, locked_num);
+	}
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +329,11 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+	if (data_fifo->spsc) {
+		spsc_reset(data_fifo);
+		return 0;
+	}
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -176,6 +372,12 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+	if (data_fifo->spsc) {
+		spsc_reset(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -96,7 +96,7 @@ static const struct location_method_api method_cellular_api = {
 	.cancel           = method_cloud_location_cancel,
 	.timeout          = method_cloud_location_cancel,
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
-	.details_get      = NULL,
+	.details_get      = method_cloud_location_details_get,
 #endif
 };
 #endif
@@ -110,7 +110,7 @@ static const struct location_method_api method_wifi_api = {
 	.cancel           = method_cloud_location_cancel,
 	.timeout          = method_cloud_location_cancel,
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
-	.details_get      = NULL,
+	.details_get      = method_cloud_location_details_get,
 #endif
 
 /** Threshold for cloud location method to select Wi-Fi vs. cellular into the returned event. */
@@ -131,7 +131,7 @@ static const struct location_method_api method_cloud_location_api = {
 	.cancel           = method_cloud_location_cancel,
 	.timeout          = method_cloud_location_cancel,
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
-	.details_get      = NULL,
+	.details_get      = method_cloud_location_details_get,
 #endif
 };
 #endif
@@ -158,6 +158,7 @@ static void location_core_current_event_data_init(enum location_method method)
 	memset(&loc_req_info.current_event_data, 0, sizeof(loc_req_info.current_event_data));
 
 	loc_req_info.current_method = method;
+	loc_req_info.method_start_uptime = k_uptime_get();
 }
 
 static void location_core_current_config_clear(void)
@@ -601,16 +602,17 @@ void location_core_cloud_location_ext_result_set(
 static void location_core_event_details_get(struct location_event_data *event)
 {
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
-	if (location_method_api_get(loc_req_info.current_method)->details_get != NULL) {
+	struct location_data_details *details;
 
-		struct location_data_details *details;
+	if (event->id == LOCATION_EVT_LOCATION) {
+		details = &event->location.details;
+	} else {
+		details = &event->error.details;
+	}
 
-		if (event->id == LOCATION_EVT_LOCATION) {
-			details = &event->location.details;
-		} else {
-			details = &event->error.details;
-		}
+	details->elapsed_time_method = k_uptime_get() - loc_req_info.method_start_uptime;
 
+	if (location_method_api_get(loc_req_info.current_method)->details_get != NULL) {
 		location_method_api_get(loc_req_info.current_method)->details_get(details);
 	}
 #endif
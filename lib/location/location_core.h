@@ -42,6 +42,9 @@ struct location_request_info {
 	 * This is used in cloud location method to calculate timeout for the cloud operation.
 	 */
 	int64_t timeout_uptime;
+
+	/** Device uptime when the currently used method was started. */
+	int64_t method_start_uptime;
 };
 
 struct location_method_api {
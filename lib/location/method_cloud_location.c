@@ -36,6 +36,10 @@ struct method_cloud_location_start_work_args {
 static struct method_cloud_location_start_work_args method_cloud_location_start_work;
 static bool running;
 
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+static struct location_data_details location_data_details_cloud;
+#endif
+
 static void method_cloud_location_positioning_work_fn(struct k_work *work)
 {
 	struct method_cloud_location_start_work_args *work_data =
@@ -46,6 +50,9 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 	struct lte_lc_cells_info *scan_cellular_info = NULL;
 	int32_t used_timeout_ms;
 	int err = 0;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	int64_t stage_start_time;
+#endif
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 	struct k_sem wifi_scan_ready;
 
@@ -63,6 +70,7 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 
 	location_core_timer_start(used_timeout_ms);
 
+	/* Wi-Fi scan runs in the background while the neighbor cells are measured */
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 	if (wifi_config != NULL) {
 		err = scan_wifi_start(&wifi_scan_ready);
@@ -71,8 +79,15 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 
 #if defined(CONFIG_LOCATION_METHOD_CELLULAR)
 	if (cell_config != NULL) {
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+		stage_start_time = k_uptime_get();
+#endif
 		err = scan_cellular_start(cell_config->cell_count);
 		scan_cellular_info = scan_cellular_results_get();
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+		location_data_details_cloud.cellular.elapsed_time_scan =
+			k_uptime_get() - stage_start_time;
+#endif
 	}
 #endif
 
@@ -80,6 +95,9 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 	if (wifi_config != NULL) {
 		k_sem_take(&wifi_scan_ready, K_FOREVER);
 		scan_wifi_info = scan_wifi_results_get();
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+		location_data_details_cloud.wifi.elapsed_time_scan = scan_wifi_elapsed_time_get();
+#endif
 	}
 #endif
 
@@ -142,7 +160,13 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 	}
 
 	/* Request location from the cloud */
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	stage_start_time = k_uptime_get();
+#endif
 	err = cloud_service_location_get(&params, &location);
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	location_data_details_cloud.elapsed_time_cloud_request = k_uptime_get() - stage_start_time;
+#endif
 	if (err) {
 		LOG_ERR("Failed to acquire location using cloud location, error: %d", err);
 	} else {
@@ -184,10 +208,23 @@ int method_cloud_location_cancel(void)
 	return 0;
 }
 
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+void method_cloud_location_details_get(struct location_data_details *details)
+{
+	details->elapsed_time_cloud_request = location_data_details_cloud.elapsed_time_cloud_request;
+	details->cellular = location_data_details_cloud.cellular;
+	details->wifi = location_data_details_cloud.wifi;
+}
+#endif
+
 int method_cloud_location_get(const struct location_request_info *request)
 {
 	__ASSERT_NO_MSG(request->cellular != NULL || request->wifi != NULL);
 
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	memset(&location_data_details_cloud, 0, sizeof(location_data_details_cloud));
+#endif
+
 	k_work_init(
 		&method_cloud_location_start_work.work_item,
 		method_cloud_location_positioning_work_fn);
@@ -443,6 +443,9 @@ bool method_gnss_agps_required(struct nrf_modem_gnss_agps_data_frame *request)
  */
 static void method_gnss_assistance_request(void)
 {
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	int64_t start_time = k_uptime_get();
+#endif
 #if defined(CONFIG_NRF_CLOUD_PGPS)
 	/* Ephemerides come from P-GPS. */
 	pgps_agps_request.sv_mask_ephe = agps_request.sv_mask_ephe;
@@ -516,6 +519,9 @@ static void method_gnss_assistance_request(void)
 		}
 	}
 #endif /* CONFIG_NRF_CLOUD_PGPS */
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	location_data_details_gnss.elapsed_time_assistance += k_uptime_get() - start_time;
+#endif
 }
 
 static void method_gnss_agps_req_event_handle_work_fn(struct k_work *item)
@@ -27,6 +27,8 @@ static struct wifi_scan_info scan_wifi_info = {
 	.ap_info = scan_results,
 };
 static struct k_sem *scan_wifi_ready;
+static int64_t scan_wifi_start_time;
+static uint32_t scan_wifi_elapsed_time;
 
 struct wifi_scan_info *scan_wifi_results_get(void)
 {
@@ -55,6 +57,8 @@ int scan_wifi_start(struct k_sem *wifi_scan_ready)
 	LOG_DBG("Triggering start of Wi-Fi scanning");
 
 	scan_wifi_info.cnt = 0;
+	scan_wifi_start_time = k_uptime_get();
+	scan_wifi_elapsed_time = 0;
 
 	__ASSERT_NO_MSG(wifi_iface != NULL);
 	ret = net_mgmt(NET_REQUEST_WIFI_SCAN, wifi_iface, NULL, 0);
@@ -102,6 +106,8 @@ static void scan_wifi_done_handle(struct net_mgmt_event_callback *cb)
 		LOG_DBG("Scan request done with %d Wi-Fi APs", scan_wifi_info.cnt);
 	}
 
+	scan_wifi_elapsed_time = k_uptime_get() - scan_wifi_start_time;
+
 	k_sem_give(scan_wifi_ready);
 	scan_wifi_ready = NULL;
 }
@@ -136,6 +142,11 @@ int scan_wifi_cancel(void)
 	return 0;
 }
 
+uint32_t scan_wifi_elapsed_time_get(void)
+{
+	return scan_wifi_elapsed_time;
+}
+
 int scan_wifi_init(void)
 {
 	const struct device *wifi_dev;
@@ -13,5 +13,6 @@ int scan_wifi_init(void);
 int scan_wifi_start(struct k_sem *wifi_scan_ready);
 struct wifi_scan_info *scan_wifi_results_get(void);
 int scan_wifi_cancel(void);
+uint32_t scan_wifi_elapsed_time_get(void);
 
 #endif /* SCAN_WIFI_H */
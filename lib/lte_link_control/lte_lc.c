@@ -67,6 +67,8 @@ static char rai_param[2] = CONFIG_LTE_RAI_REQ_VALUE;
 
 /* Requested NCELLMEAS params */
 static struct lte_lc_ncellmeas_params ncellmeas_params;
+/* Neighbor cells of a %NCELLMEAS notification, valid while the event is dispatched. */
+static struct lte_lc_ncell neighbor_cells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
 /* Sempahore value 1 means ncellmeas is not ongoing, and 0 means it's ongoing. */
 K_SEM_DEFINE(ncellmeas_idle_sem, 1, 1);
 
@@ -363,6 +365,7 @@ static void at_handler_ncellmeas_gci(const char *response)
 	}
 
 	evt.cells_info.gci_cells = cells;
+	evt.cells_info.neighbor_cells = neighbor_cells;
 	err = parse_ncellmeas_gci(&ncellmeas_params, resp, &evt.cells_info);
 	LOG_DBG("parse_ncellmeas_gci returned %d", err);
 	switch (err) {
@@ -385,7 +388,6 @@ static void at_handler_ncellmeas_gci(const char *response)
 	}
 
 	k_free(cells);
-	k_free(evt.cells_info.neighbor_cells);
 }
 
 static void at_handler_ncellmeas(const char *response)
@@ -409,23 +411,13 @@ static void at_handler_ncellmeas(const char *response)
 		goto exit;
 	}
 
-	int ncell_count = neighborcell_count_get(response);
-	struct lte_lc_ncell *neighbor_cells = NULL;
-
-	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d", ncell_count);
-
-	if (ncell_count != 0) {
-		neighbor_cells = k_calloc(ncell_count, sizeof(struct lte_lc_ncell));
-		if (neighbor_cells == NULL) {
-			LOG_ERR("Failed to allocate memory for neighbor cells");
-			goto exit;
-		}
-	}
-
 	evt.cells_info.neighbor_cells = neighbor_cells;
 
 	err = parse_ncellmeas(response, &evt.cells_info);
 
+	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d",
+		evt.cells_info.ncells_count);
+
 	switch (err) {
 	case -E2BIG:
 		LOG_WRN("Not all neighbor cells could be parsed");
@@ -442,9 +434,6 @@ static void at_handler_ncellmeas(const char *response)
 		break;
 	}
 
-	if (neighbor_cells) {
-		k_free(neighbor_cells);
-	}
 exit:
 	k_sem_give(&ncellmeas_idle_sem);
 }
@@ -131,30 +131,6 @@ void event_handler_list_dispatch(const struct lte_lc_evt *const evt)
 }
 
 
-/* Converts integer on string format to integer type.
- * Returns zero on success, otherwise negative error on failure.
- */
-static int string_param_to_int(struct at_param_list *resp_list,
-			       size_t idx, int *output, int base)
-{
-	int err;
-	char str_buf[16];
-	size_t len = sizeof(str_buf);
-
-	err = at_params_string_get(resp_list, idx, str_buf, &len);
-	if (err) {
-		return err;
-	}
-
-	str_buf[len] = '\0';
-
-	if (string_to_int(str_buf, base, output)) {
-		return -ENODATA;
-	}
-
-	return 0;
-}
-
 /* Confirm valid system mode and set Paging Time Window multiplier.
  * Multiplier is 1.28 s for LTE-M, and 2.56 s for NB-IoT, derived from
  * Figure 10.5.5.32/3GPP TS 24.008.
@@ -211,20 +187,6 @@ static int get_edrx_value(enum lte_lc_lte_mode lte_mode, uint8_t idx, float *edr
 	return 0;
 }
 
-/* Counts the frequency of a character in a null-terminated string. */
-static uint32_t get_char_frequency(const char *str, char c)
-{
-	uint32_t count = 0;
-
-	do {
-		if (*str == c) {
-			count++;
-		}
-	} while (*(str++) != '\0');
-
-	return count;
-}
-
 /**@brief Helper function to check if a response is what was expected
  *
  * @param response Pointer to response prefix
@@ -725,296 +687,440 @@ clean_exit:
 	return err;
 }
 
-uint32_t neighborcell_count_get(const char *at_response)
-{
-	uint32_t comma_count, ncell_elements, ncell_count;
+/* Types of the parameters in a %NCELLMEAS notification. */
+enum ncellmeas_param_type {
+	/* Hexadecimal string, stored as uint32_t. Values above LTE_LC_CELL_EUTRAN_ID_MAX
+	 * are stored as LTE_LC_CELL_EUTRAN_ID_INVALID.
+	 */
+	NCELLMEAS_PARAM_CELL_ID,
+	/* String with a three digit MCC followed by the MNC, stored in struct lte_lc_cell. */
+	NCELLMEAS_PARAM_PLMN,
+	/* Hexadecimal string, stored as uint32_t. */
+	NCELLMEAS_PARAM_HEX,
+	/* Decimal integers of different sizes. */
+	NCELLMEAS_PARAM_U16,
+	NCELLMEAS_PARAM_S16,
+	NCELLMEAS_PARAM_U32,
+	NCELLMEAS_PARAM_S32,
+	NCELLMEAS_PARAM_U64,
+};
 
-	if (at_response == NULL) {
-		LOG_ERR("at_response is NULL, can't get cell count");
-		return 0;
-	}
+struct ncellmeas_param {
+	uint8_t type;
+	uint8_t offset;
+};
 
-	comma_count = get_char_frequency(at_response, ',');
-	if (comma_count < AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT) {
-		return 0;
+#define NCELLMEAS_CELL_PARAM(_type, _member) \
+	{ .type = NCELLMEAS_PARAM_##_type, .offset = offsetof(struct lte_lc_cell, _member) }
+
+#define NCELLMEAS_NCELL_PARAM(_type, _member) \
+	{ .type = NCELLMEAS_PARAM_##_type, .offset = offsetof(struct lte_lc_ncell, _member) }
+
+/* Current cell parameters following the status in a %NCELLMEAS notification. */
+static const struct ncellmeas_param ncellmeas_cell_params[] = {
+	NCELLMEAS_CELL_PARAM(CELL_ID, id),
+	NCELLMEAS_CELL_PARAM(PLMN, mcc),
+	NCELLMEAS_CELL_PARAM(HEX, tac),
+	NCELLMEAS_CELL_PARAM(U16, timing_advance),
+	NCELLMEAS_CELL_PARAM(U32, earfcn),
+	NCELLMEAS_CELL_PARAM(U16, phys_cell_id),
+	NCELLMEAS_CELL_PARAM(S16, rsrp),
+	NCELLMEAS_CELL_PARAM(S16, rsrq),
+	NCELLMEAS_CELL_PARAM(U64, measurement_time),
+};
+
+/* Cell parameters in a %NCELLMEAS notification for GCI search types. The cell parameters
+ * are followed by <serving> and <neighbor_count>, which are not stored in the cell.
+ */
+static const struct ncellmeas_param ncellmeas_gci_cell_params[] = {
+	NCELLMEAS_CELL_PARAM(CELL_ID, id),
+	NCELLMEAS_CELL_PARAM(PLMN, mcc),
+	NCELLMEAS_CELL_PARAM(HEX, tac),
+	NCELLMEAS_CELL_PARAM(U16, timing_advance),
+	NCELLMEAS_CELL_PARAM(U64, timing_advance_meas_time),
+	NCELLMEAS_CELL_PARAM(U32, earfcn),
+	NCELLMEAS_CELL_PARAM(U16, phys_cell_id),
+	NCELLMEAS_CELL_PARAM(S16, rsrp),
+	NCELLMEAS_CELL_PARAM(S16, rsrq),
+	NCELLMEAS_CELL_PARAM(U64, measurement_time),
+};
+
+/* Parameters of each neighbor cell. */
+static const struct ncellmeas_param ncellmeas_ncell_params[] = {
+	NCELLMEAS_NCELL_PARAM(U32, earfcn),
+	NCELLMEAS_NCELL_PARAM(U16, phys_cell_id),
+	NCELLMEAS_NCELL_PARAM(S16, rsrp),
+	NCELLMEAS_NCELL_PARAM(S16, rsrq),
+	NCELLMEAS_NCELL_PARAM(S32, time_diff),
+};
+
+/* Tokenizer that walks through the comma separated parameters of a %NCELLMEAS
+ * notification in place, without copying or allocating anything.
+ */
+struct ncellmeas_tokenizer {
+	const char *pos;
+	bool end;
+};
+
+/* Returns false if the response is not a %NCELLMEAS notification. */
+static bool ncellmeas_tokenizer_init(struct ncellmeas_tokenizer *tok, const char *at_response)
+{
+	size_t prefix_len = sizeof(AT_NCELLMEAS_RESPONSE_PREFIX) - 1;
+
+	if ((strncmp(at_response, AT_NCELLMEAS_RESPONSE_PREFIX, prefix_len) != 0) ||
+	    (at_response[prefix_len] != ':')) {
+		return false;
 	}
 
-	/* Add one, as there's no comma after the last element. */
-	ncell_elements = comma_count - (AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT - 1) + 1;
-	ncell_count = ncell_elements / AT_NCELLMEAS_N_PARAMS_COUNT;
+	tok->pos = &at_response[prefix_len + 1];
+	tok->end = false;
 
-	return ncell_count;
+	return true;
 }
 
-/* Parse NCELLMEAS notification and put information into struct lte_lc_cells_info.
- *
- * Returns 0 on successful cell measurements and population of struct.
- *	     The current cell information is valid if the current cell ID is
- *	     not set to LTE_LC_CELL_EUTRAN_ID_INVALID.
- *	     The ncells_count indicates how many neighbor cells were parsed
- *	     into the neighbor_cells array.
- * Returns 1 on measurement failure
- * Returns -E2BIG if not all cells were parsed due to memory limitations
- * Returns otherwise a negative error code.
+/* Gets the next parameter without surrounding whitespace and quotes.
+ * Returns -ENODATA if there are no more parameters.
  */
-int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells)
+static int ncellmeas_token_next(struct ncellmeas_tokenizer *tok, const char **str, size_t *len)
 {
-	int err, status, tmp, len;
-	struct at_param_list resp_list;
-	char  response_prefix[sizeof(AT_NCELLMEAS_RESPONSE_PREFIX)] = {0};
-	size_t response_prefix_len = sizeof(response_prefix);
-	char tmp_str[7];
-	bool incomplete = false;
-	/* Count the actual number of parameters in the AT response before
-	 * allocating heap for it. This may save quite a bit of heap as the
-	 * worst case scenario is 96 elements.
-	 * 3 is added to account for the parameters that do not have a trailng
-	 * comma.
-	 */
-	size_t param_count = get_char_frequency(at_response, ',') + 3;
-
-	cells->ncells_count = 0;
-	cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	const char *start = tok->pos;
+	const char *end = start;
 
-	err = at_params_list_init(&resp_list, param_count);
-	if (err) {
-		LOG_ERR("Could not init AT params list, error: %d", err);
-		return err;
+	if (tok->end) {
+		return -ENODATA;
 	}
 
-	err = at_parser_params_from_str(at_response,
-					NULL,
-					&resp_list);
-	if (err && err != -E2BIG) {
-		LOG_ERR("Could not parse AT%%NCELLMEAS response, error: %d", err);
-		goto clean_exit;
-	} else if (err == -E2BIG) {
-		incomplete = true;
+	while ((*end != ',') && (*end != '\0') && (*end != '\r') && (*end != '\n')) {
+		end++;
 	}
 
-	err = at_params_string_get(&resp_list,
-				   AT_RESPONSE_PREFIX_INDEX,
-				   response_prefix,
-				   &response_prefix_len);
-	if (err) {
-		LOG_ERR("Could not get response prefix, error: %d", err);
-		goto clean_exit;
-	}
+	tok->end = (*end != ',');
+	tok->pos = tok->end ? end : end + 1;
 
-	if (!response_is_valid(response_prefix, response_prefix_len,
-			       AT_NCELLMEAS_RESPONSE_PREFIX)) {
-		/* The unsolicited response is not a NCELLMEAS response, ignore it. */
-		LOG_DBG("Not a valid NCELLMEAS response");
-		goto clean_exit;
+	while ((start < end) && (*start == ' ')) {
+		start++;
 	}
 
-	/* Status code. */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_STATUS_INDEX, &status);
-	if (err) {
-		goto clean_exit;
+	while ((end > start) && (*(end - 1) == ' ')) {
+		end--;
 	}
 
-	if (status != AT_NCELLMEAS_STATUS_VALUE_SUCCESS) {
-		err = 1;
-		goto clean_exit;
+	if (((end - start) >= 2) && (*start == '"') && (*(end - 1) == '"')) {
+		start++;
+		end--;
 	}
 
-	/* Current cell ID. */
-	err = string_param_to_int(&resp_list, AT_NCELLMEAS_CELL_ID_INDEX, &tmp, 16);
-	if (err) {
-		goto clean_exit;
+	*str = start;
+	*len = end - start;
+
+	return 0;
+}
+
+/* Converts a decimal or hexadecimal number that is not null-terminated. */
+static int ncellmeas_number_get(const char *str, size_t len, int base, int64_t *value)
+{
+	bool negative = false;
+	int64_t result = 0;
+
+	if ((len != 0) && (*str == '-')) {
+		negative = true;
+		str++;
+		len--;
 	}
 
-	if (tmp > LTE_LC_CELL_EUTRAN_ID_MAX) {
-		tmp = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	if (len == 0) {
+		return -EBADMSG;
 	}
-	cells->current_cell.id = tmp;
 
-	/* PLMN */
-	len = sizeof(tmp_str);
+	for (size_t i = 0; i < len; i++) {
+		uint8_t digit;
 
-	err = at_params_string_get(&resp_list, AT_NCELLMEAS_PLMN_INDEX,
-				   tmp_str, &len);
-	if (err) {
-		goto clean_exit;
+		if (char2hex(str[i], &digit) || (digit >= base)) {
+			return -EBADMSG;
+		}
+
+		if (result > (INT64_MAX - digit) / base) {
+			return -ERANGE;
+		}
+
+		result = result * base + digit;
 	}
 
-	tmp_str[len] = '\0';
+	*value = negative ? -result : result;
+
+	return 0;
+}
 
-	/* Read MNC and store as integer. The MNC starts as the fourth character
-	 * in the string, following three characters long MCC.
+static int ncellmeas_plmn_get(const char *str, size_t len, struct lte_lc_cell *cell)
+{
+	int64_t mcc, mnc;
+	int err;
+
+	/* The MNC starts as the fourth character in the string, following the three
+	 * characters long MCC.
 	 */
-	err = string_to_int(&tmp_str[3], 10, &cells->current_cell.mnc);
-	if (err) {
-		goto clean_exit;
+	if (len <= 3) {
+		return -EBADMSG;
 	}
 
-	/* Null-terminated MCC, read and store it. */
-	tmp_str[3] = '\0';
-
-	err = string_to_int(tmp_str, 10, &cells->current_cell.mcc);
+	err = ncellmeas_number_get(str, 3, 10, &mcc);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	/* Tracking area code. */
-	err = string_param_to_int(&resp_list, AT_NCELLMEAS_TAC_INDEX, &tmp, 16);
+	err = ncellmeas_number_get(&str[3], len - 3, 10, &mnc);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	cells->current_cell.tac = tmp;
+	if ((mcc < 0) || (mnc < 0) || (mnc > 999)) {
+		return -EBADMSG;
+	}
 
-	/* Timing advance */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_TIMING_ADV_INDEX,
-				&tmp);
-	if (err) {
-		goto clean_exit;
+	cell->mcc = mcc;
+	cell->mnc = mnc;
+
+	return 0;
+}
+
+/* Stores a numeric parameter at its offset in the output structure after a range check. */
+static int ncellmeas_value_store(const struct ncellmeas_param *param, int64_t value, void *out)
+{
+	uint8_t *dst = (uint8_t *)out + param->offset;
+
+	switch (param->type) {
+	case NCELLMEAS_PARAM_CELL_ID:
+		if ((value < 0) || (value > UINT32_MAX)) {
+			return -ERANGE;
+		}
+
+		if (value > LTE_LC_CELL_EUTRAN_ID_MAX) {
+			LOG_WRN("cell_id = %lld which is > LTE_LC_CELL_EUTRAN_ID_MAX; "
+				"marking invalid", value);
+			value = LTE_LC_CELL_EUTRAN_ID_INVALID;
+		}
+
+		*(uint32_t *)dst = value;
+		break;
+	case NCELLMEAS_PARAM_HEX:
+	case NCELLMEAS_PARAM_U32:
+		if ((value < 0) || (value > UINT32_MAX)) {
+			return -ERANGE;
+		}
+
+		*(uint32_t *)dst = value;
+		break;
+	case NCELLMEAS_PARAM_U16:
+		if ((value < 0) || (value > UINT16_MAX)) {
+			return -ERANGE;
+		}
+
+		*(uint16_t *)dst = value;
+		break;
+	case NCELLMEAS_PARAM_S16:
+		if ((value < INT16_MIN) || (value > INT16_MAX)) {
+			return -ERANGE;
+		}
+
+		*(int16_t *)dst = value;
+		break;
+	case NCELLMEAS_PARAM_S32:
+		if ((value < INT32_MIN) || (value > INT32_MAX)) {
+			return -ERANGE;
+		}
+
+		*(int *)dst = value;
+		break;
+	case NCELLMEAS_PARAM_U64:
+		if (value < 0) {
+			return -ERANGE;
+		}
+
+		*(uint64_t *)dst = value;
+		break;
+	default:
+		return -EINVAL;
 	}
 
-	cells->current_cell.timing_advance = tmp;
+	return 0;
+}
 
-	/* EARFCN */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_EARFCN_INDEX,
-				&cells->current_cell.earfcn);
+static int ncellmeas_param_parse(struct ncellmeas_tokenizer *tok,
+				 const struct ncellmeas_param *param, void *out)
+{
+	const char *str;
+	size_t len;
+	int64_t value;
+	int err;
+
+	err = ncellmeas_token_next(tok, &str, &len);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	/* Physical cell ID. */
-	err = at_params_short_get(&resp_list, AT_NCELLMEAS_PHYS_CELL_ID_INDEX,
-				&cells->current_cell.phys_cell_id);
-	if (err) {
-		goto clean_exit;
+	switch (param->type) {
+	case NCELLMEAS_PARAM_PLMN:
+		return ncellmeas_plmn_get(str, len, out);
+	case NCELLMEAS_PARAM_CELL_ID:
+	case NCELLMEAS_PARAM_HEX:
+		err = ncellmeas_number_get(str, len, 16, &value);
+		break;
+	default:
+		err = ncellmeas_number_get(str, len, 10, &value);
+		break;
 	}
 
-	/* RSRP */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_RSRP_INDEX, &tmp);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	cells->current_cell.rsrp = tmp;
+	return ncellmeas_value_store(param, value, out);
+}
 
-	/* RSRQ */
-	err = at_params_int_get(&resp_list, AT_NCELLMEAS_RSRQ_INDEX, &tmp);
-	if (err) {
-		goto clean_exit;
+static int ncellmeas_params_parse(struct ncellmeas_tokenizer *tok,
+				  const struct ncellmeas_param *params, size_t count, void *out)
+{
+	int err;
+
+	for (size_t i = 0; i < count; i++) {
+		err = ncellmeas_param_parse(tok, &params[i], out);
+		if (err) {
+			LOG_ERR("Could not parse NCELLMEAS parameter %zu, error: %d", i, err);
+			return err;
+		}
 	}
 
-	cells->current_cell.rsrq = tmp;
+	return 0;
+}
+
+/* Parses a decimal parameter that is not stored in a cell structure. */
+static int ncellmeas_int_parse(struct ncellmeas_tokenizer *tok, int64_t min, int64_t max,
+			       int64_t *value)
+{
+	const char *str;
+	size_t len;
+	int err;
+
+	err = ncellmeas_token_next(tok, &str, &len);
+	if (err) {
+		return err;
+	}
 
-	/* Measurement time. */
-	err = at_params_int64_get(&resp_list, AT_NCELLMEAS_MEASUREMENT_TIME_INDEX,
-				  &cells->current_cell.measurement_time);
+	err = ncellmeas_number_get(str, len, 10, value);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	/* Neighbor cell count. */
-	cells->ncells_count = neighborcell_count_get(at_response);
+	if ((*value < min) || (*value > max)) {
+		return -ERANGE;
+	}
 
-	/* Starting from modem firmware v1.3.1, timing advance measurement time
-	 * information is added as the last parameter in the response.
-	 */
-	size_t ta_meas_time_index = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +
-			cells->ncells_count * AT_NCELLMEAS_N_PARAMS_COUNT;
+	return 0;
+}
 
-	if (at_params_valid_count_get(&resp_list) > ta_meas_time_index) {
-		err = at_params_int64_get(&resp_list, ta_meas_time_index,
-					  &cells->current_cell.timing_advance_meas_time);
-		if (err) {
-			goto clean_exit;
-		}
-	} else {
-		cells->current_cell.timing_advance_meas_time = 0;
+/* Parse NCELLMEAS notification and put information into struct lte_lc_cells_info.
+ * The neighbor_cells array must have room for CONFIG_LTE_NEIGHBOR_CELLS_MAX entries.
+ *
+ * Returns 0 on successful cell measurements and population of struct.
+ *	     The current cell information is valid if the current cell ID is
+ *	     not set to LTE_LC_CELL_EUTRAN_ID_INVALID.
+ *	     The ncells_count indicates how many neighbor cells were parsed
+ *	     into the neighbor_cells array.
+ * Returns 1 on measurement failure
+ * Returns -E2BIG if not all cells were parsed due to memory limitations
+ * Returns otherwise a negative error code.
+ */
+int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells)
+{
+	int err;
+	int64_t value;
+	struct ncellmeas_tokenizer tok;
+	struct lte_lc_ncell skipped_cell;
+	struct lte_lc_ncell *ncell;
+	bool incomplete = false;
+
+	cells->ncells_count = 0;
+	cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+
+	if (!ncellmeas_tokenizer_init(&tok, at_response)) {
+		/* The unsolicited response is not a NCELLMEAS response, ignore it. */
+		LOG_DBG("Not a valid NCELLMEAS response");
+		return 0;
 	}
 
-	if ((cells->ncells_count == 0) || (cells->neighbor_cells == NULL)) {
-		goto clean_exit;
+	/* Status code. */
+	err = ncellmeas_int_parse(&tok, 0, UINT8_MAX, &value);
+	if (err) {
+		return err;
 	}
 
-	/* Neighboring cells. */
-	for (size_t i = 0; i < cells->ncells_count; i++) {
-		size_t start_idx = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +
-				   i * AT_NCELLMEAS_N_PARAMS_COUNT;
+	if (value != AT_NCELLMEAS_STATUS_VALUE_SUCCESS) {
+		return 1;
+	}
 
-		/* EARFCN */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_EARFCN_INDEX,
-					&cells->neighbor_cells[i].earfcn);
-		if (err) {
-			goto clean_exit;
-		}
+	err = ncellmeas_params_parse(&tok, ncellmeas_cell_params,
+				     ARRAY_SIZE(ncellmeas_cell_params), &cells->current_cell);
+	if (err) {
+		cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+		return err;
+	}
+
+	cells->current_cell.timing_advance_meas_time = 0;
 
-		/* Physical cell ID. */
-		err = at_params_short_get(&resp_list,
-					  start_idx + AT_NCELLMEAS_N_PHYS_CELL_ID_INDEX,
-					  &cells->neighbor_cells[i].phys_cell_id);
+	/* The neighbor cells follow in groups of five parameters.
+	 * Starting from modem firmware v1.3.1, timing advance measurement time
+	 * information is added as the last parameter in the response. It is told apart
+	 * from the EARFCN of a neighbor cell by being the last parameter.
+	 */
+	while (!tok.end) {
+		err = ncellmeas_int_parse(&tok, 0, INT64_MAX, &value);
 		if (err) {
-			goto clean_exit;
+			return err;
 		}
 
-		/* RSRP */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_RSRP_INDEX,
-					&tmp);
-		if (err) {
-			goto clean_exit;
+		if (tok.end) {
+			cells->current_cell.timing_advance_meas_time = value;
+			break;
 		}
 
-		cells->neighbor_cells[i].rsrp = tmp;
+		if ((cells->neighbor_cells != NULL) &&
+		    (cells->ncells_count < CONFIG_LTE_NEIGHBOR_CELLS_MAX)) {
+			ncell = &cells->neighbor_cells[cells->ncells_count];
+		} else {
+			/* Parse the cell anyway to reach the parameters after it. */
+			ncell = &skipped_cell;
+			incomplete = true;
+		}
 
-		/* RSRQ */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_RSRQ_INDEX,
-					&tmp);
+		err = ncellmeas_value_store(&ncellmeas_ncell_params[0], value, ncell);
 		if (err) {
-			goto clean_exit;
+			return err;
 		}
 
-		cells->neighbor_cells[i].rsrq = tmp;
-
-		/* Time difference. */
-		err = at_params_int_get(&resp_list,
-					start_idx + AT_NCELLMEAS_N_TIME_DIFF_INDEX,
-					&cells->neighbor_cells[i].time_diff);
+		err = ncellmeas_params_parse(&tok, &ncellmeas_ncell_params[1],
+					     ARRAY_SIZE(ncellmeas_ncell_params) - 1, ncell);
 		if (err) {
-			goto clean_exit;
+			return err;
 		}
-	}
 
-	if (incomplete) {
-		err = -E2BIG;
+		if (ncell != &skipped_cell) {
+			cells->ncells_count++;
+		}
 	}
 
-clean_exit:
-	at_params_list_free(&resp_list);
-
-	return err;
+	return incomplete ? -E2BIG : 0;
 }
 
 int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params,
 	const char *at_response, struct lte_lc_cells_info *cells)
 {
-	struct at_param_list resp_list;
-	struct lte_lc_ncell *ncells = NULL;
-	int err, status, tmp_int, len;
-	int16_t tmp_short;
-	char response_prefix[sizeof(AT_NCELLMEAS_RESPONSE_PREFIX)] = {0};
-	size_t response_prefix_len = sizeof(response_prefix);
-	char tmp_str[7];
+	struct ncellmeas_tokenizer tok;
+	struct lte_lc_ncell skipped_cell;
+	struct lte_lc_ncell *ncell;
+	int err;
+	int64_t status, value;
 	bool incomplete = false;
-	int curr_index;
-	size_t i = 0, j = 0, k = 0;
-
-	/* Count the actual number of parameters in the AT response before
-	 * allocating heap for it. This may save quite a bit of heap as the
-	 * worst case scenario is 96 elements.
-	 * 3 is added to account for the parameters that do not have a trailing
-	 * comma.
-	 */
-	size_t param_count = get_char_frequency(at_response, ',') + 3;
+	size_t i, j;
 
 	/* Fill the defaults */
 	cells->gci_cells_count = 0;
@@ -1045,297 +1151,98 @@ int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params,
 	 *	[,<n_earfcn2>,<n_phys_cell_id2>,<n_rsrp2>,<n_rsrq2>,<time_diff2>]...]...
 	 */
 
-	err = at_params_list_init(&resp_list, param_count);
-	if (err) {
-		LOG_ERR("Could not init AT params list for cell_list, error: %d", err);
-		goto clean_exit;
-	}
-
-	err = at_parser_params_from_str(at_response, NULL, &resp_list);
-	if (err && err != -E2BIG) {
-		LOG_ERR("Could not parse AT%%NCELLMEAS response, error: %d", err);
-		goto clean_exit;
-	} else if (err == -E2BIG) {
-		/* Returns -E2BIG if the buffers set by CONFIG_LTE_NEIGHBOR_CELLS_MAX
-		 * are too small for the modem response. The associated data is still valid,
-		 * but not complete.
-		 */
-		incomplete = true;
-		LOG_WRN("E2BIG was returned, continue. param_count %d, err %d, str %s",
-			param_count, err, at_response);
-	}
-
-	err = at_params_string_get(&resp_list,
-				   AT_RESPONSE_PREFIX_INDEX,
-				   response_prefix,
-				   &response_prefix_len);
-	if (err) {
-		LOG_ERR("Could not get response prefix, error: %d", err);
-		goto clean_exit;
-	}
-
-	if (!response_is_valid(response_prefix, response_prefix_len,
-			       AT_NCELLMEAS_RESPONSE_PREFIX)) {
+	if (!ncellmeas_tokenizer_init(&tok, at_response)) {
 		/* The unsolicited response is not a NCELLMEAS response, ignore it. */
 		LOG_ERR("Not a valid NCELLMEAS response");
-		goto clean_exit;
+		return 0;
 	}
 
 	/* Status code. */
-	curr_index = AT_NCELLMEAS_STATUS_INDEX;
-	err = at_params_int_get(&resp_list, curr_index, &status);
+	err = ncellmeas_int_parse(&tok, 0, UINT8_MAX, &status);
 	if (err) {
 		LOG_DBG("Cannot parse NCELLMEAS status");
-		goto clean_exit;
+		return err;
 	}
 
 	if (status == AT_NCELLMEAS_STATUS_VALUE_FAIL) {
-		err = 1;
-		LOG_DBG("NCELLMEAS status %d", status);
-		goto clean_exit;
+		LOG_DBG("NCELLMEAS status %lld", status);
+		return 1;
 	} else if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
 		LOG_WRN("NCELLMEAS measurements interrupted; results incomplete");
 	}
 
 	/* Go through the cells. */
-	for (i = 0; curr_index < (param_count - (AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT + 1)) &&
-			i < params->gci_count; i++) {
+	for (i = 0; !tok.end && i < params->gci_count; i++) {
 		struct lte_lc_cell parsed_cell;
 		bool is_serving_cell;
 		uint8_t parsed_ncells_count;
 
-		/* <cell_id>  */
-		curr_index++;
-		err = string_param_to_int(&resp_list, curr_index, &tmp_int, 16);
-		if (err) {
-			LOG_ERR("Could not parse cell_id, index %d, i %d error: %d",
-				curr_index, i, err);
-			goto clean_exit;
-		}
-
-		if (tmp_int > LTE_LC_CELL_EUTRAN_ID_MAX) {
-			LOG_WRN("cell_id = %d which is > LTE_LC_CELL_EUTRAN_ID_MAX; "
-				"marking invalid", tmp_int);
-			tmp_int = LTE_LC_CELL_EUTRAN_ID_INVALID;
-		}
-		parsed_cell.id = tmp_int;
-
-		/* <plmn> */
-		len = sizeof(tmp_str);
-
-		curr_index++;
-		err = at_params_string_get(&resp_list, curr_index, tmp_str, &len);
-		if (err) {
-			LOG_ERR("Could not parse plmn, error: %d", err);
-			goto clean_exit;
-		}
-		/* A successful call to `at_params_string_get` guarantees `len` to be set to
-		 * a value lower than the totalt size of `tmp_str`.
-		 */
-		tmp_str[len] = '\0';
-
-		/* Read MNC and store as integer. The MNC starts as the fourth character
-		 * in the string, following three characters long MCC.
-		 */
-		err = string_to_int(&tmp_str[3], 10, &parsed_cell.mnc);
-		if (err) {
-			LOG_ERR("string_to_int, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* Null-terminated MCC, read and store it. */
-		tmp_str[3] = '\0';
-
-		err = string_to_int(tmp_str, 10, &parsed_cell.mcc);
-		if (err) {
-			LOG_ERR("string_to_int, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <tac> */
-		curr_index++;
-		err = string_param_to_int(&resp_list, curr_index, &tmp_int, 16);
-		if (err) {
-			LOG_ERR("Could not parse tracking_area_code in i %d, error: %d", i, err);
-			goto clean_exit;
-		}
-		parsed_cell.tac = tmp_int;
-
-		/* <ta> */
-		curr_index++;
-		err = at_params_int_get(&resp_list, curr_index, &tmp_int);
-		if (err) {
-			LOG_ERR("Could not parse timing_advance, error: %d", err);
-			goto clean_exit;
-		}
-		parsed_cell.timing_advance = tmp_int;
-
-		/* <ta_meas_time> */
-		curr_index++;
-		err = at_params_int64_get(&resp_list, curr_index,
-					  &parsed_cell.timing_advance_meas_time);
-		if (err) {
-			LOG_ERR("Could not parse timing_advance_meas_time, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <earfcn> */
-		curr_index++;
-		err = at_params_int_get(&resp_list, curr_index, &parsed_cell.earfcn);
-		if (err) {
-			LOG_ERR("Could not parse earfcn, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <phys_cell_id> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &parsed_cell.phys_cell_id);
-		if (err) {
-			LOG_ERR("Could not parse phys_cell_id, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <rsrp> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &parsed_cell.rsrp);
-		if (err) {
-			LOG_ERR("Could not parse rsrp, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <rsrq> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &parsed_cell.rsrq);
+		err = ncellmeas_params_parse(&tok, ncellmeas_gci_cell_params,
+					     ARRAY_SIZE(ncellmeas_gci_cell_params), &parsed_cell);
 		if (err) {
-			LOG_ERR("Could not parse rsrq, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <meas_time> */
-		curr_index++;
-		err = at_params_int64_get(&resp_list, curr_index, &parsed_cell.measurement_time);
-		if (err) {
-			LOG_ERR("Could not parse meas_time, error: %d", err);
-			goto clean_exit;
+			LOG_ERR("Could not parse GCI cell %zu, error: %d", i, err);
+			return err;
 		}
 
 		/* <serving> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &tmp_short);
+		err = ncellmeas_int_parse(&tok, 0, 1, &value);
 		if (err) {
 			LOG_ERR("Could not parse serving, error: %d", err);
-			goto clean_exit;
+			return err;
 		}
-		is_serving_cell = tmp_short;
+		is_serving_cell = value;
 
 		/* <neighbor_count> */
-		curr_index++;
-		err = at_params_short_get(&resp_list, curr_index, &tmp_short);
+		err = ncellmeas_int_parse(&tok, 0, UINT8_MAX, &value);
 		if (err) {
 			LOG_ERR("Could not parse neighbor_count, error: %d", err);
-			goto clean_exit;
+			return err;
 		}
-		parsed_ncells_count = tmp_short;
+		parsed_ncells_count = value;
 
 		if (is_serving_cell) {
-			int to_be_parsed_ncell_count = 0;
-
-			/* This the current/serving cell.
-			 * In practice the <neighbor_count> is always 0 for other than
-			 * the serving cell, i.e. no neigbour cell list is available.
-			 * Thus, handle neighbor cells only for the serving cell.
-			 */
 			cells->current_cell = parsed_cell;
-			if (parsed_ncells_count != 0) {
-				/* Allocate room for the parsed neighbor info. */
-				if (parsed_ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
-					to_be_parsed_ncell_count = CONFIG_LTE_NEIGHBOR_CELLS_MAX;
-					incomplete = true;
-					LOG_WRN("Cutting response, because received neigbor cell"
-						" count is bigger than configured max: %d",
-							CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+		} else {
+			cells->gci_cells[cells->gci_cells_count] = parsed_cell;
+			cells->gci_cells_count++; /* Increase count for non-serving GCI cell */
+		}
 
-				} else {
-					to_be_parsed_ncell_count = parsed_ncells_count;
-				}
-				ncells = k_calloc(
-						to_be_parsed_ncell_count,
-						sizeof(struct lte_lc_ncell));
-				if (ncells == NULL) {
-					LOG_WRN("Failed to allocate memory for the ncells"
-						" (continue)");
-					continue;
+		/* In practice the <neighbor_count> is always 0 for other than the serving
+		 * cell, i.e. no neighbor cell list is available. Thus, store neighbor cells
+		 * only for the serving cell, and skip over any others.
+		 */
+		for (j = 0; j < parsed_ncells_count; j++) {
+			if (is_serving_cell && (cells->neighbor_cells != NULL) &&
+			    (cells->ncells_count < CONFIG_LTE_NEIGHBOR_CELLS_MAX)) {
+				ncell = &cells->neighbor_cells[cells->ncells_count];
+			} else {
+				/* Parse the cell anyway to reach the parameters after it. */
+				ncell = &skipped_cell;
+				if (is_serving_cell) {
+					incomplete = true;
 				}
-				cells->neighbor_cells = ncells;
-				cells->ncells_count = to_be_parsed_ncell_count;
 			}
 
-			/* Parse neighbors */
-			for (j = 0; j < to_be_parsed_ncell_count; j++) {
-				/* <n_earfcn[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list,
-							curr_index,
-							&cells->neighbor_cells[j].earfcn);
-				if (err) {
-					LOG_ERR("Could not parse n_earfcn, error: %d", err);
-					goto clean_exit;
-				}
-
-				/* <n_phys_cell_id[j]> */
-				curr_index++;
-				err = at_params_short_get(&resp_list,
-							  curr_index,
-							  &cells->neighbor_cells[j].phys_cell_id);
-				if (err) {
-					LOG_ERR("Could not parse n_phys_cell_id, error: %d", err);
-					goto clean_exit;
-				}
+			err = ncellmeas_params_parse(&tok, ncellmeas_ncell_params,
+						     ARRAY_SIZE(ncellmeas_ncell_params), ncell);
+			if (err) {
+				LOG_ERR("Could not parse neighbor cell %zu, error: %d", j, err);
+				return err;
+			}
 
-				/* <n_rsrp[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrp, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrp = tmp_int;
-
-				/* <n_rsrq[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrq, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrq = tmp_int;
-
-				/* <time_diff[j]> */
-				curr_index++;
-				err = at_params_int_get(&resp_list,
-							curr_index,
-							&cells->neighbor_cells[j].time_diff);
-				if (err) {
-					LOG_ERR("Could not parse time_diff, error: %d", err);
-					goto clean_exit;
-				}
+			if (ncell != &skipped_cell) {
+				cells->ncells_count++;
 			}
-		} else {
-			cells->gci_cells[k] = parsed_cell;
-			cells->gci_cells_count++; /* Increase count for non-serving GCI cell */
-			k++;
 		}
 	}
 
 	if (incomplete) {
-		err = -E2BIG;
-		LOG_ERR("Buffer is too small; results incomplete: %d", err);
+		LOG_WRN("Received neighbor cell count is bigger than configured max: %d",
+			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+		return -E2BIG;
 	}
 
-clean_exit:
-	at_params_list_free(&resp_list);
-
-	return err;
+	return 0;
 }
 
 int parse_xmodemsleep(const char *at_response, struct lte_lc_modem_sleep *modem_sleep)
@@ -7,6 +7,7 @@
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
 #include <modem/at_cmd_parser.h>
+#include <modem/nrf_modem_lib.h>
 #include <ctype.h>
 #include <zephyr/device.h>
 #include <errno.h>
@@ -15,9 +16,11 @@
 #include <zephyr/net/socket.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(modem_info);
@@ -44,6 +47,7 @@ LOG_MODULE_REGISTER(modem_info);
 #define AT_CMD_IMEI		"AT+CGSN"
 #define AT_CMD_DATE_TIME	"AT+CCLK?"
 #define AT_CMD_SUCCESS_SIZE	5
+#define AT_CMD_XSIM_SUBSCRIBE	"AT%%XSIM=1"
 
 #define RSRP_DATA_NAME		"rsrp"
 #define CUR_BAND_DATA_NAME	"currentBand"
@@ -132,6 +136,9 @@ LOG_MODULE_REGISTER(modem_info);
 
 #define CELL_RSRP_INVALID	255
 
+/* +CEREG status: not registered due to UICC failure. */
+#define CEREG_STAT_UICC_FAIL	90
+
 /* FW UUID is 36 characters: XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX */
 #define FW_UUID_SIZE 37
 
@@ -358,6 +365,127 @@ AT_MONITOR(modem_info_cesq_mon, "%CESQ", modem_info_rsrp_subscribe_handler, PAUS
 static rsrp_cb_t modem_info_rsrp_cb;
 static struct at_param_list m_param_list;
 
+/* Modem information that does not change while the modem is running,
+ * or while the same SIM card is in use.
+ */
+enum cache_id {
+	CACHE_ID_FW_VERSION,
+	CACHE_ID_IMEI,
+	CACHE_ID_SVN,
+	CACHE_ID_SUP_BAND,
+	CACHE_ID_ICCID,
+	CACHE_ID_IMSI,
+	CACHE_ID_COUNT,
+};
+
+#define CACHE_SIM_MASK		(BIT(CACHE_ID_ICCID) | BIT(CACHE_ID_IMSI))
+#define CACHE_ALL_MASK		(BIT(CACHE_ID_COUNT) - 1)
+
+#if defined(CONFIG_MODEM_INFO_CACHE)
+AT_MONITOR(modem_info_xsim_mon, "%XSIM", modem_info_xsim_handler);
+AT_MONITOR(modem_info_cereg_mon, "+CEREG", modem_info_cereg_handler);
+
+NRF_MODEM_LIB_ON_INIT(modem_info_init_hook, on_modem_init, NULL);
+
+static char cache_values[CACHE_ID_COUNT][MODEM_INFO_MAX_RESPONSE_SIZE];
+static atomic_t cache_valid;
+#endif /* CONFIG_MODEM_INFO_CACHE */
+
+static int cache_id_get(enum modem_info info)
+{
+	switch (info) {
+	case MODEM_INFO_FW_VERSION:
+		return CACHE_ID_FW_VERSION;
+	case MODEM_INFO_IMEI:
+		return CACHE_ID_IMEI;
+	case MODEM_INFO_SUP_BAND:
+		return CACHE_ID_SUP_BAND;
+	case MODEM_INFO_ICCID:
+		return CACHE_ID_ICCID;
+	case MODEM_INFO_IMSI:
+		return CACHE_ID_IMSI;
+	default:
+		return -ENOENT;
+	}
+}
+
+/* Copy a cached value to buf. Returns the length of the value,
+ * or -ENOENT if the value is not cached.
+ */
+static int cache_get(int id, char *buf, size_t buf_size)
+{
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	size_t len;
+
+	if ((id < 0) || !atomic_test_bit(&cache_valid, id)) {
+		return -ENOENT;
+	}
+
+	len = strlen(cache_values[id]);
+	if (len >= buf_size) {
+		return -EMSGSIZE;
+	}
+
+	memcpy(buf, cache_values[id], len + 1);
+
+	return len;
+#else
+	return -ENOENT;
+#endif
+}
+
+static void cache_set(int id, const char *value)
+{
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	if ((id < 0) || (strlen(value) >= sizeof(cache_values[id]))) {
+		return;
+	}
+
+	strcpy(cache_values[id], value);
+	atomic_set_bit(&cache_valid, id);
+#endif
+}
+
+static void cache_invalidate(atomic_val_t mask)
+{
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	(void)atomic_and(&cache_valid, ~mask);
+#endif
+}
+
+#if defined(CONFIG_MODEM_INFO_CACHE)
+static void modem_info_xsim_handler(const char *notif)
+{
+	LOG_DBG("UICC state changed, SIM information is read again");
+
+	cache_invalidate(CACHE_SIM_MASK);
+}
+
+static void modem_info_cereg_handler(const char *notif)
+{
+	/* +CEREG: <stat>[,...] */
+	const char *stat = strchr(notif, ':');
+
+	if (stat && (strtol(stat + 1, NULL, 10) == CEREG_STAT_UICC_FAIL)) {
+		cache_invalidate(CACHE_SIM_MASK);
+	}
+}
+
+static void on_modem_init(int ret, void *ctx)
+{
+	/* The modem firmware may have been updated. */
+	cache_invalidate(CACHE_ALL_MASK);
+
+	if (ret != 0) {
+		return;
+	}
+
+	if (nrf_modem_at_printf(AT_CMD_XSIM_SUBSCRIBE) != 0) {
+		LOG_WRN("Can't subscribe to %%XSIM notifications");
+	}
+}
+#endif /* CONFIG_MODEM_INFO_CACHE */
+
 static void flip_iccid_string(char *buf)
 {
 	uint8_t current_char;
@@ -600,12 +728,21 @@ parse_line:
 	return strlen(out_buf);
 }
 
-int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size)
+/* Information types whose value is parsed from the whole AT command response, instead of
+ * the parameters in m_param_list. Parsing them modifies the response.
+ */
+static bool rsp_parsed_separately(enum modem_info info)
+{
+	return (info == MODEM_INFO_SUP_BAND) || (info == MODEM_INFO_IP_ADDRESS);
+}
+
+/* Get the value of an information type from an AT command response as a string. Unless the
+ * type is parsed separately, the response must already be parsed into m_param_list.
+ */
+static int rsp_string_get(enum modem_info info, char *rsp, char *buf, const size_t buf_size)
 {
 	int err;
-	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
 	uint16_t param_value;
-	char *str_end = recv_buf;
 	/* tracks length of buf when parsing multiple IP addresses */
 	size_t out_buf_len = 0;
 	/* return value indicating length of the string written to buf */
@@ -615,26 +752,16 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 	 */
 	size_t accumulated_len = 0;
 
-	if ((buf == NULL) || (buf_size == 0)) {
-		return -EINVAL;
-	}
-
 	buf[0] = '\0';
 
-	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE, modem_data[info]->cmd);
-	if (err != 0) {
-		return -EIO;
-	}
-
 	/* modem_info does not yet support array objects, so here we handle
 	 * the supported bands independently as a string
 	 */
 	if (info == MODEM_INFO_SUP_BAND) {
 
 		/* The list of supported bands is contained in parenthesis */
-		char *str_begin = strchr(recv_buf, '(');
-
-		str_end = strchr(recv_buf, ')');
+		char *str_begin = strchr(rsp, '(');
+		char *str_end = strchr(rsp, ')');
 
 		if (!str_begin || !str_end) {
 			return -EFAULT;
@@ -649,17 +776,12 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 		}
 
 		strcpy(buf, str_begin);
+		cache_set(cache_id_get(info), buf);
 		return len;
 	}
 
-	err = modem_info_parse(modem_data[info], recv_buf);
-	if (err) {
-		LOG_ERR("Unable to parse data: %d", err);
-		return err;
-	}
-
 	if (info == MODEM_INFO_IP_ADDRESS) {
-		return parse_ip_addresses(buf, buf_size, recv_buf);
+		return parse_ip_addresses(buf, buf_size, rsp);
 	}
 
 	if (modem_data[info]->data_type == AT_PARAM_TYPE_NUM_INT) {
@@ -703,7 +825,189 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 		}
 	}
 
-	return len <= 0 ? -ENOTSUP : len;
+	if (len <= 0) {
+		return -ENOTSUP;
+	}
+
+	cache_set(cache_id_get(info), buf);
+
+	return len;
+}
+
+int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size)
+{
+	int err;
+	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
+
+	if ((buf == NULL) || (buf_size == 0)) {
+		return -EINVAL;
+	}
+
+	buf[0] = '\0';
+
+	err = cache_get(cache_id_get(info), buf, buf_size);
+	if (err != -ENOENT) {
+		return err;
+	}
+
+	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE, modem_data[info]->cmd);
+	if (err != 0) {
+		return -EIO;
+	}
+
+	if (!rsp_parsed_separately(info)) {
+		err = modem_info_parse(modem_data[info], recv_buf);
+		if (err) {
+			LOG_ERR("Unable to parse data: %d", err);
+			return err;
+		}
+	}
+
+	return rsp_string_get(info, recv_buf, buf, buf_size);
+}
+
+/* Fill a parameter from an AT command response. Unless the information type is parsed
+ * separately, the response must already be parsed into m_param_list.
+ */
+static int lte_param_from_rsp(struct lte_param *param, char *rsp)
+{
+	int ret;
+
+	if (modem_data[param->type]->data_type == AT_PARAM_TYPE_NUM_INT) {
+		return at_params_unsigned_short_get(&m_param_list,
+						    modem_data[param->type]->param_index,
+						    &param->value);
+	}
+
+	ret = rsp_string_get(param->type, rsp, param->value_string,
+			     sizeof(param->value_string));
+
+	return (ret < 0) ? ret : 0;
+}
+
+/* Get the largest number of response parameters needed by the information types
+ * that are read with the given AT command.
+ */
+static uint8_t cmd_param_count_get(struct lte_param *const *params, size_t count,
+				   const char *cmd)
+{
+	uint8_t param_count = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		const struct modem_info_data *data = modem_data[params[i]->type];
+
+		if (strcmp(data->cmd, cmd) == 0) {
+			param_count = MAX(param_count, data->param_count);
+		}
+	}
+
+	return param_count;
+}
+
+/* Obtain all parameters that are read with the same AT command as params[first]. The AT
+ * command is sent at most once, and its response is parsed once.
+ */
+static int cmd_params_get(struct lte_param *const *params, size_t count, size_t first)
+{
+	int err;
+	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
+	const char *cmd = modem_data[params[first]->type]->cmd;
+	bool rsp_read = false;
+	bool rsp_parsed = false;
+
+	/* Information types that are parsed separately modify the response,
+	 * so they are handled in a second pass.
+	 */
+	for (int pass = 0; pass < 2; pass++) {
+		for (size_t i = first; i < count; i++) {
+			struct lte_param *param = params[i];
+			bool separate = rsp_parsed_separately(param->type);
+
+			if ((separate != (pass == 1)) ||
+			    (strcmp(modem_data[param->type]->cmd, cmd) != 0)) {
+				continue;
+			}
+
+			if (cache_get(cache_id_get(param->type), param->value_string,
+				      sizeof(param->value_string)) >= 0) {
+				continue;
+			}
+
+			if (!rsp_read) {
+				err = nrf_modem_at_cmd(recv_buf, sizeof(recv_buf), cmd);
+				if (err != 0) {
+					LOG_ERR("Link data not obtained: %d %d", param->type, err);
+					return -EIO;
+				}
+
+				rsp_read = true;
+			}
+
+			if (!separate && !rsp_parsed) {
+				struct modem_info_data parse_data = *modem_data[param->type];
+
+				parse_data.param_count = cmd_param_count_get(params, count, cmd);
+
+				err = modem_info_parse(&parse_data, recv_buf);
+				if (err) {
+					LOG_ERR("Unable to parse data: %d", err);
+					return err;
+				}
+
+				rsp_parsed = true;
+			}
+
+			err = lte_param_from_rsp(param, recv_buf);
+			if (err) {
+				LOG_ERR("Link data not obtained: %d %d", param->type, err);
+				return err;
+			}
+
+			/* The response has been modified, read it again if needed. */
+			if (separate) {
+				rsp_read = false;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int modem_info_params_batch_get(struct lte_param *const *params, size_t count)
+{
+	int err;
+
+	if (params == NULL) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if ((params[i] == NULL) || (params[i]->type < 0) ||
+		    (params[i]->type >= MODEM_INFO_COUNT)) {
+			return -EINVAL;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const char *cmd = modem_data[params[i]->type]->cmd;
+		bool done = false;
+
+		/* Parameters of an AT command are all obtained with its first parameter. */
+		for (size_t j = 0; (j < i) && !done; j++) {
+			done = (strcmp(modem_data[params[j]->type]->cmd, cmd) == 0);
+		}
+
+		if (done) {
+			continue;
+		}
+
+		err = cmd_params_get(params, count, i);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
 }
 
 static void modem_info_rsrp_subscribe_handler(const char *notif)
@@ -818,6 +1122,10 @@ int modem_info_get_svn(char *buf, size_t buf_size)
 		return -EINVAL;
 	}
 
+	if (cache_get(CACHE_ID_SVN, buf, buf_size) >= 0) {
+		return 0;
+	}
+
 	ret = nrf_modem_at_scanf("AT+CGSN=3",
 				 "+CGSN: \"%" STRINGIFY(SVN_SIZE) "[^\"]",
 				 buf);
@@ -826,6 +1134,8 @@ int modem_info_get_svn(char *buf, size_t buf_size)
 		LOG_ERR("Could not get SVN, error: %d", ret);
 		return map_nrf_modem_at_scanf_error(ret);
 	}
+
+	cache_set(CACHE_ID_SVN, buf);
 	return 0;
 }
 
@@ -892,6 +1202,8 @@ int modem_info_init(void)
 {
 	int err = 0;
 
+	cache_invalidate(CACHE_ALL_MASK);
+
 	if (m_param_list.params == NULL) {
 		/* Init at_cmd_parser storage module */
 		err = at_params_list_init(&m_param_list,
@@ -5,9 +5,14 @@
  */
 
 #include <zephyr/kernel.h>
-#include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/random/rand32.h>
 #include <qos.h>
 
+#if defined(CONFIG_QOS_SPILL_QUEUE)
+#include "qos_spill.h"
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(qos, CONFIG_QOS_LOG_LEVEL);
 
@@ -18,25 +23,85 @@ LOG_MODULE_REGISTER(qos, CONFIG_QOS_LOG_LEVEL);
 #define STATIC static
 #endif
 
-/* Structure used to keep track of pending messages. Used in combination with a linked list. */
+/* Pending messages are kept in a hierarchical timing wheel with a resolution of one second.
+ * Level 0 holds messages that are due within the next QOS_WHEEL_SLOTS ticks, one slot per
+ * tick. Level 1 holds messages that are due later, one slot per QOS_WHEEL_SLOTS ticks, and
+ * is cascaded into level 0 every time level 0 wraps around.
+ */
+#define QOS_WHEEL_LEVELS 2
+#define QOS_WHEEL_SLOTS 32
+#define QOS_WHEEL_SLOT_MASK (QOS_WHEEL_SLOTS - 1)
+#define QOS_WHEEL_LEVEL_SHIFT 5
+#define QOS_WHEEL_TIMEOUT_MAX ((QOS_WHEEL_SLOTS - 1) * QOS_WHEEL_SLOTS - 1)
+
+BUILD_ASSERT(BIT(QOS_WHEEL_LEVEL_SHIFT) == QOS_WHEEL_SLOTS);
+BUILD_ASSERT(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_MAX_SECONDS <= QOS_WHEEL_TIMEOUT_MAX);
+
+/* Open addressing table used to look up pending messages by ID. Sized to stay at most half
+ * full, so that probe sequences are short.
+ */
+#define QOS_ID_TABLE_SIZE (2 * CONFIG_QOS_PENDING_MESSAGES_MAX)
+
+/* Number of IDs handed out by qos_message_id_get_next() before the count is reset. */
+#define QOS_MESSAGE_ID_RANGE (UINT16_MAX - QOS_MESSAGE_ID_BASE)
+
+/* Structure used to keep track of pending messages. */
 struct qos_metadata {
-	/* Mandatory variable used to construct a linked list. */
-	sys_snode_t header;
+	/* Node in the list of pending messages, or in the list of free entries. */
+	sys_dnode_t header;
+
+	/* Node in a timing wheel slot. */
+	sys_dnode_t timer_node;
+
+	/* Timing wheel tick when the message is notified next. */
+	uint32_t deadline;
 
-	/* Message associated with each node in the linked list. */
+	/* Timing wheel level and slot that the message is in. */
+	uint8_t level;
+	uint8_t slot;
+
+	/* Message associated with the entry. */
 	struct qos_data message;
 };
 
+/* Structure containing the timing wheel. */
+struct qos_wheel {
+	/* Lists of messages that are due in each slot. */
+	sys_dlist_t slots[QOS_WHEEL_LEVELS][QOS_WHEEL_SLOTS];
+
+	/* Bitmask of non-empty slots for each level. */
+	uint32_t occupied[QOS_WHEEL_LEVELS];
+
+	/* Last tick that has been processed. */
+	uint32_t tick;
+};
+
 /* Structure containing internal variables in the library.  */
 STATIC struct ctx {
 	/* Library event handler. Used in callbacks to the caller. */
 	qos_evt_handler_t app_evt_handler;
 
-	/* Internal array of pending messages. Used in combination with linked list. */
+	/* Internal array of pending messages. */
 	struct qos_metadata list_internal[CONFIG_QOS_PENDING_MESSAGES_MAX];
 
-	/* Linked list used to keep track of pending messages. */
-	sys_slist_t pending_list;
+	/* List of pending messages, in the order that they were added. */
+	sys_dlist_t pending_list;
+
+	/* List of unused entries in list_internal. */
+	sys_dlist_t free_list;
+
+	/* Index + 1 of the entries in list_internal, hashed by message ID. 0 marks an empty
+	 * table slot.
+	 */
+	uint16_t id_table[QOS_ID_TABLE_SIZE];
+
+	/* Timing wheel with the deadlines of the pending messages. */
+	struct qos_wheel wheel;
+
+#if defined(CONFIG_QOS_MESSAGE_TIMER_EXPIRED_BATCH)
+	/* Messages notified in a single QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH event. */
+	struct qos_data batch[CONFIG_QOS_PENDING_MESSAGES_MAX];
+#endif
 
 	/* Variable used to prevent multiple library initializations. */
 	bool initialized;
@@ -64,102 +129,508 @@ static void notify_event(struct qos_evt *evt)
 	}
 }
 
-STATIC void timeout_handler_work_fn(struct k_work *work)
+static uint32_t tick_now(void)
+{
+	return (uint32_t)(k_uptime_get() / MSEC_PER_SEC);
+}
+
+/* Timeout before the next notification of a message, in ticks. Doubles for every time the
+ * message has been notified, and is randomized by CONFIG_QOS_MESSAGE_NOTIFY_JITTER_PERCENT.
+ */
+STATIC uint32_t backoff_get(uint16_t notified_count)
+{
+	uint32_t timeout = CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS;
+	uint32_t jitter;
+
+	for (uint16_t i = 1; (i < notified_count) &&
+			     (timeout < CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_MAX_SECONDS); i++) {
+		timeout *= 2;
+	}
+
+	timeout = MIN(timeout, CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_MAX_SECONDS);
+	jitter = timeout * CONFIG_QOS_MESSAGE_NOTIFY_JITTER_PERCENT / 100;
+
+	if (jitter > 0) {
+		timeout = timeout - jitter + (sys_rand32_get() % (2 * jitter + 1));
+	}
+
+	return CLAMP(timeout, 1, QOS_WHEEL_TIMEOUT_MAX);
+}
+
+static void wheel_insert(struct qos_metadata *node, uint32_t deadline)
+{
+	struct qos_wheel *wheel = &ctx.wheel;
+	uint32_t timeout = deadline - wheel->tick;
+
+	/* Messages that are already due are notified at the next tick. */
+	if (((int32_t)timeout <= 0)) {
+		deadline = wheel->tick + 1;
+	} else if (timeout > QOS_WHEEL_TIMEOUT_MAX) {
+		deadline = wheel->tick + QOS_WHEEL_TIMEOUT_MAX;
+	}
+
+	node->deadline = deadline;
+
+	if ((deadline - wheel->tick) < QOS_WHEEL_SLOTS) {
+		node->level = 0;
+		node->slot = deadline & QOS_WHEEL_SLOT_MASK;
+	} else {
+		node->level = 1;
+		node->slot = (deadline >> QOS_WHEEL_LEVEL_SHIFT) & QOS_WHEEL_SLOT_MASK;
+	}
+
+	sys_dlist_append(&wheel->slots[node->level][node->slot], &node->timer_node);
+	wheel->occupied[node->level] |= BIT(node->slot);
+}
+
+/* Remove a message from the timing wheel, or from the list of expired messages. */
+static void wheel_remove(struct qos_metadata *node)
+{
+	struct qos_wheel *wheel = &ctx.wheel;
+
+	if (!sys_dnode_is_linked(&node->timer_node)) {
+		return;
+	}
+
+	sys_dlist_remove(&node->timer_node);
+
+	if (sys_dlist_is_empty(&wheel->slots[node->level][node->slot])) {
+		wheel->occupied[node->level] &= ~BIT(node->slot);
+	}
+}
+
+/* Move all messages that are due at the given tick to the expired list. */
+static void wheel_tick_process(uint32_t tick, sys_dlist_t *expired)
 {
+	struct qos_wheel *wheel = &ctx.wheel;
 	struct qos_metadata *node = NULL, *next_node = NULL;
+	uint8_t slot;
+
+	if ((tick & QOS_WHEEL_SLOT_MASK) == 0) {
+		slot = (tick >> QOS_WHEEL_LEVEL_SHIFT) & QOS_WHEEL_SLOT_MASK;
+
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&wheel->slots[1][slot], node, next_node,
+						  timer_node) {
+			wheel_remove(node);
+
+			/* Due within this rotation of level 0, possibly at this very tick. */
+			node->level = 0;
+			node->slot = node->deadline & QOS_WHEEL_SLOT_MASK;
+			sys_dlist_append(&wheel->slots[0][node->slot], &node->timer_node);
+			wheel->occupied[0] |= BIT(node->slot);
+		}
+	}
+
+	slot = tick & QOS_WHEEL_SLOT_MASK;
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&wheel->slots[0][slot], node, next_node, timer_node) {
+		wheel_remove(node);
+		sys_dlist_append(expired, &node->timer_node);
+	}
+}
+
+/* Advance the timing wheel up to and including the given tick. */
+static void wheel_advance(uint32_t now, sys_dlist_t *expired)
+{
+	struct qos_wheel *wheel = &ctx.wheel;
+
+	while ((int32_t)(now - wheel->tick) > 0) {
+		if ((wheel->occupied[0] == 0) && (wheel->occupied[1] == 0)) {
+			wheel->tick = now;
+			break;
+		}
+
+		/* Skip to the next cascade of level 1 if level 0 is empty. */
+		if ((wheel->occupied[0] == 0) && ((wheel->tick & QOS_WHEEL_SLOT_MASK) != 0)) {
+			uint32_t skip = QOS_WHEEL_SLOTS - (wheel->tick & QOS_WHEEL_SLOT_MASK) - 1;
+
+			if ((int32_t)(now - wheel->tick) <= skip) {
+				wheel->tick = now;
+				break;
+			}
+
+			wheel->tick += skip;
+		}
+
+		wheel->tick++;
+		wheel_tick_process(wheel->tick, expired);
+	}
+}
+
+/* Get the next tick at which the timing wheel must be processed. */
+static bool wheel_next_tick_get(uint32_t *next)
+{
+	struct qos_wheel *wheel = &ctx.wheel;
+	uint32_t cascade = (wheel->tick | QOS_WHEEL_SLOT_MASK) + 1;
+
+	if ((wheel->occupied[0] == 0) && (wheel->occupied[1] == 0)) {
+		return false;
+	}
+
+	/* Messages in level 1 are not due before they are cascaded into level 0. */
+	*next = cascade;
+
+	if (wheel->occupied[0] != 0) {
+		uint32_t start = (wheel->tick + 1) & QOS_WHEEL_SLOT_MASK;
+		uint32_t occupied = wheel->occupied[0];
+		uint32_t first;
+
+		/* Rotate the bitmask so that bit 0 corresponds to the next tick. */
+		if (start != 0) {
+			occupied = (occupied >> start) | (occupied << (QOS_WHEEL_SLOTS - start));
+		}
+
+		first = wheel->tick + find_lsb_set(occupied);
+
+		if ((wheel->occupied[1] == 0) || ((int32_t)(first - cascade) < 0)) {
+			*next = first;
+		}
+	}
+
+	return true;
+}
+
+static void timer_schedule(void)
+{
+	uint32_t next;
+	int64_t delay_ms;
+
+	if (!wheel_next_tick_get(&next)) {
+		k_work_cancel_delayable(&ctx.timeout_handler_work);
+		return;
+	}
+
+	delay_ms = (int64_t)(int32_t)(next - tick_now()) * MSEC_PER_SEC -
+		   (k_uptime_get() % MSEC_PER_SEC);
+
+	k_work_reschedule(&ctx.timeout_handler_work, K_MSEC(MAX(delay_ms, 0)));
+}
+
+static size_t id_hash(uint32_t id)
+{
+	return id % QOS_ID_TABLE_SIZE;
+}
+
+static void id_table_add(struct qos_metadata *node)
+{
+	size_t pos = id_hash(node->message.id);
+
+	while (ctx.id_table[pos] != 0) {
+		pos = (pos + 1) % QOS_ID_TABLE_SIZE;
+	}
+
+	ctx.id_table[pos] = (node - ctx.list_internal) + 1;
+}
+
+static struct qos_metadata *id_table_find(uint32_t id)
+{
+	size_t pos = id_hash(id);
+
+	while (ctx.id_table[pos] != 0) {
+		struct qos_metadata *node = &ctx.list_internal[ctx.id_table[pos] - 1];
+
+		if (node->message.id == id) {
+			return node;
+		}
+
+		pos = (pos + 1) % QOS_ID_TABLE_SIZE;
+	}
+
+	return NULL;
+}
+
+static void id_table_remove(struct qos_metadata *node)
+{
+	uint16_t value = (node - ctx.list_internal) + 1;
+	size_t pos = id_hash(node->message.id);
+	size_t next;
+
+	while (ctx.id_table[pos] != value) {
+		pos = (pos + 1) % QOS_ID_TABLE_SIZE;
+	}
+
+	/* Shift the following entries of the probe sequence back to keep it unbroken. */
+	next = (pos + 1) % QOS_ID_TABLE_SIZE;
+
+	while (ctx.id_table[next] != 0) {
+		size_t home = id_hash(ctx.list_internal[ctx.id_table[next] - 1].message.id);
+		size_t dist_home = (next + QOS_ID_TABLE_SIZE - home) % QOS_ID_TABLE_SIZE;
+		size_t dist_pos = (next + QOS_ID_TABLE_SIZE - pos) % QOS_ID_TABLE_SIZE;
+
+		if (dist_home >= dist_pos) {
+			ctx.id_table[pos] = ctx.id_table[next];
+			pos = next;
+		}
+
+		next = (next + 1) % QOS_ID_TABLE_SIZE;
+	}
+
+	ctx.id_table[pos] = 0;
+}
+
+/* @brief Function that appends a message to the internal list of pending messages.
+ *
+ * @returns Pointer to the list entry that the message was added to, or NULL if the internal
+ *	    list is full.
+ */
+static struct qos_metadata *list_append(struct qos_data *message)
+{
+	sys_dnode_t *free_node = sys_dlist_get(&ctx.free_list);
+	struct qos_metadata *node;
+
+	if (free_node == NULL) {
+		LOG_ERR("No available entries in pending message list");
+		return NULL;
+	}
+
+	node = CONTAINER_OF(free_node, struct qos_metadata, header);
+	node->message = *message;
+
+	sys_dlist_append(&ctx.pending_list, &node->header);
+	id_table_add(node);
+
+	return node;
+}
+
+/* Remove a message from the internal list and notify it as removed. */
+static void list_node_remove(struct qos_metadata *node)
+{
 	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST
+		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
+		.message = node->message,
 	};
 
-	k_mutex_lock(&ctx_lock, K_FOREVER);
+	wheel_remove(node);
+	id_table_remove(node);
+	sys_dlist_remove(&node->header);
 
-	/* Remove all messages where the notified_count equals or exceeds
-	 * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX
-	 */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
-		if (node->message.notified_count >= CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) {
-			LOG_DBG("Notified count for message ID: %d exceeds the maximum allowed "
-				"value, remove message from pending list.", node->message.id);
-			evt.message = node->message;
-			notify_event(&evt);
-			memset(&node->message, 0, sizeof(struct qos_data));
-			sys_slist_find_and_remove(&ctx.pending_list, &node->header);
-		}
+	memset(&node->message, 0, sizeof(struct qos_data));
+	sys_dlist_append(&ctx.free_list, &node->header);
+
+	notify_event(&evt);
+}
+
+static int list_remove(uint32_t id)
+{
+	struct qos_metadata *node = id_table_find(id);
+
+	if (node == NULL) {
+		return -ENODATA;
+	}
+
+	list_node_remove(node);
+	return 0;
+}
+
+/* Add a message that requires acknowledgment to the internal list and notify it as new. */
+static int list_message_add(struct qos_data *message)
+{
+	struct qos_metadata *node;
+	struct qos_evt evt = {
+		.type = QOS_EVT_MESSAGE_NEW
 	};
 
-	/* Don't shedule a new work if the pending list is empty. */
-	if (sys_slist_is_empty(&ctx.pending_list)) {
-		LOG_DBG("QoS list is empty, don't reschedule work");
-		goto exit;
+	node = list_append(message);
+	if (node == NULL) {
+		return -ENOMEM;
+	}
+
+	/* The timing wheel is only advanced while it holds messages. */
+	if ((ctx.wheel.occupied[0] == 0) && (ctx.wheel.occupied[1] == 0)) {
+		ctx.wheel.tick = tick_now();
 	}
 
-	/* Notify all remaining entries in the list. */
-	evt.type = QOS_EVT_MESSAGE_TIMER_EXPIRED;
+	/* Increment notified count before the callback. */
+	node->message.notified_count++;
+	wheel_insert(node, tick_now() + backoff_get(node->message.notified_count));
+
+	evt.message = node->message;
+	notify_event(&evt);
+
+	return 0;
+}
+
+/* Notify a list of messages with the QOS_EVT_MESSAGE_TIMER_EXPIRED event, or in a single
+ * QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH event, and schedule their next notification relative to
+ * the current tick of the timing wheel. The list is linked through the timer_node of the
+ * messages, which is reused when the messages are inserted in the timing wheel again.
+ */
+static void expired_notify(sys_dlist_t *expired)
+{
+	struct qos_metadata *node = NULL, *next_node = NULL;
+	struct qos_evt evt = {
+		.type = QOS_EVT_MESSAGE_TIMER_EXPIRED,
+	};
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(expired, node, next_node, timer_node) {
+		sys_dlist_remove(&node->timer_node);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		node->message.notified_count++;
+		wheel_insert(node, ctx.wheel.tick + backoff_get(node->message.notified_count));
+
+#if defined(CONFIG_QOS_MESSAGE_TIMER_EXPIRED_BATCH)
+		ctx.batch[evt.batch.count++] = node->message;
+#else
 		evt.message = node->message;
 		notify_event(&evt);
-	};
+#endif
+	}
 
-	k_work_reschedule(&ctx.timeout_handler_work,
-			  K_SECONDS(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS));
-exit:
-	k_mutex_unlock(&ctx_lock);
+#if defined(CONFIG_QOS_MESSAGE_TIMER_EXPIRED_BATCH)
+	if (evt.batch.count > 0) {
+		evt.type = QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH;
+		evt.batch.messages = ctx.batch;
+		notify_event(&evt);
+	}
+#endif
 }
 
-/* @brief Function that appends a message to the internal list of pending messages.
- *
- * @returns A positive value indicating the index of the internal list that the message was
- *	    added to. Otherwise a negative value indicating the reason of failure.
- *
- * @retval -ENOMEM if the internal list is full.
+static uint16_t message_id_following(uint16_t id)
+{
+	return (id + 1 == UINT16_MAX) ? QOS_MESSAGE_ID_BASE : id + 1;
+}
+
+static bool message_id_is_generated(uint16_t id)
+{
+	return (id >= QOS_MESSAGE_ID_BASE) && (id < UINT16_MAX);
+}
+
+/* Check if the ID is held by a pending or stored message. */
+static bool message_id_is_used(uint16_t id)
+{
+	if (id_table_find(id) != NULL) {
+		return true;
+	}
+
+#if defined(CONFIG_QOS_SPILL_QUEUE)
+	for (size_t i = 0; i < qos_spill_count(); i++) {
+		if (qos_spill_id_get(i) == id) {
+			return true;
+		}
+	}
+#endif /* CONFIG_QOS_SPILL_QUEUE */
+
+	return false;
+}
+
+#if defined(CONFIG_QOS_SPILL_QUEUE)
+/* Check if ID a was handed out after ID b, taking the reset of the count into account. */
+static bool message_id_is_newer(uint16_t a, uint16_t b)
+{
+	uint16_t distance = (a + QOS_MESSAGE_ID_RANGE - b) % QOS_MESSAGE_ID_RANGE;
+
+	return (distance != 0) && (distance < QOS_MESSAGE_ID_RANGE / 2);
+}
+
+/* Continue the message ID count after the newest stored message, so that new messages do
+ * not get the IDs of the messages restored after a reboot.
  */
-static int list_append(struct qos_data *message)
+static void message_id_next_restore(void)
 {
-	/* Mark the initial list index as invalid. */
-	int index_next = -1;
+	bool found = false;
+	uint16_t newest = 0;
 
-	/* Find the next available list index. */
-	for (int i = 0; i < ARRAY_SIZE(ctx.list_internal); i++) {
-		if ((ctx.list_internal[i].message.notified_count == 0) &&
-		    (ctx.list_internal[i].message.data.buf == NULL)) {
-			index_next = i;
-			break;
+	for (size_t i = 0; i < qos_spill_count(); i++) {
+		uint16_t id = qos_spill_id_get(i);
+
+		if (!message_id_is_generated(id)) {
+			continue;
+		}
+
+		if (!found || message_id_is_newer(id, newest)) {
+			newest = id;
+			found = true;
 		}
 	}
 
-	if (index_next == -1) {
-		LOG_ERR("No available entries in pending message list");
-		return -ENOMEM;
+	if (found) {
+		ctx.message_id_next = message_id_following(newest);
 	}
+}
+#endif /* CONFIG_QOS_SPILL_QUEUE */
 
-	ctx.list_internal[index_next].message = *message;
+/* Add messages stored in flash back to the internal list as long as there is room. */
+static void spill_restore(void)
+{
+#if defined(CONFIG_QOS_SPILL_QUEUE)
+	struct qos_data message;
+
+	while (!sys_dlist_is_empty(&ctx.free_list) && (qos_spill_count() > 0)) {
+		if (qos_spill_pop(&message)) {
+			break;
+		}
 
-	sys_slist_append(&ctx.pending_list, &ctx.list_internal[index_next].header);
-	return index_next;
+		LOG_DBG("Restoring stored message, ID: %d", message.id);
+
+		if (list_message_add(&message)) {
+			break;
+		}
+	}
+#endif /* CONFIG_QOS_SPILL_QUEUE */
 }
 
-static int list_remove(uint32_t id)
+/* Store a message that does not fit in the internal list in flash. */
+static int spill_store(struct qos_data *message)
 {
-	struct qos_metadata *node = NULL, *next_node = NULL, *node_prev = NULL;
+#if defined(CONFIG_QOS_SPILL_QUEUE)
 	struct qos_evt evt = {
 		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
+		.message = *message,
 	};
+	int err = qos_spill_push(message);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
-		if (node->message.id == id) {
-			evt.message = node->message;
-			notify_event(&evt);
-			memset(&node->message, 0, sizeof(struct qos_data));
-			sys_slist_remove(&ctx.pending_list, &node_prev->header, &node->header);
-			return 0;
+	if (err) {
+		LOG_WRN("Failed storing message in flash, error: %d", err);
+		return err;
+	}
+
+	LOG_DBG("Message stored in flash, ID: %d", message->id);
+
+	/* The payload has been copied and can be freed. */
+	notify_event(&evt);
+	return 0;
+#else
+	return -ENOTSUP;
+#endif /* CONFIG_QOS_SPILL_QUEUE */
+}
+
+/* Process the messages that are due. Messages that have been notified
+ * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX times are removed, the rest are notified again.
+ */
+STATIC void timer_process(uint32_t now)
+{
+	struct qos_metadata *node = NULL, *next_node = NULL;
+	sys_dlist_t expired;
+
+	sys_dlist_init(&expired);
+	wheel_advance(now, &expired);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&expired, node, next_node, timer_node) {
+		if (node->message.notified_count >= CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) {
+			LOG_DBG("Notified count for message ID: %d exceeds the maximum allowed "
+				"value, remove message from pending list.", node->message.id);
+			list_node_remove(node);
 		}
+	}
 
-		node_prev = node;
-	};
+	expired_notify(&expired);
+}
+
+STATIC void timeout_handler_work_fn(struct k_work *work)
+{
+	k_mutex_lock(&ctx_lock, K_FOREVER);
+
+	timer_process(tick_now());
+
+	/* Don't schedule a new work if the pending list is empty. */
+	if (sys_dlist_is_empty(&ctx.pending_list)) {
+		LOG_DBG("QoS list is empty, don't reschedule work");
+		goto exit;
+	}
 
-	return -ENODATA;
+	timer_schedule();
+exit:
+	k_mutex_unlock(&ctx_lock);
 }
 
 /* Public API functions */
@@ -185,10 +656,44 @@ int qos_init(qos_evt_handler_t evt_handler)
 	LOG_DBG("Registering handler %p", evt_handler);
 	ctx.app_evt_handler = evt_handler;
 
-	/* Initializing linked list and delayed work. */
-	sys_slist_init(&ctx.pending_list);
+	/* Initializing lists, timing wheel and delayed work. */
+	sys_dlist_init(&ctx.pending_list);
+	sys_dlist_init(&ctx.free_list);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctx.list_internal); i++) {
+		sys_dnode_init(&ctx.list_internal[i].header);
+		sys_dnode_init(&ctx.list_internal[i].timer_node);
+		sys_dlist_append(&ctx.free_list, &ctx.list_internal[i].header);
+	}
+
+	memset(ctx.id_table, 0, sizeof(ctx.id_table));
+
+	for (size_t i = 0; i < QOS_WHEEL_LEVELS; i++) {
+		for (size_t j = 0; j < QOS_WHEEL_SLOTS; j++) {
+			sys_dlist_init(&ctx.wheel.slots[i][j]);
+		}
+
+		ctx.wheel.occupied[i] = 0;
+	}
+
+	ctx.wheel.tick = tick_now();
+
 	k_work_init_delayable(&ctx.timeout_handler_work, timeout_handler_work_fn);
 
+#if defined(CONFIG_QOS_SPILL_QUEUE)
+	/* The library can be used without the stored messages. */
+	if (qos_spill_init()) {
+		LOG_ERR("Stored messages are not available");
+	}
+
+	message_id_next_restore();
+	spill_restore();
+
+	if (!sys_dlist_is_empty(&ctx.pending_list)) {
+		timer_schedule();
+	}
+#endif /* CONFIG_QOS_SPILL_QUEUE */
+
 exit:
 	k_mutex_unlock(&ctx_lock);
 	return err;
@@ -213,7 +718,14 @@ int qos_message_add(struct qos_data *message)
 
 	/* Only ACK_REQUIRED messages are added to the internal list. */
 	if (qos_message_has_flag(message, QOS_FLAG_RELIABILITY_ACK_REQUIRED)) {
-		ret = list_append(message);
+		ret = list_message_add(message);
+		if ((ret == -ENOMEM) && IS_ENABLED(CONFIG_QOS_SPILL_QUEUE)) {
+			ret = spill_store(message);
+			if (ret == 0) {
+				goto exit;
+			}
+		}
+
 		if (ret < 0) {
 			LOG_WRN("No list entries available, error: %d", ret);
 			evt.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST;
@@ -221,11 +733,6 @@ int qos_message_add(struct qos_data *message)
 			err = -ENOMEM;
 			goto exit;
 		}
-
-		/* Increment notified count before the callback. */
-		ctx.list_internal[ret].message.notified_count++;
-		evt.message = ctx.list_internal[ret].message;
-		notify_event(&evt);
 	} else {
 
 		/* If the message does not carry the ACK_REQUIRED flag, its notified as a new
@@ -237,13 +744,11 @@ int qos_message_add(struct qos_data *message)
 		notify_event(&evt);
 	}
 
-	/* Start the internal timer if it is not running when there are messages in the
-	 * pending list.
+	/* Start the internal timer, or bring it forward to the deadline of the new message,
+	 * when there are messages in the pending list.
 	 */
-	if (!k_work_delayable_is_pending(&ctx.timeout_handler_work) &&
-	    !sys_slist_is_empty(&ctx.pending_list)) {
-		k_work_reschedule(&ctx.timeout_handler_work,
-				  K_SECONDS(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS));
+	if (!sys_dlist_is_empty(&ctx.pending_list)) {
+		timer_schedule();
 	}
 
 exit:
@@ -263,10 +768,15 @@ int qos_message_remove(uint32_t id)
 		goto exit;
 	}
 
+	/* An acknowledgment means that messages can be sent, give stored messages a chance. */
+	spill_restore();
+
 	/* If the removed message is the last in the pending list, we stop the internal timer. */
-	if (sys_slist_is_empty(&ctx.pending_list)) {
+	if (sys_dlist_is_empty(&ctx.pending_list)) {
 		LOG_DBG("QoS list is empty, cancel ongoing delayed work");
 		k_work_cancel_delayable(&ctx.timeout_handler_work);
+	} else {
+		timer_schedule();
 	}
 
 exit:
@@ -296,11 +806,15 @@ uint16_t qos_message_id_get_next(void)
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	if (ctx.message_id_next == UINT16_MAX) {
-		ctx.message_id_next = QOS_MESSAGE_ID_BASE;
-	}
+	/* Skip the IDs of messages that have not been acknowledged yet. */
+	do {
+		if (!message_id_is_generated(ctx.message_id_next)) {
+			ctx.message_id_next = QOS_MESSAGE_ID_BASE;
+		}
 
-	message_id_temp = ctx.message_id_next++;
+		message_id_temp = ctx.message_id_next;
+		ctx.message_id_next = message_id_following(message_id_temp);
+	} while (message_id_is_used(message_id_temp));
 
 	k_mutex_unlock(&ctx_lock);
 
@@ -310,35 +824,67 @@ uint16_t qos_message_id_get_next(void)
 void qos_message_notify_all(void)
 {
 	struct qos_metadata *node = NULL, *next_node = NULL;
-	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_TIMER_EXPIRED,
+	sys_dlist_t expired;
+
+	k_mutex_lock(&ctx_lock, K_FOREVER);
+
+	spill_restore();
+
+	sys_dlist_init(&expired);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+		wheel_remove(node);
+		sys_dlist_append(&expired, &node->timer_node);
 	};
 
+	/* The timing wheel is empty, the next deadlines are relative to the current time. */
+	ctx.wheel.tick = tick_now();
+	expired_notify(&expired);
+
+	if (!sys_dlist_is_empty(&ctx.pending_list)) {
+		timer_schedule();
+	}
+
+	k_mutex_unlock(&ctx_lock);
+}
+
+int qos_message_spill_all(void)
+{
+#if defined(CONFIG_QOS_SPILL_QUEUE)
+	struct qos_metadata *node = NULL, *next_node = NULL;
+	int err = 0;
+
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
-		node->message.notified_count++;
-		evt.message = node->message;
-		notify_event(&evt);
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+		if (qos_spill_push(&node->message)) {
+			err = -ENOSPC;
+			break;
+		}
+
+		list_node_remove(node);
 	};
 
+	if (sys_dlist_is_empty(&ctx.pending_list)) {
+		k_work_cancel_delayable(&ctx.timeout_handler_work);
+	}
+
 	k_mutex_unlock(&ctx_lock);
+
+	return err;
+#else
+	return -ENOTSUP;
+#endif /* CONFIG_QOS_SPILL_QUEUE */
 }
 
 void qos_message_remove_all(void)
 {
 	struct qos_metadata *node = NULL, *next_node = NULL;
-	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
-	};
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
-		evt.message = node->message;
-		notify_event(&evt);
-		memset(&node->message, 0, sizeof(struct qos_data));
-		sys_slist_remove(&ctx.pending_list, NULL, &node->header);
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+		list_node_remove(node);
 	};
 
 	k_mutex_unlock(&ctx_lock);
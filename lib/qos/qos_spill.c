@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "qos_spill.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(qos, CONFIG_QOS_LOG_LEVEL);
+
+#define SPILL_BASE_KEY "qos/spill"
+#define SPILL_KEY_SIZE sizeof(SPILL_BASE_KEY "/" STRINGIFY(CONFIG_QOS_SPILL_QUEUE_SIZE))
+#define SPILL_KEY_FMT SPILL_BASE_KEY "/%u"
+
+/* Header stored in front of the message payload. */
+struct spill_header {
+	/* Sequence number of the message in the queue. */
+	uint32_t seq;
+	uint32_t flags;
+	uint16_t id;
+	uint8_t type;
+} __packed;
+
+BUILD_ASSERT(sizeof(struct spill_header) + CONFIG_QOS_SPILL_MESSAGE_SIZE_MAX <=
+	     SETTINGS_MAX_VAL_LEN);
+
+struct spill_load_arg {
+	struct qos_data *message;
+	uint32_t seq;
+	bool found;
+	int err;
+};
+
+/* Sequence numbers of the oldest stored message and of the next message to be stored.
+ * A message is stored under the key index given by its sequence number modulo the queue size.
+ */
+static uint32_t head;
+static uint32_t tail;
+static bool empty_on_init = true;
+
+/* IDs of the stored messages, at the same index as their settings key. */
+static uint16_t ids[CONFIG_QOS_SPILL_QUEUE_SIZE];
+
+static int key_get(char *buf, size_t len, uint32_t seq)
+{
+	int ret = snprintk(buf, len, SPILL_KEY_FMT, seq % CONFIG_QOS_SPILL_QUEUE_SIZE);
+
+	if (ret < 0 || ret >= len) {
+		LOG_ERR("Spill queue settings key could not be generated, seq: %d", seq);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
+static int init_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+		   void *param)
+{
+	struct spill_header header;
+
+	ARG_UNUSED(key);
+	ARG_UNUSED(param);
+
+	if (len < sizeof(header)) {
+		LOG_ERR("Spill queue entry too short");
+		return 0;
+	}
+
+	if (read_cb(cb_arg, &header, sizeof(header)) != sizeof(header)) {
+		LOG_ERR("Spill queue entry could not be read");
+		return 0;
+	}
+
+	ids[header.seq % CONFIG_QOS_SPILL_QUEUE_SIZE] = header.id;
+
+	if (empty_on_init) {
+		head = header.seq;
+		tail = header.seq + 1;
+		empty_on_init = false;
+	} else if ((int32_t)(header.seq - head) < 0) {
+		head = header.seq;
+	} else if ((int32_t)(header.seq + 1 - tail) > 0) {
+		tail = header.seq + 1;
+	}
+
+	return 0;
+}
+
+static int pop_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+		  void *param)
+{
+	struct spill_load_arg *arg = param;
+	struct spill_header header;
+	uint8_t *buf;
+
+	ARG_UNUSED(key);
+
+	if (len < sizeof(header)) {
+		LOG_ERR("Spill queue entry too short");
+		return 0;
+	}
+
+	buf = k_malloc(len);
+	if (buf == NULL) {
+		LOG_ERR("Cannot allocate %d bytes for stored message", len);
+		arg->err = -ENOMEM;
+		return -ENOMEM;
+	}
+
+	if (read_cb(cb_arg, buf, len) != len) {
+		LOG_ERR("Spill queue entry could not be read");
+		k_free(buf);
+		return 0;
+	}
+
+	memcpy(&header, buf, sizeof(header));
+
+	/* The entry is a leftover from an earlier pass through the queue. */
+	if (header.seq != arg->seq) {
+		k_free(buf);
+		return 0;
+	}
+
+	memmove(buf, buf + sizeof(header), len - sizeof(header));
+
+	memset(arg->message, 0, sizeof(*arg->message));
+	arg->message->flags = header.flags;
+	arg->message->id = header.id;
+	arg->message->type = header.type;
+	arg->message->data.buf = buf;
+	arg->message->data.len = len - sizeof(header);
+	arg->message->heap_allocated = true;
+	arg->found = true;
+
+	return 0;
+}
+
+int qos_spill_init(void)
+{
+	int err = settings_subsys_init();
+
+	if (err) {
+		LOG_ERR("Initializing settings subsystem failed: %d", err);
+		return err;
+	}
+
+	head = 0;
+	tail = 0;
+	empty_on_init = true;
+
+	err = settings_load_subtree_direct(SPILL_BASE_KEY, init_cb, NULL);
+	if (err) {
+		LOG_ERR("Loading spill queue failed: %d", err);
+		return err;
+	}
+
+	if (qos_spill_count() > CONFIG_QOS_SPILL_QUEUE_SIZE) {
+		LOG_WRN("Spill queue inconsistent, dropping the oldest entries");
+		head = tail - CONFIG_QOS_SPILL_QUEUE_SIZE;
+	}
+
+	LOG_DBG("%d messages stored in the spill queue", qos_spill_count());
+
+	return 0;
+}
+
+int qos_spill_push(const struct qos_data *message)
+{
+	char key[SPILL_KEY_SIZE];
+	struct spill_header header = {
+		.seq = tail,
+		.flags = message->flags,
+		.id = message->id,
+		.type = message->type,
+	};
+	uint8_t *buf;
+	int err;
+
+	if (qos_spill_count() >= CONFIG_QOS_SPILL_QUEUE_SIZE) {
+		return -ENOSPC;
+	}
+
+	if (message->data.len > CONFIG_QOS_SPILL_MESSAGE_SIZE_MAX) {
+		return -EMSGSIZE;
+	}
+
+	err = key_get(key, sizeof(key), tail);
+	if (err) {
+		return err;
+	}
+
+	buf = k_malloc(sizeof(header) + message->data.len);
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	memcpy(buf, &header, sizeof(header));
+	memcpy(buf + sizeof(header), message->data.buf, message->data.len);
+
+	err = settings_save_one(key, buf, sizeof(header) + message->data.len);
+	k_free(buf);
+
+	if (err) {
+		LOG_ERR("Storing message ID %d failed: %d", message->id, err);
+		return err;
+	}
+
+	ids[tail % CONFIG_QOS_SPILL_QUEUE_SIZE] = message->id;
+	tail++;
+
+	return 0;
+}
+
+int qos_spill_pop(struct qos_data *message)
+{
+	char key[SPILL_KEY_SIZE];
+	struct spill_load_arg arg = {
+		.message = message,
+	};
+	int err;
+
+	while (qos_spill_count() != 0) {
+		arg.seq = head;
+
+		err = key_get(key, sizeof(key), head);
+		if (err) {
+			return err;
+		}
+
+		err = settings_load_subtree_direct(key, pop_cb, &arg);
+		if (err) {
+			return err;
+		}
+
+		/* Keep the message stored if it could not be loaded. */
+		if (arg.err) {
+			return arg.err;
+		}
+
+		head++;
+
+		err = settings_delete(key);
+		if (err) {
+			LOG_WRN("Deleting stored message failed: %d", err);
+		}
+
+		if (arg.found) {
+			return 0;
+		}
+
+		LOG_WRN("Stored message %d not found, skipping", arg.seq);
+	}
+
+	return -ENODATA;
+}
+
+size_t qos_spill_count(void)
+{
+	return tail - head;
+}
+
+uint16_t qos_spill_id_get(size_t index)
+{
+	__ASSERT_NO_MSG(index < qos_spill_count());
+
+	return ids[(head + index) % CONFIG_QOS_SPILL_QUEUE_SIZE];
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef QOS_SPILL_H__
+#define QOS_SPILL_H__
+
+#include <qos.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Spill queue of unACKed messages stored in flash. The functions are not thread safe and are
+ * called with the QoS library lock held.
+ */
+
+/* Initialize the settings subsystem and find the stored messages. */
+int qos_spill_init(void);
+
+/* Store a copy of the message and its payload at the end of the queue.
+ *
+ * Returns -ENOSPC if the queue is full and -EMSGSIZE if the payload is too large.
+ */
+int qos_spill_push(const struct qos_data *message);
+
+/* Remove the oldest message from the queue. The payload is allocated with k_malloc()
+ * and the heap_allocated flag of the message is set.
+ *
+ * Returns -ENODATA if the queue is empty.
+ */
+int qos_spill_pop(struct qos_data *message);
+
+/* Number of messages in the queue. */
+size_t qos_spill_count(void);
+
+/* ID of the stored message at the given position, counted from the oldest message. */
+uint16_t qos_spill_id_get(size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QOS_SPILL_H__ */
@@ -105,6 +105,15 @@ static void validate_and_boot(const struct fw_info *fw_info, uint16_t slot)
 		}
 	}
 
+#if defined(CONFIG_SB_VALIDATION_CACHE)
+	/* Only the bootloader is allowed to write validation records. */
+	err = fprotect_area(PM_B0_VALIDATION_CACHE_ADDRESS, PM_B0_VALIDATION_CACHE_SIZE);
+	if (err) {
+		printk("Failed to protect validation cache, cancel startup.\n\r");
+		return;
+	}
+#endif
+
 	bl_boot(fw_info);
 }
 
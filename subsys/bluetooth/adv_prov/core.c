@@ -4,16 +4,31 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
+#include <zephyr/bluetooth/gap.h>
 #include <bluetooth/adv_prov.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(bt_le_adv_prov, CONFIG_BT_ADV_PROV_LOG_LEVEL);
 
+/* Encoded data longer than the legacy advertising packet is always reported as changed. */
+#define PAYLOAD_MAX_LEN		BT_GAP_ADV_MAX_ADV_DATA_LEN
+#define AD_ELEMENT_HDR_LEN	2
+
 enum provider_set {
 	PROVIDER_SET_AD,
-	PROVIDER_SET_SD
+	PROVIDER_SET_SD,
+	PROVIDER_SET_COUNT
+};
+
+struct payload {
+	uint8_t data[PAYLOAD_MAX_LEN];
+	size_t len;
+	bool valid;
+	bool changed;
 };
 
+static struct payload payloads[PROVIDER_SET_COUNT];
 
 static void get_section_ptrs(enum provider_set set,
 			     const struct bt_le_adv_prov_provider **start,
@@ -75,6 +90,84 @@ static void update_common_feedback(struct bt_le_adv_prov_feedback *common_fb,
 	common_fb->grace_period_s = MAX(common_fb->grace_period_s, fb->grace_period_s);
 }
 
+static bool provider_cache_valid(const struct bt_le_adv_prov_provider_cache *cache,
+				 const struct bt_le_adv_prov_adv_state *state)
+{
+	return atomic_get(&cache->valid) &&
+	       !state->new_adv_session &&
+	       !state->rpa_rotated &&
+	       (cache->pairing_mode == state->pairing_mode) &&
+	       (cache->in_grace_period == state->in_grace_period);
+}
+
+static int provider_get_data(const struct bt_le_adv_prov_provider *p, struct bt_data *d,
+			     const struct bt_le_adv_prov_adv_state *state,
+			     struct bt_le_adv_prov_feedback *fb)
+{
+	struct bt_le_adv_prov_provider_cache *cache = p->cache;
+	int err;
+
+	if (cache && provider_cache_valid(cache, state)) {
+		if (!cache->err) {
+			*d = cache->d;
+		}
+		*fb = cache->fb;
+
+		return cache->err;
+	}
+
+	if (cache) {
+		/* Set before the data is fetched not to lose invalidation done in the meantime. */
+		atomic_set(&cache->valid, true);
+	}
+
+	memset(fb, 0, sizeof(*fb));
+	err = p->get_data(d, state, fb);
+
+	if (cache) {
+		if (err && (err != -ENOENT)) {
+			atomic_set(&cache->valid, false);
+		} else {
+			if (!err) {
+				cache->d = *d;
+			}
+			cache->fb = *fb;
+			cache->err = err;
+			cache->pairing_mode = state->pairing_mode;
+			cache->in_grace_period = state->in_grace_period;
+		}
+	}
+
+	return err;
+}
+
+static void payload_update(enum provider_set set, const struct bt_data *d, size_t d_len)
+{
+	struct payload *payload = &payloads[set];
+	uint8_t data[PAYLOAD_MAX_LEN];
+	size_t len = 0;
+
+	for (size_t i = 0; i < d_len; i++) {
+		if ((len + AD_ELEMENT_HDR_LEN + d[i].data_len) > sizeof(data)) {
+			payload->valid = false;
+			payload->changed = true;
+			return;
+		}
+
+		data[len++] = d[i].data_len + 1;
+		data[len++] = d[i].type;
+		memcpy(&data[len], d[i].data, d[i].data_len);
+		len += d[i].data_len;
+	}
+
+	payload->changed = !payload->valid || (payload->len != len) ||
+			   memcmp(payload->data, data, len);
+
+	memcpy(payload->data, data, len);
+	payload->len = len;
+	payload->valid = true;
+}
+
 static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *d_len,
 			      const struct bt_le_adv_prov_adv_state *state,
 			      struct bt_le_adv_prov_feedback *fb)
@@ -94,8 +187,7 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 	memset(&common_fb, 0, sizeof(common_fb));
 
 	for (const struct bt_le_adv_prov_provider *p = start; p < end; p++) {
-		memset(fb, 0, sizeof(*fb));
-		err = p->get_data(&d[pos], state, fb);
+		err = provider_get_data(p, &d[pos], state, fb);
 
 		if (!err) {
 			pos++;
@@ -110,6 +202,10 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 	if (!err) {
 		*d_len = pos;
 		memcpy(fb, &common_fb, sizeof(common_fb));
+		payload_update(set, d, pos);
+	} else {
+		payloads[set].valid = false;
+		payloads[set].changed = true;
 	}
 
 	return err;
@@ -128,3 +224,13 @@ int bt_le_adv_prov_get_sd(struct bt_data *sd, size_t *sd_len,
 {
 	return get_providers_data(PROVIDER_SET_SD, sd, sd_len, state, fb);
 }
+
+bool bt_le_adv_prov_ad_changed(void)
+{
+	return payloads[PROVIDER_SET_AD].changed;
+}
+
+bool bt_le_adv_prov_sd_changed(void)
+{
+	return payloads[PROVIDER_SET_SD].changed;
+}
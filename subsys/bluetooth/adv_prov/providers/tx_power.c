@@ -11,6 +11,7 @@
 #include <zephyr/bluetooth/hci_vs.h>
 
 #include <bluetooth/adv_prov.h>
+#include <bluetooth/adv_prov/tx_power.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(bt_le_adv_prov, CONFIG_BT_ADV_PROV_LOG_LEVEL);
@@ -60,4 +61,13 @@ static int get_data(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *s
 	return err;
 }
 
-BT_LE_ADV_PROV_AD_PROVIDER_REGISTER(tx_power, get_data);
+/* TX power is read from the controller again only when a new advertising session is started,
+ * RPA is rotated or the user invalidates it. This avoids a synchronous HCI command on every
+ * advertising data update.
+ */
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_CACHED(tx_power, get_data);
+
+void bt_le_adv_prov_tx_power_invalidate(void)
+{
+	BT_LE_ADV_PROV_PROVIDER_INVALIDATE(tx_power);
+}
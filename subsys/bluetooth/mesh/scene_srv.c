@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/bluetooth/mesh/access.h>
 #include <bluetooth/mesh/models.h>
 #include <zephyr/sys/byteorder.h>
@@ -286,17 +287,54 @@ const struct bt_mesh_model_op _bt_mesh_scene_srv_op[] = {
 	BT_MESH_MODEL_OP_END,
 };
 
-static uint16_t *scene_find(struct bt_mesh_scene_srv *srv, uint16_t scene)
+/** @brief Find the position of a scene number in the sorted scene register.
+ *
+ *  @param[in] srv   Scene Server.
+ *  @param[in] scene Scene number.
+ *
+ *  @return Position of the first scene whose number is equal to or higher than
+ *          the given scene number.
+ */
+static uint16_t scene_pos_find(const struct bt_mesh_scene_srv *srv, uint16_t scene)
 {
-	for (int i = 0; i < srv->count; i++) {
-		if (srv->all[i] == scene) {
-			return &srv->all[i];
+	uint16_t low = 0;
+	uint16_t high = srv->count;
+
+	while (low < high) {
+		uint16_t mid = low + (high - low) / 2;
+
+		if (srv->all[mid] < scene) {
+			low = mid + 1;
+		} else {
+			high = mid;
 		}
 	}
 
+	return low;
+}
+
+static uint16_t *scene_find(struct bt_mesh_scene_srv *srv, uint16_t scene)
+{
+	uint16_t pos = scene_pos_find(srv, scene);
+
+	if (pos < srv->count && srv->all[pos] == scene) {
+		return &srv->all[pos];
+	}
+
 	return NULL;
 }
 
+/** Add a scene that isn't in the register yet, keeping the register sorted. */
+static void scene_insert(struct bt_mesh_scene_srv *srv, uint16_t scene)
+{
+	uint16_t pos = scene_pos_find(srv, scene);
+
+	memmove(&srv->all[pos + 1], &srv->all[pos],
+		(srv->count - pos) * sizeof(srv->all[0]));
+	srv->all[pos] = scene;
+	srv->count++;
+}
+
 static void entry_recover(struct bt_mesh_scene_srv *srv, bool vnd,
 			  const struct scene_data *data)
 {
@@ -385,10 +423,80 @@ static ssize_t entry_store(struct bt_mesh_model *mod,
 	return sizeof(struct scene_data) + data->len;
 }
 
+struct page_cmp {
+	const uint8_t *data;
+	size_t len;
+	bool equal;
+};
+
+/* Buffer for reading back stored pages. Scenes are only stored from the
+ * Scene Setup Server message handlers, which all run in the same thread.
+ */
+static uint8_t page_cmp_buf[SCENE_PAGE_SIZE];
+
+static int page_cmp_cb(const char *key, size_t len, settings_read_cb read_cb,
+		       void *cb_arg, void *param)
+{
+	struct page_cmp *cmp = param;
+	ssize_t size;
+
+	/* Only compare the page itself, and not any entries below it. */
+	if (key) {
+		return 0;
+	}
+
+	/* Some settings backends report older values of the entry first, so the
+	 * last value reported decides the outcome.
+	 */
+	if (len != cmp->len || len == 0) {
+		cmp->equal = (len == cmp->len);
+		return 0;
+	}
+
+	size = read_cb(cb_arg, page_cmp_buf, sizeof(page_cmp_buf));
+	cmp->equal = (size == cmp->len) && !memcmp(page_cmp_buf, cmp->data, size);
+
+	return 0;
+}
+
+/** @brief Check whether a page of the Scene is already stored with the given
+ *         data.
+ *
+ *  @param[in] srv  Scene Server the page belongs to.
+ *  @param[in] path Path of the page, relative to the Scene Server's data.
+ *  @param[in] buf  Page data.
+ *  @param[in] len  Page data length, or 0 to check that the page isn't stored.
+ *
+ *  @return true if the stored page is equal to the given data.
+ */
+static bool page_is_stored(struct bt_mesh_scene_srv *srv, const char *path,
+			   const uint8_t buf[], size_t len)
+{
+	struct page_cmp cmp = {
+		.data = buf,
+		.len = len,
+		/* A page that isn't stored is equal to an empty page. */
+		.equal = (len == 0),
+	};
+	char full_path[32];
+	int err;
+
+	sprintf(full_path, "bt/mesh/s/%x/data/%s",
+		(srv->model->elem_idx << 8) | srv->model->mod_idx, path);
+
+	err = settings_load_subtree_direct(full_path, page_cmp_cb, &cmp);
+	if (err) {
+		return false;
+	}
+
+	return cmp.equal;
+}
+
 /** Store a single page of the Scene.
  *
  *  To accommodate large scene data, each scene is stored in pages of up to 256
- *  bytes.
+ *  bytes. A page is only written if its stored data is different, and a page
+ *  with no data is deleted.
  */
 static void page_store(struct bt_mesh_scene_srv *srv, uint16_t scene,
 		       uint8_t page, bool vnd, uint8_t buf[], size_t len)
@@ -397,9 +505,16 @@ static void page_store(struct bt_mesh_scene_srv *srv, uint16_t scene,
 	int err;
 
 	scene_path(path, scene, vnd, page);
-	update_page_count(srv, vnd, page);
+	if (len) {
+		update_page_count(srv, vnd, page);
+	}
 
-	err = bt_mesh_model_data_store(srv->model, false, path, buf, len);
+	if (page_is_stored(srv, path, buf, len)) {
+		LOG_DBG("%s unchanged", path);
+		return;
+	}
+
+	err = bt_mesh_model_data_store(srv->model, false, path, len ? buf : NULL, len);
 	if (err) {
 		LOG_ERR("Failed storing %s: %d", path, err);
 	}
@@ -527,7 +642,12 @@ static void scene_store_mod(struct bt_mesh_scene_srv *srv, uint16_t scene,
 	}
 
 	if (len) {
-		page_store(srv, scene, page, vnd, buf, len);
+		page_store(srv, scene, page++, vnd, buf, len);
+	}
+
+	/* Delete the pages that were used by an earlier version of the scene. */
+	for (; page < (vnd ? srv->vndpages : srv->sigpages); page++) {
+		page_store(srv, scene, page, vnd, NULL, 0);
 	}
 }
 
@@ -542,7 +662,7 @@ static enum bt_mesh_scene_status scene_store(struct bt_mesh_scene_srv *srv,
 			return BT_MESH_SCENE_REGISTER_FULL;
 		}
 
-		srv->all[srv->count++] = scene;
+		scene_insert(srv, scene);
 	}
 
 	scene_store_mod(srv, scene, false);
@@ -586,7 +706,8 @@ static void scene_delete(struct bt_mesh_scene_srv *srv, uint16_t *scene)
 		srv->prev = BT_MESH_SCENE_NONE;
 	}
 
-	*scene = srv->all[--srv->count];
+	srv->count--;
+	memmove(scene, scene + 1, (&srv->all[srv->count] - scene) * sizeof(*scene));
 }
 
 static int handle_store(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
@@ -779,7 +900,7 @@ static int scene_srv_set(struct bt_mesh_model *model, const char *path,
 		}
 
 		LOG_DBG("Recovered scene 0x%x", scene);
-		srv->all[srv->count++] = scene;
+		scene_insert(srv, scene);
 		return 0;
 	}
 
@@ -801,7 +922,7 @@ static void scene_srv_reset(struct bt_mesh_model *model)
 	srv->next = BT_MESH_SCENE_NONE;
 
 	while (srv->count) {
-		scene_delete(srv, &srv->all[0]);
+		scene_delete(srv, &srv->all[srv->count - 1]);
 	}
 
 	srv->prev = BT_MESH_SCENE_NONE;
@@ -377,31 +377,149 @@ static bool convert_scheduler_time_to_tm(struct tm *sched_time,
 	return stage == FINAL_STAGE;
 }
 
-static uint8_t get_least_time_index(struct bt_mesh_scheduler_srv *srv)
+/* Number of seconds between two occurrences of an entry that repeats with
+ * a fixed period, or 0 if the entry has no fixed period. Such entries have
+ * wildcards in all fields above the repeating one, and exact values in all
+ * fields below it.
+ */
+static uint32_t entry_period_get(const struct bt_mesh_schedule_entry *entry)
 {
-	uint8_t cnt = u32_count_trailing_zeros(srv->active_bitmap);
-	uint8_t idx = cnt;
+	bool minute_exact = entry->minute < 60;
+	bool second_exact = entry->second < 60;
+
+	if (entry->year != BT_MESH_SCHEDULER_ANY_YEAR ||
+	    entry->month != BIT_MASK(12) ||
+	    entry->day != BT_MESH_SCHEDULER_ANY_DAY ||
+	    entry->day_of_week != BIT_MASK(7)) {
+		return 0;
+	}
+
+	if (entry->hour < 24) {
+		return (minute_exact && second_exact) ? SEC_PER_DAY : 0;
+	}
+
+	if (entry->hour != BT_MESH_SCHEDULER_ANY_HOUR) {
+		return 0;
+	}
+
+	if (minute_exact) {
+		return second_exact ? SEC_PER_HOUR : 0;
+	}
 
-	while (++cnt < BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT) {
-		if (srv->active_bitmap & BIT(cnt)) {
-			idx = srv->sched_tai[idx].sec >
-				srv->sched_tai[cnt].sec ? cnt : idx;
+	if (entry->minute == BT_MESH_SCHEDULER_EVERY_15_MINUTES) {
+		return second_exact ? 15 * SEC_PER_MIN : 0;
+	}
+
+	if (entry->minute == BT_MESH_SCHEDULER_EVERY_20_MINUTES) {
+		return second_exact ? 20 * SEC_PER_MIN : 0;
+	}
+
+	if (entry->minute != BT_MESH_SCHEDULER_ANY_MINUTE) {
+		return 0;
+	}
+
+	switch (entry->second) {
+	case BT_MESH_SCHEDULER_ANY_SECOND:
+		return 1;
+	case BT_MESH_SCHEDULER_EVERY_15_SECONDS:
+		return 15;
+	case BT_MESH_SCHEDULER_EVERY_20_SECONDS:
+		return 20;
+	case BT_MESH_SCHEDULER_ONCE_A_MINUTE:
+		return 0;
+	default:
+		return SEC_PER_MIN;
+	}
+}
+
+/* Entries with the same time are ordered by index. */
+static bool queue_is_before(struct bt_mesh_scheduler_srv *srv, uint8_t a,
+			    uint8_t b)
+{
+	return srv->sched_tai[a].sec < srv->sched_tai[b].sec ||
+	       (srv->sched_tai[a].sec == srv->sched_tai[b].sec && a < b);
+}
+
+static void queue_place(struct bt_mesh_scheduler_srv *srv, uint8_t pos,
+			uint8_t idx)
+{
+	srv->queue[pos] = idx;
+	srv->queue_pos[idx] = pos;
+}
+
+static void queue_sift(struct bt_mesh_scheduler_srv *srv, uint8_t pos)
+{
+	uint8_t idx = srv->queue[pos];
+
+	while (pos > 0 &&
+	       queue_is_before(srv, idx, srv->queue[(pos - 1) / 2])) {
+		queue_place(srv, pos, srv->queue[(pos - 1) / 2]);
+		pos = (pos - 1) / 2;
+	}
+
+	while (2 * pos + 1 < srv->queue_len) {
+		uint8_t child = 2 * pos + 1;
+
+		if (child + 1 < srv->queue_len &&
+		    queue_is_before(srv, srv->queue[child + 1],
+				    srv->queue[child])) {
+			child++;
+		}
+
+		if (!queue_is_before(srv, srv->queue[child], idx)) {
+			break;
 		}
+
+		queue_place(srv, pos, srv->queue[child]);
+		pos = child;
+	}
+
+	queue_place(srv, pos, idx);
+}
+
+/* Add the entry to the queue, or move it after its time has changed. */
+static void queue_update(struct bt_mesh_scheduler_srv *srv, uint8_t idx)
+{
+	if (!(srv->active_bitmap & BIT(idx))) {
+		WRITE_BIT(srv->active_bitmap, idx, 1);
+		queue_place(srv, srv->queue_len++, idx);
+	}
+
+	queue_sift(srv, srv->queue_pos[idx]);
+}
+
+static void queue_remove(struct bt_mesh_scheduler_srv *srv, uint8_t idx)
+{
+	uint8_t pos = srv->queue_pos[idx];
+
+	if (!(srv->active_bitmap & BIT(idx))) {
+		return;
 	}
 
-	return MIN(BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT, idx);
+	WRITE_BIT(srv->active_bitmap, idx, 0);
+	if (pos != --srv->queue_len) {
+		queue_place(srv, pos, srv->queue[srv->queue_len]);
+		queue_sift(srv, pos);
+	}
+}
+
+static void queue_clear(struct bt_mesh_scheduler_srv *srv)
+{
+	srv->active_bitmap = 0;
+	srv->queue_len = 0;
 }
 
 static void run_scheduler(struct bt_mesh_scheduler_srv *srv)
 {
 	struct tm sched_time;
 	int64_t current_uptime = k_uptime_get();
-	uint8_t planned_idx = get_least_time_index(srv);
+	uint8_t planned_idx;
 
-	if (planned_idx == BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT) {
+	if (srv->queue_len == 0) {
 		return;
 	}
 
+	planned_idx = srv->queue[0];
 	tai_to_ts(&srv->sched_tai[planned_idx], &sched_time);
 	int64_t scheduled_uptime = bt_mesh_time_srv_mktime(srv->time_srv,
 			&sched_time);
@@ -461,7 +579,43 @@ static void schedule_action(struct bt_mesh_scheduler_srv *srv,
 	LOG_DBG("        minute: %d", sched_time.tm_min);
 	LOG_DBG("        second: %d", sched_time.tm_sec);
 
-	WRITE_BIT(srv->active_bitmap, idx, 1);
+	queue_update(srv, idx);
+}
+
+/* Schedule the next occurrence of a fired entry that repeats with a fixed
+ * period, without going through the calendar stages. Returns false if the
+ * entry has to be scheduled with schedule_action().
+ */
+static bool schedule_next_period(struct bt_mesh_scheduler_srv *srv,
+				 uint8_t idx)
+{
+	uint32_t period = entry_period_get(&srv->sch_reg[idx]);
+	struct bt_mesh_time_tai current_tai;
+	struct tm *current_local;
+	uint64_t fired = srv->sched_tai[idx].sec;
+
+	if (period == 0) {
+		return false;
+	}
+
+	current_local = bt_mesh_time_srv_localtime(srv->time_srv,
+						   k_uptime_get());
+	if (current_local == NULL || ts_to_tai(&current_tai, current_local)) {
+		return false;
+	}
+
+	/* Leave the rare case of a late or early fire to the calendar
+	 * stages, as they may skip occurrences that were missed.
+	 */
+	if (current_tai.sec < fired || current_tai.sec - fired >= SEC_PER_MIN) {
+		return false;
+	}
+
+	srv->sched_tai[idx].sec =
+		fired + period * ((current_tai.sec - fired) / period + 1);
+	queue_update(srv, idx);
+
+	return true;
 }
 
 static void scheduled_action_handle(struct k_work *work)
@@ -476,7 +630,7 @@ static void scheduled_action_handle(struct k_work *work)
 		return;
 	}
 
-	WRITE_BIT(srv->active_bitmap, srv->idx, 0);
+	queue_remove(srv, srv->idx);
 
 	struct bt_mesh_model *next_sched_mod = NULL;
 	uint16_t model_id = srv->sch_reg[srv->idx].action ==
@@ -539,7 +693,10 @@ static void scheduled_action_handle(struct k_work *work)
 	uint8_t tmp_idx = srv->idx;
 
 	srv->idx = BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT;
-	schedule_action(srv, tmp_idx);
+	if (!schedule_next_period(srv, tmp_idx)) {
+		schedule_action(srv, tmp_idx);
+	}
+
 	run_scheduler(srv);
 }
 
@@ -748,7 +905,7 @@ static int scheduler_srv_init(struct bt_mesh_model *model)
 	srv->pub.update = update_handler;
 	net_buf_simple_init_with_data(&srv->pub_buf, srv->pub_data,
 			sizeof(srv->pub_data));
-	srv->active_bitmap = 0;
+	queue_clear(srv);
 
 	srv->idx = BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT;
 	k_work_init_delayable(&srv->delayed_work, scheduled_action_handle);
@@ -765,7 +922,7 @@ static void scheduler_srv_reset(struct bt_mesh_model *model)
 	struct bt_mesh_scheduler_srv *srv = model->user_data;
 
 	srv->idx = BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT;
-	srv->active_bitmap = 0;
+	queue_clear(srv);
 	/* If this cancellation fails, we'll exit early from the timer handler,
 	 * as srv->idx is out of bounds.
 	 */
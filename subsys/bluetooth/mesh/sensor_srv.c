@@ -18,24 +18,62 @@
 #include "zephyr/logging/log.h"
 LOG_MODULE_REGISTER(bt_mesh_sensor_srv);
 
-#define SENSOR_FOR_EACH(_list, _node)                                          \
-	SYS_SLIST_FOR_EACH_CONTAINER(_list, _node, state.node)
+/** @brief Find the position of a sensor ID in the sorted sensor index.
+ *
+ *  @param srv   Sensor server.
+ *  @param count Number of sensors in the index to search.
+ *  @param id    Sensor ID.
+ *
+ *  @return Position of the first sensor with an ID equal to or higher than
+ *          the given ID.
+ */
+static int sensor_pos_find(const struct bt_mesh_sensor_srv *srv, int count,
+			   uint16_t id)
+{
+	int low = 0;
+	int high = count;
+
+	while (low < high) {
+		int mid = low + (high - low) / 2;
+
+		if (srv->sensors[mid]->type->id < id) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
 
 static struct bt_mesh_sensor *sensor_get(struct bt_mesh_sensor_srv *srv,
 					 uint16_t id)
 {
-	struct bt_mesh_sensor *sensor;
+	int pos = sensor_pos_find(srv, srv->sensor_count, id);
 
-	SENSOR_FOR_EACH(&srv->sensors, sensor)
-	{
-		if (sensor->type->id == id) {
-			return sensor;
-		}
+	if (pos < srv->sensor_count && srv->sensors[pos]->type->id == id) {
+		return srv->sensors[pos];
 	}
 
 	return NULL;
 }
 
+/** @brief Make the server recalculate the publication schedule of its sensors
+ *         on the next publication, after the cadence of a sensor has changed.
+ *
+ *  @param srv Sensor server.
+ */
+static void schedule_invalidate(struct bt_mesh_sensor_srv *srv)
+{
+	srv->sched_base_period = 0;
+	srv->pub_idle = 0;
+	srv->pub_div_max = 0;
+
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		srv->pub_div_max = MAX(srv->pub_div_max, srv->sensors[i]->state.pub_div);
+	}
+}
+
 #if CONFIG_BT_SETTINGS
 static void sensor_srv_pending_store(struct bt_mesh_model *model)
 {
@@ -46,7 +84,7 @@ static void sensor_srv_pending_store(struct bt_mesh_model *model)
 				    BT_MESH_SENSOR_MSG_MAXLEN_CADENCE_STATUS));
 
 	for (int i = 0; i < srv->sensor_count; ++i) {
-		const struct bt_mesh_sensor *s = srv->sensor_array[i];
+		const struct bt_mesh_sensor *s = srv->sensors[i];
 		int err;
 
 		if (!s->state.configured) {
@@ -155,7 +193,8 @@ static int handle_descriptor_get(struct bt_mesh_model *model, struct bt_mesh_msg
 		goto respond;
 	}
 
-	SENSOR_FOR_EACH(&srv->sensors, sensor) {
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		sensor = srv->sensors[i];
 		LOG_DBG("Reporting ID 0x%04x", sensor->type->id);
 
 		if (net_buf_simple_tailroom(&rsp) < (8 + BT_MESH_MIC_SHORT)) {
@@ -205,8 +244,8 @@ static int handle_get(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 		goto respond;
 	}
 
-	SENSOR_FOR_EACH(&srv->sensors, sensor) {
-		buf_status_add(srv, sensor, ctx, &rsp);
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		buf_status_add(srv, srv->sensors[i], ctx, &rsp);
 	}
 
 respond:
@@ -562,6 +601,8 @@ static int cadence_set(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 	sensor->state.threshold = threshold;
 	sensor->state.configured = true;
 
+	schedule_invalidate(srv);
+
 	/** Reschedule publication timer if the cadence increased. */
 	if (period_div > srv->pub.period_div) {
 		int period_ms;
@@ -866,38 +907,68 @@ static uint16_t min_int_get(const struct bt_mesh_sensor *sensor,
 	return DIV_ROUND_UP(min_int, pub_int);
 }
 
-/** @brief Conditionally add a sensor value to a publication.
+/** @brief Calculate when a sensor is due to be sampled for publication.
+ *
+ *  A sensor is due when its minimum interval has expired. Sensors with a not
+ *  configured cadence state are not due more frequently than the base periodic
+ *  publication.
  *
- *  A sensor message will be added to the publication if its minimum interval
- *  has expired and the value is outside its delta threshold or the
- *  publication interval has expired.
+ *  @param srv Server sending the publication.
+ *  @param s   Sensor to calculate the publication schedule of.
+ */
+static void sensor_due_update(struct bt_mesh_sensor_srv *srv,
+			      struct bt_mesh_sensor *s)
+{
+	uint16_t due = min_int_get(s, srv->sched_period_div,
+				   srv->sched_base_period);
+
+	if (!s->state.configured) {
+		due = MAX(due, 1U << srv->sched_period_div);
+	}
+
+	s->state.pub_due = due;
+}
+
+/** @brief Recalculate the publication schedule if the publication period changed.
  *
  *  @param srv         Server sending the publication.
- *  @param s           Sensor to add data of.
  *  @param period_div  Server's original period divisor.
  *  @param base_period Server's original base period.
  */
-static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
-			struct bt_mesh_sensor *s, uint8_t period_div,
-			uint32_t base_period)
+static void schedule_update(struct bt_mesh_sensor_srv *srv, uint8_t period_div,
+			    uint32_t base_period)
 {
-	uint16_t min_int = min_int_get(s, period_div, base_period);
-	uint16_t delta = srv->seq - s->state.seq;
-	int err;
-
-	if (delta < min_int) {
+	if (srv->sched_base_period == base_period &&
+	    srv->sched_period_div == period_div) {
 		return;
 	}
 
-	if (!s->state.configured &&
-	    (delta < (1 << period_div))) {
-		/** Don't publish a sensor value with not configured sensor cadence state more
-		 * frequently than base periodic publication.
-		 */
-		return;
+	srv->sched_base_period = base_period;
+	srv->sched_period_div = period_div;
+	srv->pub_idle = 0;
+
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		sensor_due_update(srv, srv->sensors[i]);
 	}
+}
 
+/** @brief Conditionally add the value of a due sensor to a publication.
+ *
+ *  A sensor message will be added to the publication if the value is outside
+ *  its delta threshold or the publication interval has expired.
+ *
+ *  @param srv        Server sending the publication.
+ *  @param s          Sensor to add data of.
+ *  @param period_div Server's original period divisor.
+ *  @param delta      Number of server publications since the previous
+ *                    publication of the sensor.
+ */
+static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
+			struct bt_mesh_sensor *s, uint8_t period_div,
+			uint16_t delta)
+{
 	struct sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX] = {};
+	int err;
 
 	err = value_get(srv, s, NULL, value);
 	if (err) {
@@ -922,10 +993,39 @@ static void pub_msg_add(struct bt_mesh_sensor_srv *srv,
 	s->state.seq = srv->seq;
 }
 
+/** @brief Add the values of all due sensors to a publication.
+ *
+ *  @param srv        Server sending the publication.
+ *  @param period_div Server's original period divisor.
+ *
+ *  @return Number of following publications in which no sensor is due.
+ */
+static uint16_t pub_msgs_add(struct bt_mesh_sensor_srv *srv, uint8_t period_div)
+{
+	uint16_t idle = UINT16_MAX;
+
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		struct bt_mesh_sensor *s = srv->sensors[i];
+		uint16_t delta = srv->seq - s->state.seq;
+
+		if (delta >= s->state.pub_due) {
+			pub_msg_add(srv, s, period_div, delta);
+			delta = srv->seq - s->state.seq;
+		}
+
+		if (delta + 1 < s->state.pub_due) {
+			idle = MIN(idle, s->state.pub_due - (delta + 1));
+		} else {
+			idle = 0;
+		}
+	}
+
+	return idle;
+}
+
 static int update_handler(struct bt_mesh_model *model)
 {
 	struct bt_mesh_sensor_srv *srv = model->user_data;
-	struct bt_mesh_sensor *s;
 
 	bt_mesh_model_msg_init(srv->pub.msg, BT_MESH_SENSOR_OP_STATUS);
 
@@ -946,17 +1046,20 @@ static int update_handler(struct bt_mesh_model *model)
 
 	srv->pub.fast_period = true;
 
-	SENSOR_FOR_EACH(&srv->sensors, s)
-	{
-		pub_msg_add(srv, s, period_div, base_period);
+	schedule_update(srv, period_div, base_period);
 
-		/** Update the publication divisor to a new value. This is needed to take new
-		 * changes in a sensor cadence state, .e.g. when the cadence decreased.
-		 */
-		srv->pub.period_div =
-			MAX(srv->pub.period_div, s->state.pub_div);
+	/** Only sample the sensors when at least one of them is due. */
+	if (srv->pub_idle) {
+		srv->pub_idle--;
+	} else {
+		srv->pub_idle = pub_msgs_add(srv, period_div);
 	}
 
+	/** Update the publication divisor to a new value. This is needed to take new
+	 * changes in a sensor cadence state, .e.g. when the cadence decreased.
+	 */
+	srv->pub.period_div = srv->pub_div_max;
+
 	if (period_div != srv->pub.period_div) {
 		LOG_DBG("New interval: %u",
 		       bt_mesh_model_pub_period_get(srv->model));
@@ -971,35 +1074,34 @@ static int sensor_srv_init(struct bt_mesh_model *model)
 {
 	struct bt_mesh_sensor_srv *srv = model->user_data;
 
-	sys_slist_init(&srv->sensors);
-
-	/* Establish a sorted list of sensors, as this is a requirement when
+	/* Establish a sorted index of sensors, as this is a requirement when
 	 * sending multiple sensor values in one message.
 	 */
-	uint16_t min_id = 0;
+	int count = 0;
 
-	for (int count = 0; count < srv->sensor_count; ++count) {
-		struct bt_mesh_sensor *best = NULL;
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		struct bt_mesh_sensor *s = srv->sensor_array[i];
+		int pos = sensor_pos_find(srv, count, s->type->id);
 
-		for (int j = 0; j < srv->sensor_count; ++j) {
-			if (srv->sensor_array[j]->type->id >= min_id &&
-			    (!best ||
-			     srv->sensor_array[j]->type->id < best->type->id)) {
-				best = srv->sensor_array[j];
-			}
+		if (pos < count && srv->sensors[pos]->type->id == s->type->id) {
+			LOG_ERR("Duplicate sensor ID 0x%04x", s->type->id);
+			continue;
 		}
 
-		if (!best) {
-			LOG_ERR("Duplicate sensor ID");
-			srv->sensor_count = count;
-			break;
-		}
+		memmove(&srv->sensors[pos + 1], &srv->sensors[pos],
+			(count - pos) * sizeof(srv->sensors[0]));
+		srv->sensors[pos] = s;
+		count++;
+	}
 
-		sys_slist_append(&srv->sensors, &best->state.node);
-		LOG_DBG("Sensor 0x%04x", best->type->id);
-		min_id = best->type->id + 1;
+	srv->sensor_count = count;
+
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		LOG_DBG("Sensor 0x%04x", srv->sensors[i]->type->id);
 	}
 
+	schedule_invalidate(srv);
+
 	srv->seq = 1;
 
 	srv->model = model;
@@ -1027,7 +1129,7 @@ static void sensor_srv_reset(struct bt_mesh_model *model)
 	net_buf_simple_reset(srv->setup_pub.msg);
 
 	for (int i = 0; i < srv->sensor_count; ++i) {
-		struct bt_mesh_sensor *s = srv->sensor_array[i];
+		struct bt_mesh_sensor *s = srv->sensors[i];
 
 		s->state.pub_div = 0;
 		s->state.min_int = 0;
@@ -1035,6 +1137,7 @@ static void sensor_srv_reset(struct bt_mesh_model *model)
 		memset(&s->state.threshold, 0, sizeof(s->state.threshold));
 	}
 
+	schedule_invalidate(srv);
 	srv->pub.period_div = 0;
 
 	if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
@@ -1095,6 +1198,8 @@ static int sensor_srv_settings_set(struct bt_mesh_model *model, const char *name
 		srv->pub.period_div = MAX(srv->pub.period_div, s->state.pub_div);
 	}
 
+	schedule_invalidate(srv);
+
 	if (err) {
 		LOG_ERR("Failed: %d", err);
 	}
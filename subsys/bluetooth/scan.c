@@ -18,6 +18,14 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
 
+/* Filters are indexed in open addressing hash tables. The table has more slots
+ * than filters, so that a probe sequence always ends with an empty slot.
+ */
+#define FILTER_HASH_SIZE(cnt) (2 * (cnt) + 1)
+
+/* A slot holds the filter index incremented by one, zero denotes an empty slot. */
+#define FILTER_HASH_SLOT_EMPTY 0
+
 /* Scan filter mutex. */
 K_MUTEX_DEFINE(scan_mutex);
 
@@ -55,6 +63,9 @@ struct bt_scan_name_filter {
 	 */
 	char target_name[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
 
+	/* Filter indexes sorted by the target name. */
+	uint8_t sorted[CONFIG_BT_SCAN_NAME_CNT];
+
 	/* Name filter counter. */
 	uint8_t cnt;
 
@@ -76,6 +87,9 @@ struct bt_scan_short_name_filter {
 		uint8_t min_len;
 	} name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
 
+	/* Filter indexes sorted by the target name. */
+	uint8_t sorted[CONFIG_BT_SCAN_SHORT_NAME_CNT];
+
 	/* Short name filter counter. */
 	uint8_t cnt;
 
@@ -89,6 +103,9 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+	/* Hash table of the addresses. */
+	uint8_t hash[FILTER_HASH_SIZE(CONFIG_BT_SCAN_ADDRESS_CNT)];
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -120,6 +137,9 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+	/* Hash table of the UUIDs. */
+	uint8_t hash[FILTER_HASH_SIZE(CONFIG_BT_SCAN_UUID_CNT)];
+
 	/* UUID filter counter. */
 	uint8_t cnt;
 
@@ -133,6 +153,9 @@ struct bt_scan_appearance_filter {
 	 */
 	uint16_t appearance[CONFIG_BT_SCAN_APPEARANCE_CNT];
 
+	/* Hash table of the appearances. */
+	uint8_t hash[FILTER_HASH_SIZE(CONFIG_BT_SCAN_APPEARANCE_CNT)];
+
 	/* Appearance filter counter. */
 	uint8_t cnt;
 
@@ -155,6 +178,15 @@ struct bt_scan_manufacturer_data_filter {
 		uint8_t data_len;
 	} manufacturer_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
 
+	/* Hash table of the manufacturer data. */
+	uint8_t hash[FILTER_HASH_SIZE(CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT)];
+
+	/* Distinct lengths of the manufacturer data, in ascending order. */
+	uint8_t lens[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
+
+	/* Number of the distinct lengths. */
+	uint8_t lens_cnt;
+
 	/* Name filter counter. */
 	uint8_t cnt;
 
@@ -371,9 +403,6 @@ static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
 {
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
-	char addr_str[BT_ADDR_LE_STR_LEN];
-
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
 
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
@@ -383,13 +412,13 @@ static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
 
 		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
 			LOG_DBG("Device %s is already in the filter array",
-				addr_str);
+				bt_addr_le_str(addr));
 			goto out;
 		}
 	}
 
 	if (filter->count >= ARRAY_SIZE(filter->device)) {
-		LOG_DBG("Force adding %s device filter", addr_str);
+		LOG_DBG("Force adding %s device filter", bt_addr_le_str(addr));
 		attempts_filter_force_add(filter, addr);
 	} else {
 		bt_addr_le_copy(&filter->device[filter->count].addr, addr);
@@ -425,11 +454,8 @@ static void device_conn_attempts_count(struct bt_conn *conn)
 static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
 {
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
-	char addr_str[BT_ADDR_LE_STR_LEN];
 	bool attempts_exceeded = false;
 
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
-
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if the device is in the filter array. */
@@ -439,7 +465,7 @@ static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
 		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
 			if (device->attempts >= CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
 				LOG_DBG("Connection attempts count for %s exceeded",
-					addr_str);
+					bt_addr_le_str(addr));
 				attempts_exceeded = true;
 			}
 
@@ -506,22 +532,77 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 }
 #endif /* CONFIG_BT_CENTRAL */
 
-static bool adv_addr_compare(const bt_addr_le_t *target_addr,
-			     struct bt_scan_control *control)
+/* FNV-1a hash of the filter key. */
+static uint32_t filter_hash_calc(const void *key, size_t len)
 {
-	const bt_addr_le_t *addr =
-			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	const uint8_t *data = key;
+	uint32_t hash = 2166136261U;
 
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	for (size_t i = 0; i < len; i++) {
+		hash ^= data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static void filter_hash_add(uint8_t *table, size_t size, uint32_t hash,
+			    uint8_t idx)
+{
+	size_t slot = hash % size;
+
+	while (table[slot] != FILTER_HASH_SLOT_EMPTY) {
+		slot = (slot + 1) % size;
+	}
+
+	table[slot] = idx + 1;
+}
+
+/* Get the next filter index of the probe sequence. The sequence starts at
+ * the slot given by the key hash and ends with a negative value.
+ */
+static int filter_hash_next(const uint8_t *table, size_t size, size_t *slot)
+{
+	uint8_t entry = table[*slot];
 
-			return true;
+	if (entry == FILTER_HASH_SLOT_EMPTY) {
+		return -ENOENT;
+	}
+
+	*slot = (*slot + 1) % size;
+
+	return entry - 1;
+}
+
+static int addr_filter_find(const bt_addr_le_t *target_addr)
+{
+	const struct bt_scan_addr_filter *addr_filter =
+			&bt_scan.scan_filters.addr;
+	size_t size = ARRAY_SIZE(addr_filter->hash);
+	size_t slot = filter_hash_calc(target_addr, sizeof(*target_addr)) % size;
+	int i;
+
+	while ((i = filter_hash_next(addr_filter->hash, size, &slot)) >= 0) {
+		if (bt_addr_le_cmp(target_addr, &addr_filter->target_addr[i]) == 0) {
+			return i;
 		}
 	}
 
-	return false;
+	return -ENOENT;
+}
+
+static bool adv_addr_compare(const bt_addr_le_t *target_addr,
+			     struct bt_scan_control *control)
+{
+	int i = addr_filter_find(target_addr);
+
+	if (i < 0) {
+		return false;
+	}
+
+	control->filter_status.addr.addr = &bt_scan.scan_filters.addr.target_addr[i];
+
+	return true;
 }
 
 static bool is_addr_filter_enabled(void)
@@ -545,9 +626,8 @@ static void check_addr(struct bt_scan_control *control,
 
 static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 {
-	char addr[BT_ADDR_LE_STR_LEN];
-	bt_addr_le_t *addr_filter =
-			bt_scan.scan_filters.addr.target_addr;
+	struct bt_scan_addr_filter *addr_filter =
+			&bt_scan.scan_filters.addr;
 	uint8_t counter = bt_scan.scan_filters.addr.cnt;
 
 	/* If no memory for filter. */
@@ -556,21 +636,20 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
-			return 0;
-		}
+	if (addr_filter_find(target_addr) >= 0) {
+		return 0;
 	}
 
 	/* Add target address to filter. */
-	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	bt_addr_le_copy(&addr_filter->target_addr[counter], target_addr);
+	filter_hash_add(addr_filter->hash, ARRAY_SIZE(addr_filter->hash),
+			filter_hash_calc(target_addr, sizeof(*target_addr)),
+			counter);
 
 	LOG_DBG("Filter set on address type %i",
-		addr_filter[counter].type);
-
-	bt_addr_le_to_str(target_addr, addr, sizeof(addr));
+		addr_filter->target_addr[counter].type);
 
-	LOG_DBG("Address: %s", addr);
+	LOG_DBG("Address: %s", bt_addr_le_str(target_addr));
 
 	/* Increase the address filter counter. */
 	bt_scan.scan_filters.addr.cnt++;
@@ -585,29 +664,99 @@ static bool adv_name_cmp(const uint8_t *data,
 	return strncmp(target_name, data, data_len) == 0;
 }
 
+typedef const char *(*name_filter_get_t)(size_t idx);
+typedef bool (*name_filter_match_t)(size_t idx, const uint8_t *data,
+				    uint8_t data_len);
+
+/* Insert the filter into the filter indexes sorted by the target name. */
+static void name_index_add(uint8_t *sorted, uint8_t idx, size_t max_len,
+			   name_filter_get_t name_get)
+{
+	const char *name = name_get(idx);
+	size_t pos = idx;
+
+	while ((pos > 0) &&
+	       (strncmp(name_get(sorted[pos - 1]), name, max_len) > 0)) {
+		sorted[pos] = sorted[pos - 1];
+		pos--;
+	}
+
+	sorted[pos] = idx;
+}
+
+/* The advertised name matches the target names it is a prefix of.
+ * These target names are adjacent in the sorted filter indexes, so they are
+ * found with a binary search. If more filters match, the one added first is
+ * returned.
+ */
+static int name_index_find(const uint8_t *sorted, uint8_t cnt, size_t max_len,
+			   name_filter_get_t name_get,
+			   name_filter_match_t name_match,
+			   const uint8_t *data, uint8_t data_len)
+{
+	const char *prefix = (const char *)data;
+	size_t prefix_len = strnlen(prefix, data_len);
+	size_t low = 0;
+	size_t high = cnt;
+	int match = -ENOENT;
+
+	if (prefix_len > max_len) {
+		return -ENOENT;
+	}
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+
+		if (strncmp(name_get(sorted[mid]), prefix, prefix_len) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	for (size_t i = low;
+	     (i < cnt) && (strncmp(name_get(sorted[i]), prefix, prefix_len) == 0);
+	     i++) {
+		if (((match < 0) || (sorted[i] < match)) &&
+		    name_match(sorted[i], data, data_len)) {
+			match = sorted[i];
+		}
+	}
+
+	return match;
+}
+
+static const char *name_filter_get(size_t idx)
+{
+	return bt_scan.scan_filters.name.target_name[idx];
+}
+
+static bool name_filter_match(size_t idx, const uint8_t *data,
+			      uint8_t data_len)
+{
+	return adv_name_cmp(data, data_len, name_filter_get(idx));
+}
+
 static bool adv_name_compare(const struct bt_data *data,
 			     struct bt_scan_control *control)
 {
 	struct bt_scan_name_filter const *name_filter =
 			&bt_scan.scan_filters.name;
-	uint8_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
+	int i;
 
 	/* Compare the name found with the name filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_name_cmp(data->data,
-				 data_len,
-				 name_filter->target_name[i])) {
-
-			control->filter_status.name.name =
-				name_filter->target_name[i];
-			control->filter_status.name.len = data_len;
-
-			return true;
-		}
+	i = name_index_find(name_filter->sorted, name_filter->cnt,
+			    CONFIG_BT_SCAN_NAME_MAX_LEN, name_filter_get,
+			    name_filter_match, data->data, data_len);
+	if (i < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.name.name = name_filter->target_name[i];
+	control->filter_status.name.len = data_len;
+
+	return true;
 }
 
 static inline bool is_name_filter_enabled(void)
@@ -656,6 +805,12 @@ static int scan_name_filter_add(const char *name)
 	/* Add name to filter. */
 	memcpy(bt_scan.scan_filters.name.target_name[counter],
 	       name, name_len);
+	if (name_len < CONFIG_BT_SCAN_NAME_MAX_LEN) {
+		bt_scan.scan_filters.name.target_name[counter][name_len] = '\0';
+	}
+
+	name_index_add(bt_scan.scan_filters.name.sorted, counter,
+		       CONFIG_BT_SCAN_NAME_MAX_LEN, name_filter_get);
 
 	bt_scan.scan_filters.name.cnt++;
 
@@ -677,30 +832,41 @@ static bool adv_short_name_cmp(const uint8_t *data,
 	return false;
 }
 
+static const char *short_name_filter_get(size_t idx)
+{
+	return bt_scan.scan_filters.short_name.name[idx].target_name;
+}
+
+static bool short_name_filter_match(size_t idx, const uint8_t *data,
+				    uint8_t data_len)
+{
+	return adv_short_name_cmp(data, data_len,
+				  short_name_filter_get(idx),
+				  bt_scan.scan_filters.short_name.name[idx].min_len);
+}
+
 static bool adv_short_name_compare(const struct bt_data *data,
 				   struct bt_scan_control *control)
 {
 	const struct bt_scan_short_name_filter *name_filter =
 			&bt_scan.scan_filters.short_name;
-	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
 	uint8_t data_len = data->data_len;
+	int i;
 
 	/* Compare the name found with the name filters. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_short_name_cmp(data->data,
-				       data_len,
-				       name_filter->name[i].target_name,
-				       name_filter->name[i].min_len)) {
-
-			control->filter_status.short_name.name =
-				name_filter->name[i].target_name;
-			control->filter_status.short_name.len = data_len;
-
-			return true;
-		}
+	i = name_index_find(name_filter->sorted, name_filter->cnt,
+			    CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN,
+			    short_name_filter_get, short_name_filter_match,
+			    data->data, data_len);
+	if (i < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.short_name.name =
+		name_filter->name[i].target_name;
+	control->filter_status.short_name.len = data_len;
+
+	return true;
 }
 
 static inline bool is_short_name_filter_enabled(void)
@@ -756,6 +922,12 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	memcpy(short_name_filter->name[counter].target_name,
 	       short_name->name,
 	       name_len);
+	if (name_len < CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN) {
+		short_name_filter->name[counter].target_name[name_len] = '\0';
+	}
+
+	name_index_add(short_name_filter->sorted, counter,
+		       CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN, short_name_filter_get);
 
 	bt_scan.scan_filters.short_name.cnt++;
 
@@ -764,43 +936,62 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+/* The hash table key of the UUID is its 128-bit form, so that the UUIDs of
+ * different types that bt_uuid_cmp considers equal share the key.
+ */
+static void uuid_key_get(const struct bt_uuid *uuid,
+			 uint8_t key[BT_SCAN_UUID_128_SIZE])
 {
-	uint8_t uuid_len;
+	static const uint8_t uuid_base[BT_SCAN_UUID_128_SIZE] = {
+		BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x1000, 0x8000,
+				   0x00805F9B34FB)
+	};
 
-	switch (uuid_type) {
+	switch (uuid->type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
+		memcpy(key, uuid_base, sizeof(uuid_base));
+		sys_put_le32(BT_UUID_16(uuid)->val, &key[12]);
 		break;
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
+		memcpy(key, uuid_base, sizeof(uuid_base));
+		sys_put_le32(BT_UUID_32(uuid)->val, &key[12]);
 		break;
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
+		memcpy(key, BT_UUID_128(uuid)->val, BT_SCAN_UUID_128_SIZE);
 		break;
 
 	default:
-		return false;
+		memset(key, 0, BT_SCAN_UUID_128_SIZE);
+		break;
 	}
+}
 
-	for (size_t i = 0; i < data_len; i += uuid_len) {
-		struct bt_uuid_128 uuid;
+static uint32_t uuid_hash_calc(const struct bt_uuid *uuid)
+{
+	uint8_t key[BT_SCAN_UUID_128_SIZE];
 
-		if (!bt_uuid_create(&uuid.uuid, &data[i], uuid_len)) {
-			return false;
-		}
+	uuid_key_get(uuid, key);
 
-		if (bt_uuid_cmp(&uuid.uuid, target_uuid->uuid) == 0) {
-			return true;
+	return filter_hash_calc(key, sizeof(key));
+}
+
+static int uuid_filter_find(const struct bt_uuid *uuid)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	size_t size = ARRAY_SIZE(uuid_filter->hash);
+	size_t slot = uuid_hash_calc(uuid) % size;
+	int i;
+
+	while ((i = filter_hash_next(uuid_filter->hash, size, &slot)) >= 0) {
+		if (bt_uuid_cmp(uuid_filter->uuid[i].uuid, uuid) == 0) {
+			return i;
 		}
 	}
 
-	return false;
+	return -ENOENT;
 }
 
 static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
@@ -812,11 +1003,46 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
 	uint8_t data_len = data->data_len;
 	uint8_t uuid_match_cnt = 0;
+	bool found[CONFIG_BT_SCAN_UUID_CNT];
+	uint8_t uuid_len;
+
+	switch (uuid_type) {
+	case BT_UUID_TYPE_16:
+		uuid_len = sizeof(uint16_t);
+		break;
+
+	case BT_UUID_TYPE_32:
+		uuid_len = sizeof(uint32_t);
+		break;
+
+	case BT_UUID_TYPE_128:
+		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
+		break;
+
+	default:
+		return false;
+	}
+
+	memset(found, 0, sizeof(found));
+
+	/* Look up every advertised UUID in the filters. */
+	for (size_t i = 0; (i + uuid_len) <= data_len; i += uuid_len) {
+		struct bt_uuid_128 uuid;
+		int idx;
+
+		if (!bt_uuid_create(&uuid.uuid, &data->data[i], uuid_len)) {
+			break;
+		}
+
+		idx = uuid_filter_find(&uuid.uuid);
+		if (idx >= 0) {
+			found[idx] = true;
+		}
+	}
 
 	for (size_t i = 0; i < counter; i++) {
 
-		if (find_uuid(data->data, data_len, uuid_type,
-			      &uuid_filter->uuid[i])) {
+		if (found[i]) {
 			control->filter_status.uuid.uuid[uuid_match_cnt] =
 				uuid_filter->uuid[i].uuid;
 
@@ -880,11 +1106,15 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -ENOMEM;
 	}
 
+	if ((uuid->type != BT_UUID_TYPE_16) &&
+	    (uuid->type != BT_UUID_TYPE_32) &&
+	    (uuid->type != BT_UUID_TYPE_128)) {
+		return -EINVAL;
+	}
+
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_uuid_cmp(uuid_filter[i].uuid, uuid) == 0) {
-			return 0;
-		}
+	if (uuid_filter_find(uuid) >= 0) {
+		return 0;
 	}
 
 	/* Add UUID to the filter. */
@@ -917,55 +1147,54 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+	filter_hash_add(bt_scan.scan_filters.uuid.hash,
+			ARRAY_SIZE(bt_scan.scan_filters.uuid.hash),
+			uuid_hash_calc(uuid), counter);
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
 	return 0;
 }
 
-static bool find_appearance(const uint8_t *data,
-			    uint8_t data_len,
-			    const uint16_t *appearance)
+static int appearance_filter_find(uint16_t appearance)
 {
-	if (data_len != sizeof(uint16_t)) {
-		return false;
-	}
-
-	uint16_t decoded_appearance = sys_get_be16(data);
+	const struct bt_scan_appearance_filter *appearance_filter =
+			&bt_scan.scan_filters.appearance;
+	size_t size = ARRAY_SIZE(appearance_filter->hash);
+	size_t slot = filter_hash_calc(&appearance, sizeof(appearance)) % size;
+	int i;
 
-	if (decoded_appearance == *appearance) {
-		return true;
+	while ((i = filter_hash_next(appearance_filter->hash, size, &slot)) >= 0) {
+		if (appearance_filter->appearance[i] == appearance) {
+			return i;
+		}
 	}
 
-	/* Could not find the appearance among the encoded data. */
-	return false;
+	return -ENOENT;
 }
 
 static bool adv_appearance_compare(const struct bt_data *data,
 				   struct bt_scan_control *control)
 {
-	const struct bt_scan_appearance_filter *appearance_filter =
-			&bt_scan.scan_filters.appearance;
-	const uint8_t counter =
-			bt_scan.scan_filters.appearance.cnt;
-	uint8_t data_len = data->data_len;
+	int i;
+
+	if (data->data_len != sizeof(uint16_t)) {
+		return false;
+	}
 
 	/* Verify if the advertised appearance matches
 	 * the provided appearance.
 	 */
-	for (size_t i = 0; i < counter; i++) {
-		if (find_appearance(data->data,
-				    data_len,
-				    &appearance_filter->appearance[i])) {
-
-			control->filter_status.appearance.appearance =
-					&appearance_filter->appearance[i];
-
-			return true;
-		}
+	i = appearance_filter_find(sys_get_be16(data->data));
+	if (i < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.appearance.appearance =
+			&bt_scan.scan_filters.appearance.appearance[i];
+
+	return true;
 }
 
 static inline bool is_appearance_filter_enabled(void)
@@ -998,14 +1227,16 @@ static int scan_appearance_filter_add(uint16_t appearance)
 	}
 
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (appearance_filter[i] == appearance) {
-			return 0;
-		}
+	if (appearance_filter_find(appearance) >= 0) {
+		return 0;
 	}
 
 	/* Add appearance to the filter. */
 	appearance_filter[counter] = appearance;
+	filter_hash_add(bt_scan.scan_filters.appearance.hash,
+			ARRAY_SIZE(bt_scan.scan_filters.appearance.hash),
+			filter_hash_calc(&appearance, sizeof(appearance)),
+			counter);
 	bt_scan.scan_filters.appearance.cnt++;
 
 	LOG_DBG("Added filter on appearance %x", appearance);
@@ -1013,20 +1244,62 @@ static int scan_appearance_filter_add(uint16_t appearance)
 	return 0;
 }
 
-static bool adv_manufacturer_data_cmp(const uint8_t *data,
-				      uint8_t data_len,
-				      const uint8_t *target_data,
-				      uint8_t target_data_len)
+/* The manufacturer data matches the filters whose data is its prefix.
+ * The prefix of every length used by the filters is looked up in the hash
+ * table. If more filters match, the one added first is returned.
+ */
+static int manufacturer_data_filter_find(const uint8_t *data, uint8_t data_len)
 {
-	if (target_data_len > data_len) {
-		return false;
+	const struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+	size_t size = ARRAY_SIZE(md_filter->hash);
+	int match = -ENOENT;
+
+	for (size_t i = 0; i < md_filter->lens_cnt; i++) {
+		uint8_t len = md_filter->lens[i];
+		size_t slot;
+		int idx;
+
+		if (len > data_len) {
+			break;
+		}
+
+		slot = filter_hash_calc(data, len) % size;
+
+		while ((idx = filter_hash_next(md_filter->hash, size, &slot)) >= 0) {
+			if ((md_filter->manufacturer_data[idx].data_len == len) &&
+			    (memcmp(md_filter->manufacturer_data[idx].data, data, len) == 0)) {
+				if ((match < 0) || (idx < match)) {
+					match = idx;
+				}
+
+				break;
+			}
+		}
 	}
 
-	if (memcmp(target_data, data, target_data_len) != 0) {
-		return false;
+	return match;
+}
+
+static void manufacturer_data_len_add(uint8_t len)
+{
+	struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+	size_t pos = md_filter->lens_cnt;
+
+	for (size_t i = 0; i < md_filter->lens_cnt; i++) {
+		if (md_filter->lens[i] == len) {
+			return;
+		}
 	}
 
-	return true;
+	while ((pos > 0) && (md_filter->lens[pos - 1] > len)) {
+		md_filter->lens[pos] = md_filter->lens[pos - 1];
+		pos--;
+	}
+
+	md_filter->lens[pos] = len;
+	md_filter->lens_cnt++;
 }
 
 static bool adv_manufacturer_data_compare(const struct bt_data *data,
@@ -1034,25 +1307,20 @@ static bool adv_manufacturer_data_compare(const struct bt_data *data,
 {
 	const struct bt_scan_manufacturer_data_filter *md_filter =
 		&bt_scan.scan_filters.manufacturer_data;
-	uint8_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
-
-	/* Compare the name found with the name filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_manufacturer_data_cmp(data->data,
-				data->data_len,
-				md_filter->manufacturer_data[i].data,
-				md_filter->manufacturer_data[i].data_len)) {
+	int i;
 
-			control->filter_status.manufacturer_data.data =
-				md_filter->manufacturer_data[i].data;
-			control->filter_status.manufacturer_data.len =
-				md_filter->manufacturer_data[i].data_len;
-
-			return true;
-		}
+	/* Compare the manufacturer data found with the filter. */
+	i = manufacturer_data_filter_find(data->data, data->data_len);
+	if (i < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.manufacturer_data.data =
+		md_filter->manufacturer_data[i].data;
+	control->filter_status.manufacturer_data.len =
+		md_filter->manufacturer_data[i].data_len;
+
+	return true;
 }
 static inline bool is_manufacturer_data_filter_enabled(void)
 {
@@ -1092,14 +1360,12 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 		return -EINVAL;
 	}
 
-	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (adv_manufacturer_data_cmp(manufacturer_data->data,
-				manufacturer_data->data_len,
-				md_filter->manufacturer_data[i].data,
-				md_filter->manufacturer_data[i].data_len)) {
-			return 0;
-		}
+	/* Check for duplicated filter. A filter whose data is a prefix of
+	 * the new data already matches everything the new filter would.
+	 */
+	if (manufacturer_data_filter_find(manufacturer_data->data,
+					  manufacturer_data->data_len) >= 0) {
+		return 0;
 	}
 
 	/* Add manufacturer data to filter. */
@@ -1107,6 +1373,11 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 			manufacturer_data->data, manufacturer_data->data_len);
 	md_filter->manufacturer_data[counter].data_len =
 		manufacturer_data->data_len;
+	filter_hash_add(md_filter->hash, ARRAY_SIZE(md_filter->hash),
+			filter_hash_calc(manufacturer_data->data,
+					 manufacturer_data->data_len),
+			counter);
+	manufacturer_data_len_add(manufacturer_data->data_len);
 
 	bt_scan.scan_filters.manufacturer_data.cnt++;
 
@@ -1229,18 +1500,24 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+	memset(addr_filter->hash, 0, sizeof(addr_filter->hash));
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	uuid_filter->cnt = 0;
+	memset(uuid_filter->hash, 0, sizeof(uuid_filter->hash));
 
 	struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
 	appearance_filter->cnt = 0;
+	memset(appearance_filter->hash, 0, sizeof(appearance_filter->hash));
 
 	struct bt_scan_manufacturer_data_filter *manufacturer_data_filter =
 		&bt_scan.scan_filters.manufacturer_data;
 	manufacturer_data_filter->cnt = 0;
+	manufacturer_data_filter->lens_cnt = 0;
+	memset(manufacturer_data_filter->hash, 0,
+	       sizeof(manufacturer_data_filter->hash));
 
 	k_mutex_unlock(&scan_mutex);
 }
@@ -1578,21 +1855,18 @@ int bt_scan_params_set(struct bt_le_scan_param *scan_param)
 int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 {
 	int err = 0;
-	char addr_str[BT_ADDR_LE_STR_LEN];
 
 	if (!addr) {
 		return -EINVAL;
 	}
 
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
-
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if the device is already on the blocklist. */
 	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.blocklist.addr); i++) {
 		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
 			LOG_DBG("Device %s is already on the blocklist",
-				addr_str);
+				bt_addr_le_str(addr));
 
 			goto out;
 		}
@@ -1605,7 +1879,8 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
 		bt_scan.blocklist.count++;
-		LOG_INF("Device %s added to the scanning blocklist", addr_str);
+		LOG_INF("Device %s added to the scanning blocklist",
+			bt_addr_le_str(addr));
 	}
 
 out:
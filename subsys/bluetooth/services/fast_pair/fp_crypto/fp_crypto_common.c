@@ -89,7 +89,8 @@ size_t fp_crypto_account_key_filter_size(size_t n)
 	if (n == 0) {
 		return 0;
 	} else {
-		return 1.2 * n + 3;
+		/* Integer form of 1.2 * n + 3 that avoids floating-point arithmetic. */
+		return (6 * n) / 5 + 3;
 	}
 }
 
@@ -101,22 +102,21 @@ int fp_crypto_account_key_filter(uint8_t *out, const struct fp_account_key *acco
 	uint8_t h[FP_CRYPTO_SHA256_HASH_LEN];
 	uint32_t x;
 	uint32_t m;
+	size_t pos = FP_ACCOUNT_KEY_LEN;
 	int err;
 
+	/* The salt and battery info are the same for every Account Key. */
+	sys_put_be16(salt, &v[pos]);
+	pos += sizeof(salt);
+
+	if (battery_info) {
+		memcpy(&v[pos], battery_info, FP_CRYPTO_BATTERY_INFO_LEN);
+		pos += FP_CRYPTO_BATTERY_INFO_LEN;
+	}
+
 	memset(out, 0, s);
 	for (size_t i = 0; i < n; i++) {
-		size_t pos = 0;
-
 		memcpy(v, account_key_list[i].key, FP_ACCOUNT_KEY_LEN);
-		pos += FP_ACCOUNT_KEY_LEN;
-
-		sys_put_be16(salt, &v[pos]);
-		pos += sizeof(salt);
-
-		if (battery_info) {
-			memcpy(&v[pos], battery_info, FP_CRYPTO_BATTERY_INFO_LEN);
-			pos += FP_CRYPTO_BATTERY_INFO_LEN;
-		}
 
 		err = fp_crypto_sha256(h, v, pos);
 		if (err) {
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
+
 #include "fp_crypto.h"
 
 #include <ocrypto_hmac_sha256.h>
@@ -46,6 +48,26 @@ int fp_crypto_aes128_ecb_decrypt(uint8_t *out, const uint8_t *in, const uint8_t
 	return 0;
 }
 
+int fp_crypto_aes128_ecb_dec_key_set(struct fp_crypto_aes128_ecb_dec_key *dec_key,
+				     const uint8_t *k)
+{
+	/* Oberon does not expose the AES key schedule. */
+	memcpy(dec_key->key, k, sizeof(dec_key->key));
+
+	return 0;
+}
+
+int fp_crypto_aes128_ecb_decrypt_prepared(uint8_t *out, const uint8_t *in,
+					  struct fp_crypto_aes128_ecb_dec_key *dec_key)
+{
+	return fp_crypto_aes128_ecb_decrypt(out, in, dec_key->key);
+}
+
+void fp_crypto_aes128_ecb_dec_key_clear(struct fp_crypto_aes128_ecb_dec_key *dec_key)
+{
+	memset(dec_key, 0, sizeof(*dec_key));
+}
+
 int fp_crypto_ecdh_shared_secret(uint8_t *secret_key,
 				 const uint8_t *public_key,
 				 const uint8_t *private_key)
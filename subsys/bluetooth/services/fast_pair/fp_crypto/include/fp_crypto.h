@@ -9,6 +9,12 @@
 
 #include <zephyr/types.h>
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_TINYCRYPT)
+#include <tinycrypt/aes.h>
+#elif defined(CONFIG_BT_FAST_PAIR_CRYPTO_MBEDTLS)
+#include <mbedtls/aes.h>
+#endif
+
 #include "fp_common.h"
 
 /**
@@ -39,6 +45,21 @@ extern "C" {
 /** Length of battery info (1-byte length and type field and 3-byte battery values field). */
 #define FP_CRYPTO_BATTERY_INFO_LEN		4U
 
+/** AES-128 key prepared for repeated AES-128-ECB decryption.
+ *
+ * The content depends on the cryptographic backend. A backend that does not expose the key
+ * schedule keeps the raw key and expands it during every decryption.
+ */
+struct fp_crypto_aes128_ecb_dec_key {
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_TINYCRYPT)
+	struct tc_aes_key_sched_struct sched;
+#elif defined(CONFIG_BT_FAST_PAIR_CRYPTO_MBEDTLS)
+	mbedtls_aes_context ctx;
+#else
+	uint8_t key[FP_CRYPTO_AES128_KEY_LEN];
+#endif
+};
+
 /** Hash value using SHA-256.
  *
  * @param[out] out 256-bit (32-byte) buffer to receive hashed result.
@@ -85,6 +106,35 @@ int fp_crypto_aes128_ecb_encrypt(uint8_t *out, const uint8_t *in, const uint8_t
  */
 int fp_crypto_aes128_ecb_decrypt(uint8_t *out, const uint8_t *in, const uint8_t *k);
 
+/** Prepare AES-128 key for AES-128-ECB decryption.
+ *
+ * The prepared key must be released with @ref fp_crypto_aes128_ecb_dec_key_clear.
+ *
+ * @param[out] dec_key Prepared key.
+ * @param[in] k 128-bit (16-byte) AES key.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_aes128_ecb_dec_key_set(struct fp_crypto_aes128_ecb_dec_key *dec_key,
+				     const uint8_t *k);
+
+/** Decrypt message using AES-128-ECB and the prepared key.
+ *
+ * @param[out] out 128-bit (16-byte) buffer to receive plaintext message.
+ * @param[in] in 128-bit (16-byte) ciphertext message.
+ * @param[in] dec_key Key prepared with @ref fp_crypto_aes128_ecb_dec_key_set.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_aes128_ecb_decrypt_prepared(uint8_t *out, const uint8_t *in,
+					  struct fp_crypto_aes128_ecb_dec_key *dec_key);
+
+/** Release and erase the prepared AES-128 key.
+ *
+ * @param[in] dec_key Key prepared with @ref fp_crypto_aes128_ecb_dec_key_set.
+ */
+void fp_crypto_aes128_ecb_dec_key_clear(struct fp_crypto_aes128_ecb_dec_key *dec_key);
+
 /** Encrypt data using AES-128-CTR.
  *
  * @param[out] out Buffer to receive encrypted data.
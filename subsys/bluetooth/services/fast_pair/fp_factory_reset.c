@@ -6,9 +6,14 @@
 
 #include <bluetooth/services/fast_pair.h>
 
+#include "fp_keys.h"
 #include "fp_storage.h"
 
 int bt_fast_pair_factory_reset(void)
 {
+	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_KEYS)) {
+		fp_keys_account_key_cache_clear();
+	}
+
 	return fp_storage_factory_reset();
 }
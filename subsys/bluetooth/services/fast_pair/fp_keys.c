@@ -50,9 +50,10 @@ struct fp_procedure {
 	uint8_t aes_key[FP_ACCOUNT_KEY_LEN];
 };
 
-struct fp_key_gen_account_key_check_context {
-	const struct bt_conn *conn;
-	struct fp_keys_keygen_params *keygen_params;
+struct account_key_cache_entry {
+	struct fp_account_key account_key;
+	struct fp_crypto_aes128_ecb_dec_key dec_key;
+	bool valid;
 };
 
 static uint8_t key_gen_failure_cnt;
@@ -61,6 +62,10 @@ static struct k_work_delayable key_gen_failure_cnt_reset;
 static bool user_pairing_mode = true;
 static struct fp_procedure fp_procedures[CONFIG_BT_MAX_CONN];
 
+/* Stored Account Keys prepared for decryption, in the order used by the Account Key storage. */
+static struct account_key_cache_entry
+	account_key_cache[CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX];
+
 
 void bt_fast_pair_set_pairing_mode(bool pairing_mode)
 {
@@ -220,42 +225,93 @@ static int key_gen_public_key(const struct bt_conn *conn,
 	return err;
 }
 
-static bool key_gen_account_key_check(const struct fp_account_key *account_key, void *context)
+static void account_key_cache_entry_clear(struct account_key_cache_entry *entry)
+{
+	if (entry->valid) {
+		fp_crypto_aes128_ecb_dec_key_clear(&entry->dec_key);
+		memset(&entry->account_key, 0, sizeof(entry->account_key));
+		entry->valid = false;
+	}
+}
+
+static int account_key_cache_sync(const struct fp_account_key *account_keys, size_t count)
 {
 	int err;
-	uint8_t req[FP_CRYPTO_AES128_BLOCK_LEN];
-	struct fp_key_gen_account_key_check_context *ak_check_context = context;
-	const struct bt_conn *conn = ak_check_context->conn;
-	struct fp_keys_keygen_params *keygen_params = ak_check_context->keygen_params;
-	struct fp_procedure *proc = &fp_procedures[bt_conn_index(conn)];
 
-	memcpy(proc->aes_key, account_key->key, FP_ACCOUNT_KEY_LEN);
+	for (size_t i = 0; i < ARRAY_SIZE(account_key_cache); i++) {
+		struct account_key_cache_entry *entry = &account_key_cache[i];
 
-	err = fp_keys_decrypt(conn, req, keygen_params->req_enc);
-	if (err) {
-		return false;
-	}
+		if ((i < count) && entry->valid &&
+		    !memcmp(&entry->account_key, &account_keys[i], sizeof(account_keys[i]))) {
+			continue;
+		}
 
-	err = keygen_params->req_validate_cb(conn, req, keygen_params->context);
-	if (err) {
-		return false;
+		account_key_cache_entry_clear(entry);
+
+		if (i >= count) {
+			continue;
+		}
+
+		err = fp_crypto_aes128_ecb_dec_key_set(&entry->dec_key, account_keys[i].key);
+		if (err) {
+			return err;
+		}
+
+		entry->account_key = account_keys[i];
+		entry->valid = true;
 	}
 
-	return true;
+	return 0;
+}
+
+void fp_keys_account_key_cache_clear(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(account_key_cache); i++) {
+		account_key_cache_entry_clear(&account_key_cache[i]);
+	}
 }
 
 static int key_gen_account_key(const struct bt_conn *conn,
 			       struct fp_keys_keygen_params *keygen_params)
 {
-	struct fp_key_gen_account_key_check_context context = {
-		.conn = conn,
-		.keygen_params = keygen_params,
-	};
+	int err;
+	uint8_t req[FP_CRYPTO_AES128_BLOCK_LEN];
+	struct fp_account_key account_keys[ARRAY_SIZE(account_key_cache)];
+	size_t account_key_count = ARRAY_SIZE(account_keys);
+	struct fp_procedure *proc = &fp_procedures[bt_conn_index(conn)];
 
-	/* This function call assigns the Account Key internally to the Fast Pair Keys
-	 * module. The assignment happens in the provided callback method.
+	err = fp_storage_ak_get(account_keys, &account_key_count);
+	if (err) {
+		return err;
+	}
+
+	/* The stored Account Keys rarely change. Their AES key schedules are expanded only when
+	 * a key is added or replaced, and not for every Key-based Pairing request.
 	 */
-	return fp_storage_ak_find(NULL, key_gen_account_key_check, &context);
+	err = account_key_cache_sync(account_keys, account_key_count);
+	if (err) {
+		return err;
+	}
+
+	for (size_t i = 0; i < account_key_count; i++) {
+		struct account_key_cache_entry *entry = &account_key_cache[i];
+
+		err = fp_crypto_aes128_ecb_decrypt_prepared(req, keygen_params->req_enc,
+							    &entry->dec_key);
+		if (err) {
+			continue;
+		}
+
+		/* Assign the Account Key to the procedure before the request is validated. */
+		memcpy(proc->aes_key, entry->account_key.key, FP_ACCOUNT_KEY_LEN);
+
+		err = keygen_params->req_validate_cb(conn, req, keygen_params->context);
+		if (!err) {
+			return 0;
+		}
+	}
+
+	return -ESRCH;
 }
 
 int fp_keys_generate_key(const struct bt_conn *conn, struct fp_keys_keygen_params *keygen_params)
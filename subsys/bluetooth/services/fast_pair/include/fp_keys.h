@@ -178,6 +178,13 @@ void fp_keys_bt_auth_progress(const struct bt_conn *conn, bool authenticated);
  */
 void fp_keys_drop_key(const struct bt_conn *conn);
 
+/** Erase Account Keys prepared for decryption.
+ *
+ * The function must be called when the stored Account Keys are removed to make sure that no copy
+ * of the keys is left in RAM.
+ */
+void fp_keys_account_key_cache_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
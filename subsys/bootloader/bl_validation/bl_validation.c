@@ -116,6 +116,9 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 #include <zephyr/toolchain.h>
 #include <bl_crypto.h>
 #include "bl_validation_internal.h"
+#ifdef CONFIG_SB_VALIDATION_CACHE
+#include "bl_validation_cache.h"
+#endif
 
 #if USE_PARTITION_MANAGER
 #include <pm_config.h>
@@ -196,7 +199,7 @@ validation_info_find(uint32_t start_address, uint32_t search_distance)
 #ifdef CONFIG_SB_VALIDATE_FW_SIGNATURE
 static bool validate_signature(const uint32_t fw_src_address, const uint32_t fw_size,
 			       const struct fw_validation_info *fw_val_info,
-			       bool external)
+			       bool external, uint32_t *key_idx_out)
 {
 	int init_retval = bl_crypto_init();
 
@@ -254,6 +257,9 @@ static bool validate_signature(const uint32_t fw_src_address, const uint32_t fw_
 				invalidate_public_key(i);
 			}
 			PRINT("Firmware signature verified.\n\r");
+			if (key_idx_out) {
+				*key_idx_out = key_data_idx;
+			}
 			return true;
 		} else if (retval == -EHASHINV) {
 			PRINT("Public key didn't match, try next.\n\r");
@@ -269,6 +275,61 @@ static bool validate_signature(const uint32_t fw_src_address, const uint32_t fw_
 	return false;
 }
 
+#ifdef CONFIG_SB_VALIDATION_CACHE
+static int firmware_hash_get(const uint32_t fw_src_address, const uint32_t fw_size,
+			     uint8_t *fw_hash)
+{
+	bl_sha256_ctx_t ctx;
+	int retval = bl_crypto_init();
+
+	if (!retval) {
+		retval = bl_sha256_init(&ctx);
+	}
+	if (!retval) {
+		retval = bl_sha256_update(&ctx, (const uint8_t *)fw_src_address, fw_size);
+	}
+	if (!retval) {
+		retval = bl_sha256_finalize(&ctx, fw_hash);
+	}
+
+	return retval;
+}
+
+/* Skip the signature verification if the same firmware was validated on an
+ * earlier boot. The firmware is still hashed in full, so any change to it
+ * results in a full validation.
+ */
+static bool validate_signature_cached(const uint32_t fw_src_address,
+				      const struct fw_info *fwinfo,
+				      const struct fw_validation_info *fw_val_info)
+{
+	const bool external = false;
+	uint8_t fw_hash[CONFIG_SB_HASH_LEN];
+	uint32_t key_idx;
+	int retval = firmware_hash_get(fw_src_address, fwinfo->size, fw_hash);
+
+	if (retval) {
+		PRINT("Failed to hash the firmware: %d, skipping cache.\n\r", retval);
+		return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
+					  external, NULL);
+	}
+
+	if (validation_cache_check(fwinfo, fw_hash)) {
+		PRINT("Firmware signature verified by validation cache.\n\r");
+		return true;
+	}
+
+	if (!validate_signature(fw_src_address, fwinfo->size, fw_val_info, external,
+				&key_idx)) {
+		return false;
+	}
+
+	validation_cache_store(fwinfo, fw_hash, key_idx);
+
+	return true;
+}
+#endif
+
 
 #elif defined(CONFIG_SB_VALIDATE_FW_HASH)
 static bool validate_hash(const uint32_t fw_src_address, const uint32_t fw_size,
@@ -408,8 +469,13 @@ static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 	}
 
 #ifdef CONFIG_SB_VALIDATE_FW_SIGNATURE
+#ifdef CONFIG_SB_VALIDATION_CACHE
+	if (!external) {
+		return validate_signature_cached(fw_src_address, fwinfo, fw_val_info);
+	}
+#endif
 	return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
-				external);
+				external, NULL);
 #elif defined(CONFIG_SB_VALIDATE_FW_HASH)
 	return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
 				external);
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/toolchain.h>
+#include <bl_crypto.h>
+#include <bl_storage.h>
+#include <fw_info.h>
+#include <hw_unique_key.h>
+#include <nrfx_nvmc.h>
+#include <ocrypto_constant_time.h>
+#include <pm_config.h>
+#include "bl_validation_cache.h"
+
+#ifdef HUK_HAS_KMU
+#define CACHE_KEYSLOT HUK_KEYSLOT_MKEK
+#else
+#define CACHE_KEYSLOT HUK_KEYSLOT_KDR
+#endif
+
+#define CACHE_ADDRESS     PM_B0_VALIDATION_CACHE_ADDRESS
+#define CACHE_MAGIC       0x56434143 /* "CACV" */
+#define CACHE_SLOT_COUNT  2
+#define MAC_KEY_LEN       32
+#define MAC_LEN           32
+#define HMAC_BLOCK_LEN    64
+
+/* Label used for deriving the MAC key from the hardware unique key. */
+static const uint8_t mac_key_label[] = "NSIB validation cache";
+
+struct __packed cache_record {
+	uint32_t magic;
+	uint32_t address;
+	uint32_t size;
+	uint32_t version;
+	uint32_t key_idx;
+	uint8_t  fw_hash[CONFIG_SB_HASH_LEN];
+	uint8_t  mac[MAC_LEN];
+};
+
+BUILD_ASSERT((sizeof(struct cache_record) % sizeof(uint32_t)) == 0,
+	     "Cache records must be written in whole words.");
+BUILD_ASSERT((CACHE_SLOT_COUNT * sizeof(struct cache_record)) <=
+	     PM_B0_VALIDATION_CACHE_SIZE, "The validation cache partition is too small.");
+
+static const struct cache_record *const cache =
+	(const struct cache_record *)CACHE_ADDRESS;
+
+static uint32_t slot_get(const struct fw_info *fwinfo)
+{
+	return (fwinfo->address == s1_address_read()) ? 1 : 0;
+}
+
+/* One pass of HMAC-SHA256: H((key ^ pad) | data1 | data2). */
+static int hmac_pass(const uint8_t *key, uint8_t pad_val, const uint8_t *data1, uint32_t len1,
+		     const uint8_t *data2, uint32_t len2, uint8_t *output)
+{
+	bl_sha256_ctx_t ctx;
+	uint8_t pad[HMAC_BLOCK_LEN];
+	int err;
+
+	memset(pad, pad_val, sizeof(pad));
+	for (size_t i = 0; i < MAC_KEY_LEN; i++) {
+		pad[i] ^= key[i];
+	}
+
+	err = bl_sha256_init(&ctx);
+	if (!err) {
+		err = bl_sha256_update(&ctx, pad, sizeof(pad));
+	}
+	if (!err) {
+		err = bl_sha256_update(&ctx, data1, len1);
+	}
+	if (!err && data2) {
+		err = bl_sha256_update(&ctx, data2, len2);
+	}
+	if (!err) {
+		err = bl_sha256_finalize(&ctx, output);
+	}
+
+	memset(pad, 0, sizeof(pad));
+
+	return err;
+}
+
+/* HMAC-SHA256 over the record, excluding the MAC itself, and the hash of the
+ * public key that verified the signature. The key is derived from the
+ * hardware unique key, so records cannot be forged or moved between devices.
+ */
+static int record_mac_get(const struct cache_record *record, const uint8_t *key_data,
+			  uint8_t *mac)
+{
+	uint8_t key[MAC_KEY_LEN];
+	uint8_t inner[CONFIG_SB_HASH_LEN];
+	int err;
+
+	err = hw_unique_key_derive_key(CACHE_KEYSLOT, NULL, 0, mac_key_label,
+				       sizeof(mac_key_label) - 1, key, sizeof(key));
+	if (err != HW_UNIQUE_KEY_SUCCESS) {
+		return -EFAULT;
+	}
+
+	err = hmac_pass(key, 0x36, (const uint8_t *)record, offsetof(struct cache_record, mac),
+			key_data, SB_PUBLIC_KEY_HASH_LEN, inner);
+	if (!err) {
+		err = hmac_pass(key, 0x5c, inner, sizeof(inner), NULL, 0, mac);
+	}
+
+	memset(key, 0, sizeof(key));
+
+	return err;
+}
+
+bool validation_cache_check(const struct fw_info *fwinfo, const uint8_t *fw_hash)
+{
+	const struct cache_record *record = &cache[slot_get(fwinfo)];
+	/* Some key data storage backends require word sized reads, hence
+	 * we need to ensure word alignment for 'key_data'
+	 */
+	__aligned(4) uint8_t key_data[SB_PUBLIC_KEY_HASH_LEN];
+	uint8_t mac[MAC_LEN];
+
+	if ((record->magic != CACHE_MAGIC) ||
+	    (record->address != fwinfo->address) ||
+	    (record->size != fwinfo->size) ||
+	    (record->version != fwinfo->version) ||
+	    !ocrypto_constant_time_equal(record->fw_hash, fw_hash, CONFIG_SB_HASH_LEN)) {
+		return false;
+	}
+
+	/* The key may have been invalidated after the record was stored. */
+	if ((record->key_idx >= num_public_keys_read()) ||
+	    (public_key_data_read(record->key_idx, key_data) != SB_PUBLIC_KEY_HASH_LEN)) {
+		return false;
+	}
+
+	if (record_mac_get(record, key_data, mac)) {
+		return false;
+	}
+
+	return ocrypto_constant_time_equal(record->mac, mac, MAC_LEN);
+}
+
+void validation_cache_store(const struct fw_info *fwinfo, const uint8_t *fw_hash,
+			    uint32_t key_idx)
+{
+	__aligned(4) struct cache_record records[CACHE_SLOT_COUNT];
+	struct cache_record *record = &records[slot_get(fwinfo)];
+	__aligned(4) uint8_t key_data[SB_PUBLIC_KEY_HASH_LEN];
+
+	if (public_key_data_read(key_idx, key_data) != SB_PUBLIC_KEY_HASH_LEN) {
+		return;
+	}
+
+	memcpy(records, cache, sizeof(records));
+
+	record->magic = CACHE_MAGIC;
+	record->address = fwinfo->address;
+	record->size = fwinfo->size;
+	record->version = fwinfo->version;
+	record->key_idx = key_idx;
+	memcpy(record->fw_hash, fw_hash, CONFIG_SB_HASH_LEN);
+
+	if (record_mac_get(record, key_data, record->mac)) {
+		printk("Failed to store validation in cache.\n\r");
+		return;
+	}
+
+	if (memcmp(records, cache, sizeof(records)) == 0) {
+		return;
+	}
+
+	if (nrfx_nvmc_page_erase(CACHE_ADDRESS) != NRFX_SUCCESS) {
+		printk("Failed to erase validation cache.\n\r");
+		return;
+	}
+
+	nrfx_nvmc_words_write(CACHE_ADDRESS, records, sizeof(records) / sizeof(uint32_t));
+	while (!nrfx_nvmc_write_done_check())
+		;
+
+	printk("Stored validation in cache.\n\r");
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BL_VALIDATION_CACHE_H__
+#define BL_VALIDATION_CACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <zephyr/types.h>
+#include <fw_info.h>
+
+/**
+ * @brief Check whether the firmware has been validated before.
+ *
+ * The firmware matches the cache if its hash, address, size, and version match
+ * the record for its slot, the public key used for the validation has not been
+ * invalidated since, and the MAC of the record is valid.
+ *
+ * @param[in]  fwinfo   Firmware info of the firmware.
+ * @param[in]  fw_hash  SHA-256 hash over the whole firmware.
+ *
+ * @retval true   If the signature of the firmware does not need to be verified.
+ * @retval false  Otherwise.
+ */
+bool validation_cache_check(const struct fw_info *fwinfo, const uint8_t *fw_hash);
+
+/**
+ * @brief Record a successful validation of the firmware.
+ *
+ * @param[in]  fwinfo   Firmware info of the firmware.
+ * @param[in]  fw_hash  SHA-256 hash over the whole firmware.
+ * @param[in]  key_idx  Index of the public key that verified the signature.
+ */
+void validation_cache_store(const struct fw_info *fwinfo, const uint8_t *fw_hash,
+			    uint32_t key_idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BL_VALIDATION_CACHE_H__ */
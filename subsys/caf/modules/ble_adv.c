@@ -311,6 +311,11 @@ static int update_undirected_advertising(struct bt_le_adv_param *adv_param)
 		__ASSERT_NO_MSG(!adv_state.new_adv_session);
 		__ASSERT_NO_MSG(!adv_state.rpa_rotated);
 
+		if (!bt_le_adv_prov_ad_changed() && !bt_le_adv_prov_sd_changed()) {
+			LOG_DBG("Advertising data did not change, skip update");
+			return 0;
+		}
+
 		return bt_le_adv_update_data(ad, ad_len, sd, sd_len);
 	}
 }
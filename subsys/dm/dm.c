@@ -350,7 +350,8 @@ static void dm_start_ranging(void)
 	memcpy(&timeslot_ctx.curr_req, req, sizeof(timeslot_ctx.curr_req));
 	timeslot_queue_remove_first();
 
-	uint32_t distance = time_distance_get(timeslot_ctx.last_start, req->start_time);
+	uint32_t distance = time_distance_get(timeslot_ctx.last_start,
+					      timeslot_ctx.curr_req.start_time);
 
 	atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_PENDING);
 	err = timeslot_request(TICKS_TO_US(distance));
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include "timeslot_queue.h"
 #include "time.h"
@@ -14,15 +15,32 @@
 #define MIN_TIME_BETWEEN_TIMESLOTS_US    CONFIG_DM_MIN_TIME_BETWEEN_TIMESLOTS_US
 #define RANGING_OFFSET_US                CONFIG_DM_RANGING_OFFSET_US
 
-static K_MUTEX_DEFINE(list_mtx);
-static sys_slist_t timeslot_list = SYS_SLIST_STATIC_INIT(&timeslot_list);
+/* Two ticks closer than half of the RTC range are ordered by their distance. */
+#define TIME_HALF_RANGE                  (RTC_COUNTER_MAX >> 1)
+
+#define NO_VICTIM                        -1
+
+struct peer_entry {
+	bt_addr_le_t bt_addr;
+	uint8_t count;
+};
 
 struct timeslot_entry {
 	struct timeslot_request timeslot_req;
-	sys_snode_t node;
+	struct peer_entry *peer;
 };
 
-static K_HEAP_DEFINE(heap, TIMESLOT_QUEUE_LENGTH * sizeof(struct timeslot_entry));
+static K_MUTEX_DEFINE(list_mtx);
+static K_MEM_SLAB_DEFINE(timeslot_slab, sizeof(struct timeslot_entry), TIMESLOT_QUEUE_LENGTH, 4);
+
+/* Scheduled timeslots, sorted by start time. */
+static struct timeslot_entry *queue[TIMESLOT_QUEUE_LENGTH];
+static size_t queue_len;
+
+/* A peer can only be present in the queue with at least one timeslot,
+ * so the peer table never needs more entries than the queue.
+ */
+static struct peer_entry peers[TIMESLOT_QUEUE_LENGTH];
 
 static void list_lock(void)
 {
@@ -34,114 +52,227 @@ static void list_unlock(void)
 	k_mutex_unlock(&list_mtx);
 }
 
-static size_t get_list_size(void)
+static bool time_is_before(uint32_t t1, uint32_t t2)
 {
-	size_t ret = 0;
-	sys_snode_t *node, *tmp;
+	uint32_t distance = time_distance_get(t1, t2);
+
+	return (distance != 0) && (distance < TIME_HALF_RANGE);
+}
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		ret++;
+static struct peer_entry *peer_find(const bt_addr_le_t *addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+		if ((peers[i].count != 0) && (bt_addr_le_cmp(&peers[i].bt_addr, addr) == 0)) {
+			return &peers[i];
+		}
 	}
 
-	return ret;
+	return NULL;
 }
 
-static bool is_request_exist(struct dm_request *req)
+static struct peer_entry *peer_alloc(const bt_addr_le_t *addr)
 {
-	uint8_t cnt = 0;
-	sys_snode_t *node, *tmp;
-	struct timeslot_entry *item;
+	for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+		if (peers[i].count == 0) {
+			bt_addr_le_copy(&peers[i].bt_addr, addr);
+			return &peers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Position at which a timeslot starting at start_time is to be inserted.
+ * Timeslots with the same start time keep their arrival order.
+ */
+static size_t queue_pos_find(uint32_t start_time)
+{
+	size_t low = 0;
+	size_t high = queue_len;
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+
+		if (time_is_before(start_time, queue[mid]->timeslot_req.start_time)) {
+			high = mid;
+		} else {
+			low = mid + 1;
+		}
+	}
+
+	return low;
+}
+
+static void queue_remove(size_t pos)
+{
+	struct timeslot_entry *item = queue[pos];
+
+	queue_len--;
+	memmove(&queue[pos], &queue[pos + 1], (queue_len - pos) * sizeof(queue[0]));
+
+	item->peer->count--;
+	k_mem_slab_free(&timeslot_slab, (void **)&item);
+}
+
+/* When the queue is full, a peer with fewer scheduled timeslots takes over
+ * the last timeslot of the peer with the most timeslots.
+ */
+static int victim_find(uint8_t count)
+{
+	struct peer_entry *top = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+		if (!top || (peers[i].count > top->count)) {
+			top = &peers[i];
+		}
+	}
+
+	if (!top || (top->count <= count + 1)) {
+		return NO_VICTIM;
+	}
+
+	for (int i = (int)queue_len - 1; i >= 0; i--) {
+		if (queue[i]->peer == top) {
+			return i;
+		}
+	}
+
+	return NO_VICTIM;
+}
+
+static bool timeslot_fits(uint32_t start_time, uint32_t timeslot_len_us, int pos, int victim)
+{
+	int prev = pos - 1;
+	int next = pos;
+	struct timeslot_request *neighbor;
+
+	if (prev == victim) {
+		prev--;
+	}
+
+	if (next == victim) {
+		next++;
+	}
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		item = CONTAINER_OF(node, struct timeslot_entry, node);
-		if (bt_addr_le_cmp(&item->timeslot_req.dm_req.bt_addr, &req->bt_addr) == 0) {
-			cnt++;
+	if (prev >= 0) {
+		neighbor = &queue[prev]->timeslot_req;
+		if (time_distance_get(neighbor->start_time, start_time) <
+		    US_TO_RTC_TICKS(neighbor->timeslot_length_us + MIN_TIME_BETWEEN_TIMESLOTS_US)) {
+			return false;
 		}
 	}
 
-	return cnt >= TIMESLOT_QUEUE_COUNT_SAME_PEER;
+	if (next < (int)queue_len) {
+		neighbor = &queue[next]->timeslot_req;
+		if (time_distance_get(start_time, neighbor->start_time) <
+		    US_TO_RTC_TICKS(timeslot_len_us + MIN_TIME_BETWEEN_TIMESLOTS_US)) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 			  uint32_t window_len_us, uint32_t timeslot_len_us)
 {
-	uint32_t distance;
+	int err = 0;
+	int victim = NO_VICTIM;
 	uint32_t start_time;
 	uint32_t delay;
-	size_t list_size;
-	struct timeslot_entry *last, *item;
+	int pos;
+	struct peer_entry *peer;
+	struct timeslot_entry *item;
 
 	delay = req->start_delay_us + RANGING_OFFSET_US;
-	start_time = (start_ref_tick + US_TO_RTC_TICKS(delay)) % RTC_COUNTER_MAX;
+	start_time = (start_ref_tick + US_TO_RTC_TICKS(delay)) % (RTC_COUNTER_MAX + 1);
 
-	list_size = get_list_size();
-	if (list_size >= TIMESLOT_QUEUE_LENGTH) {
-		return -ENOMEM;
+	list_lock();
+
+	peer = peer_find(&req->bt_addr);
+	if (peer && (peer->count >= TIMESLOT_QUEUE_COUNT_SAME_PEER)) {
+		err = -EAGAIN;
+		goto out;
 	}
 
-	if (list_size != 0) {
-		if (is_request_exist(req)) {
-			return -EAGAIN;
+	if (queue_len >= TIMESLOT_QUEUE_LENGTH) {
+		victim = victim_find(peer ? peer->count : 0);
+		if (victim == NO_VICTIM) {
+			err = -ENOMEM;
+			goto out;
 		}
+	}
 
-		list_lock();
-		last = SYS_SLIST_PEEK_TAIL_CONTAINER(&timeslot_list, last, node);
-		list_unlock();
+	pos = (int)queue_pos_find(start_time);
+	if (!timeslot_fits(start_time, timeslot_len_us, pos, victim)) {
+		err = -EBUSY;
+		goto out;
+	}
 
-		distance = time_distance_get(last->timeslot_req.start_time, start_time);
-		if (distance < US_TO_RTC_TICKS(last->timeslot_req.timeslot_length_us +
-					       MIN_TIME_BETWEEN_TIMESLOTS_US)) {
-			return -EBUSY;
+	if (victim != NO_VICTIM) {
+		queue_remove(victim);
+		if (victim < pos) {
+			pos--;
 		}
 	}
 
-	item = k_heap_alloc(&heap, sizeof(struct timeslot_entry), K_NO_WAIT);
-	if (!item) {
-		return -ENOMEM;
+	if (!peer) {
+		peer = peer_alloc(&req->bt_addr);
+		__ASSERT_NO_MSG(peer);
+	}
+
+	if (k_mem_slab_alloc(&timeslot_slab, (void **)&item, K_NO_WAIT)) {
+		err = -ENOMEM;
+		goto out;
 	}
 
 	item->timeslot_req.start_time = start_time;
 	item->timeslot_req.timeslot_length_us = timeslot_len_us;
 	item->timeslot_req.window_length_us = window_len_us;
+	item->peer = peer;
 	req->rng_seed++;
 
 	memcpy(&item->timeslot_req.dm_req, req, sizeof(item->timeslot_req.dm_req));
 
-	list_lock();
-	sys_slist_append(&timeslot_list, &item->node);
+	memmove(&queue[pos + 1], &queue[pos], (queue_len - pos) * sizeof(queue[0]));
+	queue[pos] = item;
+	queue_len++;
+	peer->count++;
+
+out:
 	list_unlock();
 
-	return 0;
+	return err;
 }
 
 struct timeslot_request *timeslot_queue_peek(void)
 {
-	struct timeslot_entry *item;
+	struct timeslot_request *req = NULL;
+	uint32_t now = time_now();
 
 	list_lock();
-	item = SYS_SLIST_PEEK_HEAD_CONTAINER(&timeslot_list, item, node);
-	list_unlock();
 
-	if (!item) {
-		return NULL;
+	/* Timeslots whose start time has already passed cannot be requested anymore. */
+	while ((queue_len != 0) && !time_is_before(now, queue[0]->timeslot_req.start_time)) {
+		queue_remove(0);
+	}
+
+	if (queue_len != 0) {
+		req = &queue[0]->timeslot_req;
 	}
 
-	return &item->timeslot_req;
+	list_unlock();
+
+	return req;
 }
 
 void timeslot_queue_remove_first(void)
 {
-	sys_snode_t *node;
-	struct timeslot_entry *item;
-
 	list_lock();
-	node = sys_slist_get(&timeslot_list);
-	list_unlock();
 
-	if (!node) {
-		return;
+	if (queue_len != 0) {
+		queue_remove(0);
 	}
 
-	item = CONTAINER_OF(node, struct timeslot_entry, node);
-	k_heap_free(&heap, item);
+	list_unlock();
 }
@@ -29,14 +29,20 @@ struct timeslot_request {
 	uint32_t window_length_us;
 };
 
-/** @brief Append an element to the end of a queue.
+/** @brief Schedule a timeslot in the queue.
+ *
+ *  The queue is ordered by the timeslot start time. The new timeslot must not overlap
+ *  the timeslots scheduled before and after it. When the queue is full, the last timeslot
+ *  of the peer with the most scheduled timeslots is dropped in favor of a peer
+ *  with fewer scheduled timeslots.
  *
  *  @param req Address of the structure with request parameters.
  *  @param start_ref_tick Reference start time tick.
  *  @param window_len Ranging window length.
  *  @param timeslot_len Timeslot length.
  *
- *  @retval -ENOMEM when the tiemslot queue is full or a memory allocation error.
+ *  @retval 0 when the timeslot was scheduled.
+ *  @retval -ENOMEM when the timeslot queue is full.
  *  @retval -EAGAIN when a single peer has a maximum number of timeslots scheduled.
  *  @retval -EBUSY when the timeslot cannot be scheduled due to time restrictions.
  */
@@ -44,6 +50,8 @@ int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 			  uint32_t window_len, uint32_t timeslot_len);
 
 /** @brief Peek element at the head of queue.
+ *
+ *  Timeslots whose start time has already passed are dropped from the queue.
  *
  *  @param None
  *
@@ -241,6 +241,12 @@ static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
 struct payload_wrap *ack_pl_wrap_pipe[CONFIG_ESB_PIPE_COUNT];
 
+/* TX slot claimed by the application with esb_write_payload_claim() */
+static struct esb_payload *tx_payload_claimed;
+static struct payload_wrap *ack_pl_wrap_claimed;
+/* RX FIFO front accessed by the application with esb_read_rx_payload_claim() */
+static bool rx_payload_claimed;
+
 /* Run time variables */
 static uint8_t pids[CONFIG_ESB_PIPE_COUNT];
 static struct pipe_info rx_pipe_info[CONFIG_ESB_PIPE_COUNT];
@@ -697,6 +703,10 @@ static void reset_fifos(void)
 	rx_fifo.back = 0;
 	rx_fifo.front = 0;
 	rx_fifo.count = 0;
+
+	tx_payload_claimed = NULL;
+	ack_pl_wrap_claimed = 0;
+	rx_payload_claimed = false;
 }
 
 static void initialize_fifos(void)
@@ -1537,83 +1547,246 @@ static struct payload_wrap *find_free_payload_cont(void)
 	return 0;
 }
 
-int esb_write_payload(const struct esb_payload *payload)
+/* Reserve a free TX slot. A slot claimed by the application stays reserved,
+ * so in PTX mode its buffer is moved one entry back in the FIFO to keep it
+ * behind the reserved slot. Must be called with interrupts locked.
+ */
+static int tx_slot_reserve(struct esb_payload **payload, struct payload_wrap **wrap)
 {
-	if (!esb_initialized) {
-		return -EACCES;
+	struct payload_wrap *new_ack_payload;
+	uint32_t count = tx_fifo.count + (tx_payload_claimed != NULL ? 1 : 0);
+
+	if (count >= CONFIG_ESB_TX_FIFO_SIZE) {
+		return -ENOMEM;
 	}
 
-	if (payload == NULL) {
-		return -EINVAL;
+	if (esb_cfg.mode == ESB_MODE_PTX) {
+		if (tx_payload_claimed != NULL) {
+			uint32_t next = (tx_fifo.back + 1) % CONFIG_ESB_TX_FIFO_SIZE;
+
+			tx_fifo.payload[tx_fifo.back] = tx_fifo.payload[next];
+			tx_fifo.payload[next] = tx_payload_claimed;
+		}
+
+		*payload = tx_fifo.payload[tx_fifo.back];
+		*wrap = 0;
+	} else {
+		new_ack_payload = find_free_payload_cont();
+		if (new_ack_payload == 0) {
+			return -ENOMEM;
+		}
+
+		new_ack_payload->in_use = true;
+		new_ack_payload->p_next = 0;
+		*payload = new_ack_payload->p_payload;
+		*wrap = new_ack_payload;
+	}
+
+	return 0;
+}
+
+/* Queue a slot reserved with tx_slot_reserve(). Must be called with interrupts
+ * locked, and followed by tx_slot_start() once they are unlocked.
+ */
+static void tx_slot_queue(struct esb_payload *payload, struct payload_wrap *wrap)
+{
+	pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
+	payload->pid = pids[payload->pipe];
+
+	if (esb_cfg.mode == ESB_MODE_PTX) {
+		if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
+			tx_fifo.back = 0;
+		}
+	} else {
+		if (ack_pl_wrap_pipe[payload->pipe] == 0) {
+			ack_pl_wrap_pipe[payload->pipe] = wrap;
+		} else {
+			struct payload_wrap *pl = ack_pl_wrap_pipe[payload->pipe];
+
+			while (pl->p_next != 0) {
+				pl = (struct payload_wrap *)pl->p_next;
+			}
+			pl->p_next = (struct payload_wrap *)wrap;
+		}
+	}
+
+	tx_fifo.count++;
+}
+
+/* Reserve a TX slot for the application, so that it can be filled in place.
+ * Must be called with interrupts locked.
+ */
+static int tx_slot_claim(struct esb_payload **payload)
+{
+	int err;
+
+	if (tx_payload_claimed != NULL) {
+		return -EBUSY;
+	}
+
+	err = tx_slot_reserve(payload, &ack_pl_wrap_claimed);
+	if (err) {
+		return err;
+	}
+
+	tx_payload_claimed = *payload;
+
+	return 0;
+}
+
+/* Must be called with interrupts locked. */
+static void tx_slot_release(void)
+{
+	if (ack_pl_wrap_claimed != 0) {
+		ack_pl_wrap_claimed->in_use = false;
+		ack_pl_wrap_claimed = 0;
 	}
 
+	tx_payload_claimed = NULL;
+}
+
+/* Queue the claimed TX slot. Must be called with interrupts locked, and
+ * followed by tx_slot_start() once they are unlocked.
+ */
+static void tx_slot_commit(void)
+{
+	tx_slot_queue(tx_payload_claimed, ack_pl_wrap_claimed);
+
+	ack_pl_wrap_claimed = 0;
+	tx_payload_claimed = NULL;
+}
+
+static void tx_slot_start(void)
+{
+	if (esb_cfg.mode == ESB_MODE_PTX &&
+	    esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
+	    (esb_state == ESB_STATE_IDLE ||
+	     (IS_ENABLED(CONFIG_ESB_NEVER_DISABLE_TX) ?
+	      esb_state == ESB_STATE_PTX_TXIDLE : 0))) {
+		start_tx_transaction();
+	}
+}
+
+static int tx_payload_check(const struct esb_payload *payload)
+{
 	if ((payload->length == 0) || (payload->length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) ||
 	    ((esb_cfg.protocol == ESB_PROTOCOL_ESB) &&
 	     (payload->length > esb_cfg.payload_length))) {
 		return -EMSGSIZE;
 	}
 
-	if (tx_fifo.count >= CONFIG_ESB_TX_FIFO_SIZE) {
-		return -ENOMEM;
+	if (payload->pipe >= CONFIG_ESB_PIPE_COUNT) {
+		return -EINVAL;
 	}
 
-	if (payload->pipe >= CONFIG_ESB_PIPE_COUNT) {
+	return 0;
+}
+
+int esb_write_payload(const struct esb_payload *payload)
+{
+	struct esb_payload *slot;
+	struct payload_wrap *wrap;
+	unsigned int key;
+	int err;
+
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	if (payload == NULL) {
 		return -EINVAL;
 	}
 
-	unsigned int key = irq_lock();
+	err = tx_payload_check(payload);
+	if (err) {
+		return err;
+	}
 
-	if (esb_cfg.mode == ESB_MODE_PTX) {
-		memcpy(tx_fifo.payload[tx_fifo.back], payload, sizeof(struct esb_payload));
+	key = irq_lock();
 
-		pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
-		tx_fifo.payload[tx_fifo.back]->pid = pids[payload->pipe];
+	/* A slot claimed with esb_write_payload_claim() stays reserved. */
+	err = tx_slot_reserve(&slot, &wrap);
+	if (err) {
+		irq_unlock(key);
+		return err;
+	}
 
-		if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
-			tx_fifo.back = 0;
-		}
+	/* Copy only the part of the payload data that is in use. */
+	slot->length = payload->length;
+	slot->pipe = payload->pipe;
+	slot->rssi = payload->rssi;
+	slot->noack = payload->noack;
+	memcpy(slot->data, payload->data, payload->length);
 
-		tx_fifo.count++;
-	} else {
-		struct payload_wrap *new_ack_payload = find_free_payload_cont();
+	tx_slot_queue(slot, wrap);
 
-		if (new_ack_payload != 0) {
-			new_ack_payload->in_use = true;
-			new_ack_payload->p_next = 0;
-			memcpy(new_ack_payload->p_payload, payload, sizeof(struct esb_payload));
+	irq_unlock(key);
 
-			pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
-			new_ack_payload->p_payload->pid = pids[payload->pipe];
+	tx_slot_start();
 
-			if (ack_pl_wrap_pipe[payload->pipe] == 0) {
-				ack_pl_wrap_pipe[payload->pipe] = new_ack_payload;
-			} else {
-				struct payload_wrap *pl = ack_pl_wrap_pipe[payload->pipe];
+	return 0;
+}
 
-				while (pl->p_next != 0) {
-					pl = (struct payload_wrap *)pl->p_next;
-				}
-				pl->p_next = (struct payload_wrap *)new_ack_payload;
-			}
-			tx_fifo.count++;
-		}
+int esb_write_payload_claim(struct esb_payload **payload)
+{
+	unsigned int key;
+	int err;
+
+	if (!esb_initialized) {
+		return -EACCES;
 	}
 
+	if (payload == NULL) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	err = tx_slot_claim(payload);
 	irq_unlock(key);
 
-	if (esb_cfg.mode == ESB_MODE_PTX &&
-	    esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
-	    (esb_state == ESB_STATE_IDLE ||
-	     (IS_ENABLED(CONFIG_ESB_NEVER_DISABLE_TX) ?
-	      esb_state == ESB_STATE_PTX_TXIDLE : 0))) {
-		start_tx_transaction();
+	return err;
+}
+
+int esb_write_payload_finish(bool commit)
+{
+	unsigned int key;
+	int err = 0;
+
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	key = irq_lock();
+
+	/* The slot may have been released by flushing or popping the TX queue. */
+	if (tx_payload_claimed == NULL) {
+		irq_unlock(key);
+		return -EINVAL;
+	}
+
+	if (commit) {
+		err = tx_payload_check(tx_payload_claimed);
+	}
+
+	if (!commit || err) {
+		tx_slot_release();
+		irq_unlock(key);
+		return err;
 	}
 
+	tx_slot_commit();
+
+	irq_unlock(key);
+
+	tx_slot_start();
+
 	return 0;
 }
 
 int esb_read_rx_payload(struct esb_payload *payload)
 {
+	struct esb_payload *front;
+
 	if (!esb_initialized) {
 		return -EACCES;
 	}
@@ -1627,13 +1800,63 @@ int esb_read_rx_payload(struct esb_payload *payload)
 
 	unsigned int key = irq_lock();
 
-	payload->length = rx_fifo.payload[rx_fifo.front]->length;
-	payload->pipe = rx_fifo.payload[rx_fifo.front]->pipe;
-	payload->rssi = rx_fifo.payload[rx_fifo.front]->rssi;
-	payload->pid = rx_fifo.payload[rx_fifo.front]->pid;
-	payload->noack = rx_fifo.payload[rx_fifo.front]->noack;
-	memcpy(payload->data, rx_fifo.payload[rx_fifo.front]->data,
-	       payload->length);
+	front = rx_fifo.payload[rx_fifo.front];
+	payload->length = front->length;
+	payload->pipe = front->pipe;
+	payload->rssi = front->rssi;
+	payload->pid = front->pid;
+	payload->noack = front->noack;
+	memcpy(payload->data, front->data, payload->length);
+
+	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
+		rx_fifo.front = 0;
+	}
+
+	rx_fifo.count--;
+	rx_payload_claimed = false;
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+int esb_read_rx_payload_claim(const struct esb_payload **payload)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+	if (payload == NULL) {
+		return -EINVAL;
+	}
+
+	if (rx_fifo.count == 0) {
+		return -ENODATA;
+	}
+
+	/* The radio only writes to the back of the FIFO, so the front entry
+	 * stays valid until it is released.
+	 */
+	*payload = rx_fifo.payload[rx_fifo.front];
+	rx_payload_claimed = true;
+
+	return 0;
+}
+
+int esb_read_rx_payload_finish(void)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	unsigned int key = irq_lock();
+
+	/* The payload may have been removed by reading or flushing the RX queue. */
+	if (!rx_payload_claimed || rx_fifo.count == 0) {
+		irq_unlock(key);
+		return -EINVAL;
+	}
+
+	rx_payload_claimed = false;
 
 	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
 		rx_fifo.front = 0;
@@ -1735,6 +1958,7 @@ int esb_flush_tx(void)
 	tx_fifo.count = 0;
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
+	tx_slot_release();
 
 	irq_unlock(key);
 
@@ -1752,6 +1976,7 @@ int esb_pop_tx(void)
 
 	unsigned int key = irq_lock();
 
+	tx_slot_release();
 	if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
 		tx_fifo.back = 0;
 	}
@@ -1778,6 +2003,7 @@ int esb_flush_rx(void)
 	rx_fifo.count = 0;
 	rx_fifo.back = 0;
 	rx_fifo.front = 0;
+	rx_payload_claimed = false;
 
 	memset(rx_pipe_info, 0, sizeof(rx_pipe_info));
 
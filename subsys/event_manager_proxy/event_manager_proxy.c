@@ -16,6 +16,10 @@ LOG_MODULE_REGISTER(event_manager_proxy, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 #define EMP_BIND_TIMEOUT K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BIND_TIMEOUT_MS)
 
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+#define EMP_BATCH_BUF_SIZE ROUND_UP(CONFIG_EVENT_MANAGER_PROXY_BATCH_BUF_SIZE, sizeof(uint32_t))
+#endif
+
 /* Helpers - allow linker to get information about these structure sizes. */
 static struct event_type _emp_event_type_size_check
 	__used __attribute__((__section__("event_manager_proxy_event_type_size")));
@@ -42,6 +46,12 @@ struct emp_cmd {
 	enum emp_cmd_code code;
 };
 
+/** @brief Flags passed with the start command. */
+enum emp_start_flag {
+	/** The core can receive multiple events packed in a single message. */
+	EMP_START_FLAG_BATCH = BIT(0),
+};
+
 /**
  * @brief The command structure used to subscribe.
  */
@@ -51,6 +61,25 @@ struct emp_cmd_subscribe {
 	char name[];
 };
 
+/**
+ * @brief The command structure used to start the event transmission.
+ *
+ * The flags are not present if the remote uses the base command structure.
+ */
+struct emp_cmd_start {
+	enum emp_cmd_code code;
+	uint32_t flags;
+};
+
+/**
+ * @brief Header of the event packed in a batch.
+ *
+ * Every event in a batch is preceded by the header and padded to the word size.
+ */
+struct emp_batch_hdr {
+	uint32_t size;
+};
+
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
@@ -59,6 +88,22 @@ struct emp_ipc_data {
 	bool started;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+	/** The IPC service backend does not support the no-copy API. */
+	bool nocopy_unsupported;
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	/** Both cores pack the events in batches. */
+	bool batch;
+	struct k_mutex batch_lock;
+	struct k_work batch_work;
+	/** The buffer the events are packed in, NULL if no batch is open. */
+	uint8_t *batch_buf;
+	size_t batch_size;
+	size_t batch_len;
+	/** The batch buffer was obtained from the IPC service backend. */
+	bool batch_nocopy;
+	/** The batch buffer used if the backend does not support the no-copy API. */
+	uint32_t batch_local_buf[EMP_BATCH_BUF_SIZE / sizeof(uint32_t)];
+#endif
 };
 
 
@@ -159,6 +204,36 @@ static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size
 	_event_submit(event);
 }
 
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+static void handle_remote_event_batch(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	const uint8_t *pos = data;
+	const uint8_t *end = pos + len;
+
+	while (pos < end) {
+		struct emp_batch_hdr hdr;
+
+		if ((size_t)(end - pos) < sizeof(hdr)) {
+			LOG_ERR("Truncated batch header on ipc %zu", ipc2idx(ipc));
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		memcpy(&hdr, pos, sizeof(hdr));
+		pos += sizeof(hdr);
+
+		if ((hdr.size == 0) || (hdr.size > (size_t)(end - pos))) {
+			LOG_ERR("Unexpected event size in batch: %u", (unsigned int)hdr.size);
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		handle_remote_event(ipc, pos, hdr.size);
+		pos += MIN(ROUND_UP(hdr.size, sizeof(uint32_t)), (size_t)(end - pos));
+	}
+}
+#endif
+
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
 	if (ipc->started) {
@@ -197,6 +272,13 @@ static void handle_remote_command_start(struct emp_ipc_data *ipc, const void *da
 		return;
 	}
 
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	const struct emp_cmd_start *cmd = data;
+
+	/* Remotes that do not support batching send the base command only. */
+	ipc->batch = (len >= sizeof(*cmd)) && (cmd->flags & EMP_START_FLAG_BATCH);
+#endif
+
 	ipc->started = true;
 
 	LOG_DBG("Event transmission on ipc %d started", ipc2idx(ipc));
@@ -256,6 +338,12 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+		if (ipc->batch) {
+			handle_remote_event_batch(ipc, data, len);
+			return;
+		}
+#endif
 		handle_remote_event(ipc, data, len);
 	} else {
 		handle_remote_command(ipc, data, len);
@@ -274,36 +362,284 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+/**
+ * @brief Send data copied from the given buffer to the remote.
+ *
+ * The transmission is retried if the endpoint is busy.
+ */
+static int ipc_send(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
 	int ret;
 
-	if (remote_ev == NULL) {
-		return 0;
+	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
+		ret = ipc_service_send(&ipc->ept, data, len);
+		if (ret >= 0) {
+			break;
+		}
+		k_usleep(1);
 	}
 
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+	return ret;
+}
 
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
+/**
+ * @brief Get the TX buffer from the IPC service backend.
+ *
+ * Getting the buffer is retried if no buffer is available.
+ *
+ * @retval -ENOTSUP The backend does not support the no-copy API.
+ * @retval -ENOMEM  The requested size is too big, the maximum size is written to @p size.
+ */
+static int tx_buffer_get(struct emp_ipc_data *ipc, void **data, uint32_t *size)
+{
+	int ret;
 
 	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
-		if (ret >= 0) {
+		ret = ipc_service_get_tx_buffer(&ipc->ept, data, size, K_NO_WAIT);
+		if ((ret >= 0) || (ret == -ENOTSUP) || (ret == -EIO) || (ret == -ENOMEM)) {
 			break;
 		}
 		k_usleep(1);
 	}
 
+	/* The IPC service reports -EIO if the backend does not implement the no-copy API. */
+	if ((ret == -ENOTSUP) || (ret == -EIO)) {
+		ipc->nocopy_unsupported = true;
+		return -ENOTSUP;
+	}
+
+	return (ret < 0) ? ret : 0;
+}
+
+/**
+ * @brief Copy the event to the buffer that is sent to the remote.
+ *
+ * The event type is replaced by the event type requested by the remote.
+ */
+static void event_copy_to_remote(void *dst, const struct app_event_header *eh, size_t size,
+				 const struct event_type *remote_ev)
+{
+	memcpy(dst, eh, size);
+	/* Events in a batch are aligned to the word size only. */
+	memcpy((uint8_t *)dst + offsetof(struct app_event_header, type_id), &remote_ev,
+	       sizeof(remote_ev));
+}
+
+static int send_event_to_remote_nocopy(struct emp_ipc_data *ipc,
+				       const struct app_event_header *eh, size_t size,
+				       const struct event_type *remote_ev)
+{
+	const size_t len = ROUND_UP(size, sizeof(uint32_t));
+	uint32_t buf_size = len;
+	void *data;
+	int ret;
+
+	ret = tx_buffer_get(ipc, &data, &buf_size);
+	if (ret) {
+		return ret;
+	}
+
+	event_copy_to_remote(data, eh, size, remote_ev);
+
+	ret = ipc_service_send_nocopy(&ipc->ept, data, len);
+	if (ret < 0) {
+		(void)ipc_service_drop_tx_buffer(&ipc->ept, data);
+	}
+
+	return ret;
+}
+
+static int send_event_to_remote_copy(struct emp_ipc_data *ipc,
+				     const struct app_event_header *eh, size_t size,
+				     const struct event_type *remote_ev)
+{
+	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
+
+	event_copy_to_remote(buffer, eh, size, remote_ev);
+
+	return ipc_send(ipc, buffer, sizeof(buffer));
+}
+
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+/**
+ * @brief Send the open batch to the remote.
+ *
+ * Must be called with the batch lock taken.
+ */
+static int batch_flush(struct emp_ipc_data *ipc)
+{
+	int ret = 0;
+
+	if (!ipc->batch_buf) {
+		return 0;
+	}
+
+	if (ipc->batch_nocopy) {
+		if (ipc->batch_len > 0) {
+			ret = ipc_service_send_nocopy(&ipc->ept, ipc->batch_buf, ipc->batch_len);
+		}
+		if ((ipc->batch_len == 0) || (ret < 0)) {
+			(void)ipc_service_drop_tx_buffer(&ipc->ept, ipc->batch_buf);
+		}
+	} else if (ipc->batch_len > 0) {
+		ret = ipc_send(ipc, ipc->batch_buf, ipc->batch_len);
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Cannot send batch to remote %p, err: %d", ipc, ret);
+	}
+
+	ipc->batch_buf = NULL;
+	ipc->batch_size = 0;
+	ipc->batch_len = 0;
+
+	return (ret < 0) ? ret : 0;
+}
+
+/**
+ * @brief Open a new batch.
+ *
+ * The events are written directly to the TX buffer of the IPC service backend
+ * if the backend supports the no-copy API.
+ * Must be called with the batch lock taken.
+ */
+static int batch_open(struct emp_ipc_data *ipc)
+{
+	__ASSERT_NO_MSG(!ipc->batch_buf);
+
+	if (!ipc->nocopy_unsupported) {
+		uint32_t size = EMP_BATCH_BUF_SIZE;
+		void *data;
+		int ret;
+
+		ret = tx_buffer_get(ipc, &data, &size);
+		if ((ret == -ENOMEM) && (size > 0)) {
+			/* The backend buffers are smaller than the configured batch size. */
+			ret = tx_buffer_get(ipc, &data, &size);
+		}
+
+		if (!ret) {
+			ipc->batch_buf = data;
+			ipc->batch_size = size;
+			ipc->batch_nocopy = true;
+			return 0;
+		}
+
+		if (ret != -ENOTSUP) {
+			return ret;
+		}
+	}
+
+	ipc->batch_buf = (uint8_t *)ipc->batch_local_buf;
+	ipc->batch_size = sizeof(ipc->batch_local_buf);
+	ipc->batch_nocopy = false;
+
+	return 0;
+}
+
+/**
+ * @brief Send the event that does not fit in the batch buffer in a batch of its own.
+ */
+static int batch_event_send_single(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+				   size_t size, const struct event_type *remote_ev)
+{
+	const struct emp_batch_hdr hdr = {.size = size};
+	uint32_t buffer[(sizeof(hdr) + ROUND_UP(size, sizeof(uint32_t))) / sizeof(uint32_t)];
+
+	memcpy(buffer, &hdr, sizeof(hdr));
+	event_copy_to_remote((uint8_t *)buffer + sizeof(hdr), eh, size, remote_ev);
+
+	return ipc_send(ipc, buffer, sizeof(buffer));
+}
+
+static int batch_event_add(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+			   size_t size, const struct event_type *remote_ev)
+{
+	const struct emp_batch_hdr hdr = {.size = size};
+	size_t len = sizeof(hdr) + ROUND_UP(size, sizeof(uint32_t));
+	int ret = 0;
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+
+	if (ipc->batch_buf && ((ipc->batch_len + len) > ipc->batch_size)) {
+		ret = batch_flush(ipc);
+	}
+
+	if (!ret && !ipc->batch_buf) {
+		ret = batch_open(ipc);
+	}
+
+	if (!ret && (len > ipc->batch_size)) {
+		/* Send the open batch first to keep the order of the events. */
+		ret = batch_flush(ipc);
+		if (!ret) {
+			ret = batch_event_send_single(ipc, eh, size, remote_ev);
+		}
+	} else if (!ret) {
+		uint8_t *pos = ipc->batch_buf + ipc->batch_len;
+
+		memcpy(pos, &hdr, sizeof(hdr));
+		event_copy_to_remote(pos + sizeof(hdr), eh, size, remote_ev);
+		ipc->batch_len += len;
+
+		/* The batch is sent after the currently queued events are processed. */
+		k_work_submit(&ipc->batch_work);
+	}
+
+	k_mutex_unlock(&ipc->batch_lock);
+
+	return ret;
+}
+
+static void batch_work_handler(struct k_work *work)
+{
+	struct emp_ipc_data *ipc = CONTAINER_OF(work, struct emp_ipc_data, batch_work);
+	int ret;
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+	ret = batch_flush(ipc);
+	k_mutex_unlock(&ipc->batch_lock);
+
+	if (ret) {
+		__ASSERT_NO_MSG(false);
+	}
+}
+#endif
+
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+	size_t size;
+	int ret;
+
+	if (remote_ev == NULL) {
+		return 0;
+	}
+
+	size = app_event_manager_event_size(eh);
+
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	if (ipc->batch) {
+		ret = batch_event_add(ipc, eh, size, remote_ev);
+	} else
+#endif
+	{
+		ret = -ENOTSUP;
+		if (!ipc->nocopy_unsupported) {
+			ret = send_event_to_remote_nocopy(ipc, eh, size, remote_ev);
+		}
+		if (ret == -ENOTSUP) {
+			ret = send_event_to_remote_copy(ipc, eh, size, remote_ev);
+		}
+	}
+
 	if (ret < 0) {
 		LOG_ERR("Cannot send event to remote %p, err: %d", ipc, ret);
 		__ASSERT_NO_MSG(false);
+		return ret;
 	}
 
-	return ret;
+	return 0;
 }
 
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
@@ -355,6 +691,15 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 	memset(ipc->event_type_map, 0, event_type_count * sizeof(ipc->event_type_map[0]));
 
 	k_event_init(&ipc->bound);
+	ipc->nocopy_unsupported = false;
+
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	ipc->batch = false;
+	ipc->batch_buf = NULL;
+	ipc->batch_len = 0;
+	k_mutex_init(&ipc->batch_lock);
+	k_work_init(&ipc->batch_work, batch_work_handler);
+#endif
 
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
 	if (ret) {
@@ -428,7 +773,10 @@ int event_manager_proxy_subscribe(const struct device *instance,
 
 static int send_start_command_to_remote(struct emp_ipc_data *ipc)
 {
-	const struct emp_cmd cmd = {.code = EMP_CMD_START};
+	const struct emp_cmd_start cmd = {
+		.code = EMP_CMD_START,
+		.flags = IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH) ? EMP_START_FLAG_BATCH : 0
+	};
 
 	__ASSERT_NO_MSG(ipc);
 
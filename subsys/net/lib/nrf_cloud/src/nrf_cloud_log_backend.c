@@ -10,7 +10,6 @@
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_backend.h>
-#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/base64.h>
 #include <date_time.h>
 #include "nrf_cloud_fsm.h"
@@ -23,10 +22,10 @@
 
 LOG_MODULE_DECLARE(nrf_cloud_log, CONFIG_NRF_CLOUD_LOG_LOG_LEVEL);
 
-#define RING_BUF_SIZE CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE
+#define UPLOAD_BUF_SIZE CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE
+#define UPLOAD_BUF_COUNT 2
 
-#define LOG_OUTPUT_RETRIES 5
-#define LOG_OUTPUT_RETRY_DELAY_MS 50
+#define UPLOAD_BUSY_RETRY_DELAY_MS 100
 
 /** Special value indicating the source of this log entry could not be determined */
 #define UNKNOWN_LOG_SOURCE UINT32_MAX
@@ -51,18 +50,33 @@ static const struct log_backend_api logger_api = {
 	.notify		= logger_notify
 };
 
-static struct nrf_cloud_log_stats {
-	/** Total number of lines logged */
-	uint32_t lines_rendered;
-	/** Total number of bytes (before TLS) logged */
-	uint32_t bytes_rendered;
-	/** Total number of lines sent */
-	uint32_t lines_sent;
-	/** Total number of bytes (before TLS) sent */
-	uint32_t bytes_sent;
-	/** Total number of bytes (before TLS) sent */
-	uint32_t lines_dropped;
-} stats;
+static struct nrf_cloud_log_stats stats;
+
+/* Log output is collected into one buffer while the other one is uploaded
+ * from a dedicated work queue, so that the logging thread never waits for the network.
+ */
+struct upload_buf {
+	/* Leave room for closing the JSON array and for a NULL terminator. */
+	uint8_t data[UPLOAD_BUF_SIZE + 2];
+	size_t len;
+	int num_msgs;
+	uint32_t format;
+};
+
+static struct upload_buf upload_bufs[UPLOAD_BUF_COUNT];
+/* Buffer that log output is currently stored into. */
+static struct upload_buf *fill_buf = &upload_bufs[0];
+/* Buffer that is being uploaded, or NULL if no upload is in progress. */
+static struct upload_buf *sending_buf;
+/* Set when the fill buffer could not be handed over because an upload was in progress. */
+static bool flush_pending;
+/* Protects the buffers and the statistics. */
+static struct k_spinlock upload_lock;
+
+static K_THREAD_STACK_DEFINE(upload_stack, CONFIG_NRF_CLOUD_LOG_BACKEND_UPLOAD_STACK_SIZE);
+static struct k_work_q upload_work_q;
+static void upload_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(upload_work, upload_work_fn);
 
 /* Information about a log message is stored in the log_context by the logger_process backend
  * function, then used by the logger_out function when encoding messages for transport.
@@ -72,7 +86,6 @@ static struct nrf_cloud_log_context log_context;
 static uint8_t log_buf[CONFIG_NRF_CLOUD_LOG_BUF_SIZE + 1];
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_NRF_CLOUD_OUTPUT_DEFAULT;
 static uint32_t log_output_flags = LOG_OUTPUT_FLAG_CRLF_NONE;
-static int num_msgs;
 static struct nrf_cloud_rest_context *rest_ctx;
 static char device_id[NRF_CLOUD_CLIENT_ID_MAX_LEN];
 
@@ -113,9 +126,8 @@ BUILD_ASSERT(CONFIG_NRF_CLOUD_LOG_BUF_SIZE < CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE,
 LOG_BACKEND_DEFINE(log_nrf_cloud_backend, logger_api, false);
 /* Reduce reported log_buf size by 1 so we can null terminate */
 LOG_OUTPUT_DEFINE(log_nrf_cloud_output, logger_out, log_buf, (sizeof(log_buf) - 1));
-RING_BUF_DECLARE(log_nrf_cloud_rb, RING_BUF_SIZE);
 
-static int send_ring_buffer(void);
+static int upload_buf_swap(void);
 
 static void logger_init(const struct log_backend *const backend)
 {
@@ -131,6 +143,11 @@ static void logger_init(const struct log_backend *const backend)
 
 	nrf_cloud_log_init();
 
+	k_work_queue_start(&upload_work_q, upload_stack,
+			   K_THREAD_STACK_SIZEOF(upload_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO,
+			   &(const struct k_work_queue_config){ .name = "nrf_cloud_log" });
+
 	LOG_DBG("Filtering lower level log sources");
 	for (i = 0; i < ARRAY_SIZE(filtered_modules); i++) {
 		sid = log_source_id_get(filtered_modules[i]);
@@ -246,11 +263,19 @@ static void logger_process(const struct log_backend *const backend, union log_ms
 	log_output_func(&log_nrf_cloud_output, &msg->log, log_output_flags);
 }
 
+static void lines_dropped_add(uint32_t cnt)
+{
+	k_spinlock_key_t key = k_spin_lock(&upload_lock);
+
+	stats.lines_dropped += cnt;
+	k_spin_unlock(&upload_lock, key);
+}
+
 static void logger_dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	if (backend == &log_nrf_cloud_backend) {
 		log_output_dropped_process(&log_nrf_cloud_output, cnt);
-		stats.lines_dropped += cnt;
+		lines_dropped_add(cnt);
 	}
 }
 
@@ -311,12 +336,12 @@ static void logger_notify(const struct log_backend *const backend, enum log_back
 		return;
 	}
 
-	/* Flush our transmission buffer */
-	send_ring_buffer();
+	/* Hand our transmission buffer over to the upload work */
+	(void)upload_buf_swap();
 	if (CONFIG_NRF_CLOUD_LOG_LOG_LEVEL >= LOG_LEVEL_DBG) {
-		LOG_DBG("Buffered lines:%u, bytes:%u; logged lines:%u, bytes:%u; "
+		LOG_DBG("Buffered lines:%u, bytes:%zu; logged lines:%u, bytes:%u; "
 			"sent lines:%u, bytes:%u; dropped lines:%u",
-			log_buffered_cnt(), ring_buf_size_get(&log_nrf_cloud_rb),
+			log_buffered_cnt(), fill_buf->len,
 			stats.lines_rendered, stats.bytes_rendered,
 			stats.lines_sent, stats.bytes_sent,
 			stats.lines_dropped);
@@ -325,99 +350,194 @@ static void logger_notify(const struct log_backend *const backend, enum log_back
 	}
 }
 
-static int send_ring_buffer(void)
+static int upload_buf_send(struct upload_buf *buf)
 {
-	int err = 0;
-	int ret = 0;
+	int err;
 	struct nrf_cloud_tx_data output = {
+		.data.ptr = buf->data,
+		.data.len = buf->len,
 		.qos = MQTT_QOS_0_AT_MOST_ONCE,
-		.topic_type = (log_format_current == LOG_OUTPUT_TEXT) ?
+		.topic_type = (buf->format == LOG_OUTPUT_TEXT) ?
 			       NRF_CLOUD_TOPIC_BULK : NRF_CLOUD_TOPIC_BIN
 	};
-	uint32_t stored;
-	uint8_t *base64_buf = NULL;
-
-	/* The bulk topic requires the multiple JSON messages to be placed in
-	 * a JSON array. Close the array then send it.
-	 */
-	if ((num_msgs != 0) && (log_format_current == LOG_OUTPUT_TEXT)) {
-		ring_buf_put(&log_nrf_cloud_rb, "]", 1);
-	}
-
-	stored = ring_buf_size_get(&log_nrf_cloud_rb);
-	output.data.len = ring_buf_get_claim(&log_nrf_cloud_rb,
-					     (uint8_t **)&output.data.ptr,
-					     stored);
-	if (output.data.len != stored) {
-		LOG_WRN("Capacity:%u, free:%u, stored:%u, claimed:%u",
-			ring_buf_capacity_get(&log_nrf_cloud_rb),
-			ring_buf_space_get(&log_nrf_cloud_rb),
-			stored, output.data.len);
-		stored = output.data.len;
-	}
-	if (!output.data.len) {
-		goto cleanup;
-	}
-
-	uint8_t *p = (uint8_t *)output.data.ptr;
-
-	p[output.data.len] = '\0';
 
 	LOG_DBG("Ready to transmit %zd bytes...", output.data.len);
 	if (IS_ENABLED(CONFIG_NRF_CLOUD_MQTT)) {
 		err = nrf_cloud_send(&output);
 	} else if (IS_ENABLED(CONFIG_NRF_CLOUD_REST)) {
-		do {
-			err = nrf_cloud_rest_send_device_message(log_context.rest_ctx,
-								 log_context.device_id,
-								 output.data.ptr, true, NULL);
-			if (err) {
-				LOG_ERR("Error sending message:%d", err);
-				if (p[0] == '\0') {
-					LOG_ERR("Empty buffer!");
-				}
-				if (err != -EBUSY) {
-					LOG_ERR("Data: %s, len: %zd",
-						(const char *)output.data.ptr, output.data.len);
-				}
-				k_sleep(K_MSEC(100));
-			}
-		} while (err == -EBUSY);
+		err = nrf_cloud_rest_send_device_message(log_context.rest_ctx,
+							 log_context.device_id,
+							 output.data.ptr, true, NULL);
+		if (err && (err != -EBUSY)) {
+			LOG_ERR("Data: %s, len: %zd",
+				(const char *)output.data.ptr, output.data.len);
+		}
 	} else {
 		err = -ENODEV;
 	}
-	if (!err) {
-		stats.lines_sent += num_msgs;
-		stats.bytes_sent += output.data.len;
+
+	return err;
+}
+
+static void upload_work_fn(struct k_work *work)
+{
+	struct upload_buf *buf;
+	k_spinlock_key_t key;
+	bool flush;
+	int err;
+
+	ARG_UNUSED(work);
+
+	key = k_spin_lock(&upload_lock);
+	buf = sending_buf;
+	k_spin_unlock(&upload_lock, key);
+
+	if (!buf) {
+		return;
+	}
+
+	err = upload_buf_send(buf);
+	if (err == -EBUSY) {
+		/* The REST context is in use, try again later.
+		 * Logging continues into the other buffer meanwhile.
+		 */
+		k_work_reschedule_for_queue(&upload_work_q, &upload_work,
+					    K_MSEC(UPLOAD_BUSY_RETRY_DELAY_MS));
+		return;
+	}
+
+	if (err) {
+		LOG_ERR("Error sending message:%d", err);
 	}
 
-cleanup:
+	key = k_spin_lock(&upload_lock);
 	if (err) {
-		LOG_ERR("Error %d ret %d processing ring buffer", err, ret);
+		stats.lines_dropped += buf->num_msgs;
+	} else {
+		stats.lines_sent += buf->num_msgs;
+		stats.bytes_sent += buf->len;
+	}
+	buf->len = 0;
+	buf->num_msgs = 0;
+	sending_buf = NULL;
+	flush = flush_pending;
+	flush_pending = false;
+	k_spin_unlock(&upload_lock, key);
+
+	if (flush) {
+		(void)upload_buf_swap();
 	}
-	if (base64_buf) {
-		k_free(base64_buf);
+}
+
+/* Hand the fill buffer over to the upload work and continue logging into the other one.
+ * If the previous upload is still in progress, -EBUSY is returned and the fill buffer
+ * is handed over when that upload completes.
+ */
+static int upload_buf_swap(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&upload_lock);
+
+	if (fill_buf->num_msgs == 0) {
+		k_spin_unlock(&upload_lock, key);
+		return -ENODATA;
 	}
-	ret = ring_buf_get_finish(&log_nrf_cloud_rb, stored);
-	ring_buf_reset(&log_nrf_cloud_rb);
-	num_msgs = 0;
 
-	if (ret) {
-		LOG_ERR("Error finishing ring buffer: %d", ret);
-		err = ret;
+	if (sending_buf) {
+		flush_pending = true;
+		k_spin_unlock(&upload_lock, key);
+		return -EBUSY;
 	}
+
+	/* The bulk topic requires the multiple JSON messages to be placed in
+	 * a JSON array. Close the array before sending it.
+	 */
+	if (fill_buf->format == LOG_OUTPUT_TEXT) {
+		fill_buf->data[fill_buf->len++] = ']';
+	}
+	fill_buf->data[fill_buf->len] = '\0';
+
+	sending_buf = fill_buf;
+	fill_buf = (fill_buf == &upload_bufs[0]) ? &upload_bufs[1] : &upload_bufs[0];
+	k_spin_unlock(&upload_lock, key);
+
+	k_work_reschedule_for_queue(&upload_work_q, &upload_work, K_NO_WAIT);
+
+	return 0;
+}
+
+/* Store rendered log output into the fill buffer. Returns -ENOMEM if it does not fit. */
+static int fill_buf_put(const void *data, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&upload_lock);
+	size_t extra = (log_format_current == LOG_OUTPUT_TEXT) ?
+		       1 : sizeof(struct nrf_cloud_bin_hdr);
+	int err = 0;
+
+	/* Output in different formats cannot be sent in the same message. */
+	if ((fill_buf->num_msgs != 0) && (fill_buf->format != log_format_current)) {
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	if ((fill_buf->len + extra + len) > UPLOAD_BUF_SIZE) {
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	if (fill_buf->num_msgs == 0) {
+		fill_buf->format = log_format_current;
+		/* Insert start of buffer marker */
+		if (log_format_current == LOG_OUTPUT_TEXT) {
+			/* Open JSON array */
+			fill_buf->data[fill_buf->len++] = '[';
+		} else {
+			struct nrf_cloud_bin_hdr hdr;
+
+			hdr.magic = NRF_CLOUD_BINARY_MAGIC;
+			hdr.format = NRF_CLOUD_DICT_LOG_FMT;
+			hdr.ts = log_context.ts;
+			hdr.sequence = log_context.sequence;
+			memcpy(&fill_buf->data[fill_buf->len], &hdr, sizeof(hdr));
+			fill_buf->len += sizeof(hdr);
+		}
+	} else if (log_format_current == LOG_OUTPUT_TEXT) {
+		fill_buf->data[fill_buf->len++] = ',';
+	}
+
+	memcpy(&fill_buf->data[fill_buf->len], data, len);
+	fill_buf->len += len;
+	fill_buf->num_msgs++;
+
+	stats.lines_rendered++;
+	stats.bytes_rendered += len;
+
+unlock:
+	k_spin_unlock(&upload_lock, key);
+
 	return err;
 }
 
+int nrf_cloud_log_stats_get(struct nrf_cloud_log_stats *const log_stats)
+{
+	k_spinlock_key_t key;
+
+	if (!log_stats) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&upload_lock);
+	*log_stats = stats;
+	k_spin_unlock(&upload_lock, key);
+
+	return 0;
+}
+
 static int logger_out(uint8_t *buf, size_t size, void *ctx)
 {
 	ARG_UNUSED(ctx);
 	int err = 0;
 	struct nrf_cloud_data data;
 	size_t orig_size = size;
-	uint32_t stored;
-	int extra;
-	static int retry_count;
 
 	if (!size) {
 		return 0;
@@ -441,7 +561,6 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 			return orig_size;
 		}
 
-		extra = 3;
 		if (log_context.src_name) {
 			int len = strlen(log_context.src_name);
 
@@ -462,72 +581,31 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 			goto end;
 		}
 	} else {
-		extra = sizeof(struct nrf_cloud_bin_hdr);
 		data.ptr = buf;
 		data.len = size;
 	}
 
-	stats.lines_rendered++;
-	stats.bytes_rendered += data.len;
+	if (!data.len) {
+		LOG_WRN("No data in logger_out()");
+		goto end;
+	}
 
-	do {
-		if (!data.len) {
-			LOG_WRN("No data in logger_out()");
-			break;
-		}
-		/* If there is enough room for this rendering, store it and leave. */
-		if (ring_buf_space_get(&log_nrf_cloud_rb) > (data.len + extra)) {
-
-			if (num_msgs == 0) {
-				/* Insert start of buffer marker */
-				if (log_format_current == LOG_OUTPUT_TEXT) {
-					/* Open JSON array */
-					ring_buf_put(&log_nrf_cloud_rb, "[", 1);
-				} else {
-					struct nrf_cloud_bin_hdr hdr;
-
-					hdr.magic = NRF_CLOUD_BINARY_MAGIC;
-					hdr.format = NRF_CLOUD_DICT_LOG_FMT;
-					hdr.ts = log_context.ts;
-					hdr.sequence = log_context.sequence;
-					ring_buf_put(&log_nrf_cloud_rb,
-						     (const uint8_t *)&hdr, sizeof(hdr));
-				}
-			} else if (log_format_current == LOG_OUTPUT_TEXT) {
-				ring_buf_put(&log_nrf_cloud_rb, ",", 1);
-			}
-			stored = ring_buf_put(&log_nrf_cloud_rb, data.ptr, data.len);
-			if (stored != data.len) {
-				LOG_WRN("Stored:%u, put:%u", stored, data.len);
-			}
-			num_msgs++;
-			if (log_format_current == LOG_OUTPUT_TEXT) {
-				cJSON_free((void *)data.ptr);
-			}
-			/* Stored rendered output in ring buffer, so we can exit now */
-			break;
-		}
+	err = fill_buf_put(data.ptr, data.len);
+	if ((err == -ENOMEM) && (logger_is_ready(&log_nrf_cloud_backend) == 0) &&
+	    (upload_buf_swap() == 0)) {
+		/* The other buffer is empty now */
+		err = fill_buf_put(data.ptr, data.len);
+	}
 
-		/* Low on space, so send everything. */
-		if (logger_is_ready(&log_nrf_cloud_backend) == 0) {
-			err = send_ring_buffer();
-			if (!err) {
-				retry_count = 0;
-			}
-		} else if (retry_count < LOG_OUTPUT_RETRIES) {
-			k_sleep(K_MSEC(LOG_OUTPUT_RETRY_DELAY_MS));
-			retry_count++;
-		} else {
-			if (log_format_current == LOG_OUTPUT_TEXT) {
-				cJSON_free((void *)data.ptr);
-			}
-			err = -ETIMEDOUT;
-		}
-	} while (!err);
+	if (log_format_current == LOG_OUTPUT_TEXT) {
+		cJSON_free((void *)data.ptr);
+	}
 
 	if (err) {
-		LOG_ERR("Error sending log: %d", err);
+		/* Both buffers are in use, do not block the logging thread. */
+		lines_dropped_add(1);
 	}
+
 end:
 	/* Return original size of log buffer. Otherwise, logger_out will be called
 	 * again with the remainder until the full size is sent.
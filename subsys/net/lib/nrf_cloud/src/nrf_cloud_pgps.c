@@ -104,8 +104,17 @@ static pgps_event_handler_t evt_handler;
 static uint8_t *write_buf;
 
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-static off_t prediction_cache_flash_offset = UINT32_MAX;
-static uint8_t prediction_cache[PGPS_PREDICTION_STORAGE_SIZE];
+#define PREDICTION_CACHE_COUNT		CONFIG_NRF_CLOUD_PGPS_PREDICTION_CACHE_COUNT
+
+/* Least recently used copies of predictions read from external flash */
+struct prediction_cache_entry {
+	off_t flash_offset;
+	uint32_t last_used;
+	uint8_t data[PGPS_PREDICTION_STORAGE_SIZE];
+};
+
+static struct prediction_cache_entry prediction_cache[PREDICTION_CACHE_COUNT];
+static uint32_t prediction_cache_uses;
 #endif
 
 static uint8_t prediction_buf[PGPS_PREDICTION_STORAGE_SIZE];
@@ -132,7 +141,25 @@ K_TIMER_DEFINE(prediction_timer, prediction_timer_handler, NULL);
 static void discard_prediction_buffer(void)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	prediction_cache_flash_offset = UINT32_MAX;
+	for (int i = 0; i < PREDICTION_CACHE_COUNT; i++) {
+		prediction_cache[i].flash_offset = UINT32_MAX;
+		prediction_cache[i].last_used = 0;
+	}
+#endif
+}
+
+/* Drop the cached copy of the prediction at the given offset, if any */
+static void discard_cached_prediction(off_t off)
+{
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	for (int i = 0; i < PREDICTION_CACHE_COUNT; i++) {
+		if (prediction_cache[i].flash_offset == off) {
+			prediction_cache[i].flash_offset = UINT32_MAX;
+			prediction_cache[i].last_used = 0;
+		}
+	}
+#else
+	ARG_UNUSED(off);
 #endif
 }
 
@@ -143,7 +170,8 @@ static int get_prediction_block(int pnum)
 
 /**
  * @brief When using external flash, ensure the prediction at the requested flash device offset
- * is available via the prediction cache.  When using internal flash, just the flash device offset
+ * is available via the prediction cache.  The least recently used cache entry is replaced
+ * when the prediction is not cached yet.  When using internal flash, just the flash device offset
  * as a direct pointer to the location of the prediction in flash.
  *
  * @param off Offset from the start of the flash device, when using external flash, or offset from
@@ -155,26 +183,38 @@ static int get_prediction_block(int pnum)
 static struct nrf_cloud_pgps_prediction *get_cached_prediction(off_t off)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	/* Check if the cached prediction is the one we want; if not, read it now */
-	if (prediction_cache_flash_offset != off) {
-		int err;
-
-		/* Subtract fa_off from off to convert from flash device address space
-		 * to partition address space.
-		 */
-		err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
-				      prediction_cache, sizeof(prediction_cache));
+	struct prediction_cache_entry *entry = &prediction_cache[0];
+	int err;
 
-		if (err) {
-			LOG_ERR("Error %d reading prediction from flash offset 0x%lx",
-				err, off);
-			return NULL;
+	/* Check if the prediction we want is cached; if not, read it now */
+	for (int i = 0; i < PREDICTION_CACHE_COUNT; i++) {
+		if (prediction_cache[i].flash_offset == off) {
+			prediction_cache[i].last_used = ++prediction_cache_uses;
+			return (struct nrf_cloud_pgps_prediction *)prediction_cache[i].data;
+		}
+		if (prediction_cache[i].last_used < entry->last_used) {
+			entry = &prediction_cache[i];
 		}
-		prediction_cache_flash_offset = off;
-		LOG_DBG("Caching offset 0x%X", (uint32_t)(off - prediction_flash_area->fa_off));
 	}
 
-	return (struct nrf_cloud_pgps_prediction *)prediction_cache;
+	/* Subtract fa_off from off to convert from flash device address space
+	 * to partition address space.
+	 */
+	err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
+			      entry->data, sizeof(entry->data));
+
+	if (err) {
+		LOG_ERR("Error %d reading prediction from flash offset 0x%lx",
+			err, off);
+		entry->flash_offset = UINT32_MAX;
+		entry->last_used = 0;
+		return NULL;
+	}
+	entry->flash_offset = off;
+	entry->last_used = ++prediction_cache_uses;
+	LOG_DBG("Caching offset 0x%X", (uint32_t)(off - prediction_flash_area->fa_off));
+
+	return (struct nrf_cloud_pgps_prediction *)entry->data;
 #else
 	/* The parameter off is really the address in built-in flash for the prediction */
 	return (struct nrf_cloud_pgps_prediction *)off;
@@ -331,6 +371,8 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 	int64_t start_gps_sec = index.start_sec;
 	off_t off;
 	int64_t gps_sec;
+	uint16_t pred_day;
+	uint32_t pred_time_of_day;
 
 	/* reset catalog of predictions */
 	discard_prediction_buffer();
@@ -340,7 +382,10 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 
 	npgps_reset_block_pool();
 
-	/* build catalog of predictions by block */
+	/* build catalog of predictions by block; each slot is read and
+	 * validated only once, so that the index can be built in a single
+	 * pass over flash
+	 */
 	for (i = 0; i < count; i++) {
 		pred = (struct nrf_cloud_pgps_prediction *)get_prediction_slot(i, &off);
 		if (pred == NULL) {
@@ -353,37 +398,39 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 			LOG_ERR("prediction idx:%u, ofs:%p, out of expected time range;"
 				" day:%u, time:%u", i, (void *)pred, pred->time.date_day,
 				pred->time.time_full_s);
-		} else if (index.predictions[pnum] == NULL) {
-			index.predictions[pnum] = (struct nrf_cloud_pgps_prediction *)off;
-			LOG_DBG("Prediction num:%u stored at idx:%d, off:0x%lX",
-				pnum, i, (unsigned long) off);
-		} else {
+			continue;
+		} else if (index.predictions[pnum] != NULL) {
 			LOG_WRN("Prediction num:%u stored more than once!", pnum);
+			continue;
 		}
-	}
 
-	/* validate predictions in time order, independent of storage order */
-	i = -1;
-	for (pnum = 0; pnum < count; pnum++) {
 		/* calculate expected time signature */
 		gps_sec = start_gps_sec + pnum * period_min * SEC_PER_MIN;
-		npgps_gps_sec_to_day_time(gps_sec, &gps_day, &gps_time_of_day);
-
-		pred = get_prediction(pnum);
-		if (pred == NULL) {
-			LOG_WRN("Prediction num:%u missing", pnum);
-			/* request partial data; download interrupted? */
-			*first_bad_day = gps_day;
-			*first_bad_time = gps_time_of_day;
-			break;
-		}
+		npgps_gps_sec_to_day_time(gps_sec, &pred_day, &pred_time_of_day);
 
-		err = validate_prediction(pred, gps_day, gps_time_of_day,
+		err = validate_prediction(pred, pred_day, pred_time_of_day,
 					  period_min, true, false);
 		if (err) {
 			LOG_ERR("Prediction num:%u, gps_day:%u, "
-				"gps_time_of_day:%u is bad:%d; loc:%p",
-				pnum, gps_day, gps_time_of_day, err, pred);
+				"gps_time_of_day:%u is bad:%d; idx:%d",
+				pnum, pred_day, pred_time_of_day, err, i);
+			continue;
+		}
+
+		index.predictions[pnum] = (struct nrf_cloud_pgps_prediction *)off;
+		LOG_DBG("Prediction num:%u stored at idx:%d, off:0x%lX",
+			pnum, i, (unsigned long) off);
+	}
+
+	/* check for predictions in time order, independent of storage order */
+	i = -1;
+	for (pnum = 0; pnum < count; pnum++) {
+		if (index.predictions[pnum] == NULL) {
+			/* calculate expected time signature */
+			gps_sec = start_gps_sec + pnum * period_min * SEC_PER_MIN;
+			npgps_gps_sec_to_day_time(gps_sec, &gps_day, &gps_time_of_day);
+
+			LOG_WRN("Prediction num:%u missing or bad", pnum);
 			/* request partial data; download interrupted? */
 			*first_bad_day = gps_day;
 			*first_bad_time = gps_time_of_day;
@@ -391,8 +438,8 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 		}
 
 		i = get_prediction_block(pnum);
-		LOG_DBG("Prediction num:%u, loc:%p, blk:%d", pnum, pred, i);
-		__ASSERT(i != NO_BLOCK, "unexpected pointer value %p", pred);
+		LOG_DBG("Prediction num:%u, blk:%d", pnum, i);
+		__ASSERT(i != NO_BLOCK, "unexpected pointer value %p", index.predictions[pnum]);
 		npgps_mark_block_used(i, true);
 	}
 
@@ -687,6 +734,8 @@ int nrf_cloud_pgps_find_prediction(struct nrf_cloud_pgps_prediction **prediction
 			start_expiration_timer(pnum, cur_gps_sec);
 			return pnum;
 		}
+		/* the prediction may not have been flushed to flash yet when it was read */
+		discard_cached_prediction((off_t)index.predictions[pnum]);
 		return err;
 	}
 	if (nrf_cloud_pgps_loading()) {
@@ -1305,9 +1354,6 @@ int nrf_cloud_pgps_process_update(uint8_t *buf, size_t len)
 		index.pred_offset = 0;
 	}
 
-	/* assume cache is no longer valid */
-	discard_prediction_buffer();
-
 	need = MIN((PGPS_PREDICTION_DL_SIZE - index.pred_offset), len);
 	memcpy(&prediction_buf[index.pred_offset], buf, need);
 	LOG_DBG("need:%zd bytes; pred_offset:%u, fragment len:%zd, dl_ofs:%zd",
@@ -1483,6 +1529,8 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 			store_prediction(prediction_ptr, buf_len, (uint32_t)gps_sec,
 					 finished || (index.storage_extent == 1));
 			index.predictions[pnum] = npgps_block_to_pointer(index.store_block);
+			/* only the block just stored changes, other cached predictions stay valid */
+			discard_cached_prediction((off_t)index.predictions[pnum]);
 
 			if (!finished) {
 				if (pgps_need_assistance && (index.loading_count > 1)) {
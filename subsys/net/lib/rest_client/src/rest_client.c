@@ -14,6 +14,7 @@
 #include <zephyr/posix/arpa/inet.h>
 #include <zephyr/posix/unistd.h>
 #include <zephyr/posix/netdb.h>
+#include <zephyr/posix/poll.h>
 #include <zephyr/posix/sys/socket.h>
 #else
 #include <zephyr/net/socket.h>
@@ -30,6 +31,211 @@ LOG_MODULE_REGISTER(rest_client, CONFIG_REST_CLIENT_LOG_LEVEL);
 
 #define HTTP_PROTOCOL "HTTP/1.1"
 
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+#define CONN_POOL_IDLE_TIMEOUT_MS (CONFIG_REST_CLIENT_CONN_POOL_IDLE_TIMEOUT * MSEC_PER_SEC)
+
+/* Idle connection that can be reused for a request with the same destination. */
+struct conn_pool_entry {
+	bool idle;
+	int fd;
+	uint16_t port;
+	int sec_tag;
+	int tls_peer_verify;
+	int64_t last_used;
+	char host[CONFIG_REST_CLIENT_CONN_POOL_HOST_LEN];
+};
+
+static struct conn_pool_entry conn_pool[CONFIG_REST_CLIENT_CONN_POOL_SIZE];
+static K_MUTEX_DEFINE(conn_pool_mtx);
+
+static void conn_pool_idle_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(conn_pool_idle_work, conn_pool_idle_work_fn);
+
+static void conn_pool_entry_close(struct conn_pool_entry *entry)
+{
+	LOG_DBG("Closing pooled socket %d to %s:%d", entry->fd, entry->host, entry->port);
+
+	if (close(entry->fd)) {
+		LOG_WRN("Failed to close pooled socket, error: %d", errno);
+	}
+	entry->idle = false;
+}
+
+/* Closes the connections that have been idle for too long. Returns the time in milliseconds
+ * until the next connection expires, or SYS_FOREVER_MS if the pool is empty.
+ */
+static int32_t conn_pool_expired_evict(void)
+{
+	int64_t now = k_uptime_get();
+	int32_t next_expiry = SYS_FOREVER_MS;
+
+	for (size_t i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		int64_t idle_time;
+
+		if (!conn_pool[i].idle) {
+			continue;
+		}
+
+		idle_time = now - conn_pool[i].last_used;
+		if (idle_time >= CONN_POOL_IDLE_TIMEOUT_MS) {
+			conn_pool_entry_close(&conn_pool[i]);
+		} else if (next_expiry == SYS_FOREVER_MS ||
+			   (CONN_POOL_IDLE_TIMEOUT_MS - idle_time) < next_expiry) {
+			next_expiry = CONN_POOL_IDLE_TIMEOUT_MS - idle_time;
+		}
+	}
+
+	return next_expiry;
+}
+
+static void conn_pool_idle_work_fn(struct k_work *work)
+{
+	int32_t next_expiry;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&conn_pool_mtx, K_FOREVER);
+	next_expiry = conn_pool_expired_evict();
+	k_mutex_unlock(&conn_pool_mtx);
+
+	if (next_expiry != SYS_FOREVER_MS) {
+		k_work_schedule(&conn_pool_idle_work, K_MSEC(next_expiry));
+	}
+}
+
+static bool conn_pool_entry_match(const struct conn_pool_entry *entry,
+				  const struct rest_client_req_context *const req_ctx)
+{
+	return entry->idle &&
+	       entry->port == req_ctx->port &&
+	       entry->sec_tag == req_ctx->sec_tag &&
+	       entry->tls_peer_verify == req_ctx->tls_peer_verify &&
+	       strcmp(entry->host, req_ctx->host) == 0;
+}
+
+/* A connection that the server has closed, or that has unexpected data pending,
+ * is readable while it is idle.
+ */
+static bool conn_pool_sckt_is_usable(int fd)
+{
+	struct pollfd fds = {
+		.fd = fd,
+		.events = POLLIN,
+	};
+
+	return poll(&fds, 1, 0) == 0;
+}
+
+/* Takes the most recently used idle connection to the request destination out of the pool.
+ * Returns the socket, or REST_CLIENT_SCKT_CONNECT if there is none.
+ */
+static int conn_pool_take(const struct rest_client_req_context *const req_ctx)
+{
+	struct conn_pool_entry *entry;
+	int fd;
+
+	while (true) {
+		entry = NULL;
+		fd = REST_CLIENT_SCKT_CONNECT;
+
+		k_mutex_lock(&conn_pool_mtx, K_FOREVER);
+
+		(void)conn_pool_expired_evict();
+
+		for (size_t i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+			if (conn_pool_entry_match(&conn_pool[i], req_ctx) &&
+			    (!entry || conn_pool[i].last_used > entry->last_used)) {
+				entry = &conn_pool[i];
+			}
+		}
+
+		if (entry) {
+			fd = entry->fd;
+			entry->idle = false;
+		}
+
+		k_mutex_unlock(&conn_pool_mtx);
+
+		if (fd >= 0 && !conn_pool_sckt_is_usable(fd)) {
+			LOG_DBG("Pooled socket %d was closed by the server", fd);
+			(void)close(fd);
+			continue;
+		}
+
+		break;
+	}
+
+	if (fd >= 0) {
+		LOG_DBG("Reusing pooled socket %d to %s:%d", fd, req_ctx->host, req_ctx->port);
+	}
+
+	return fd;
+}
+
+/* Returns an idle connection into the pool. The least recently used connection is
+ * closed if the pool is full. Returns false if the connection cannot be pooled.
+ */
+static bool conn_pool_put(const struct rest_client_req_context *const req_ctx)
+{
+	struct conn_pool_entry *entry = NULL;
+
+	if (strlen(req_ctx->host) >= sizeof(conn_pool[0].host)) {
+		return false;
+	}
+
+	k_mutex_lock(&conn_pool_mtx, K_FOREVER);
+
+	(void)conn_pool_expired_evict();
+
+	for (size_t i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		if (!conn_pool[i].idle) {
+			entry = &conn_pool[i];
+			break;
+		}
+
+		if (!entry || conn_pool[i].last_used < entry->last_used) {
+			entry = &conn_pool[i];
+		}
+	}
+
+	if (entry->idle) {
+		conn_pool_entry_close(entry);
+	}
+
+	entry->fd = req_ctx->connect_socket;
+	entry->port = req_ctx->port;
+	entry->sec_tag = req_ctx->sec_tag;
+	entry->tls_peer_verify = req_ctx->tls_peer_verify;
+	entry->last_used = k_uptime_get();
+	strcpy(entry->host, req_ctx->host);
+	entry->idle = true;
+
+	k_mutex_unlock(&conn_pool_mtx);
+
+	/* Does nothing if the idle timer is already running. */
+	k_work_schedule(&conn_pool_idle_work, K_MSEC(CONN_POOL_IDLE_TIMEOUT_MS));
+
+	LOG_DBG("Socket %d to %s:%d was returned to the pool",
+		req_ctx->connect_socket, req_ctx->host, req_ctx->port);
+
+	return true;
+}
+#else
+static int conn_pool_take(const struct rest_client_req_context *const req_ctx)
+{
+	ARG_UNUSED(req_ctx);
+
+	return REST_CLIENT_SCKT_CONNECT;
+}
+
+static bool conn_pool_put(const struct rest_client_req_context *const req_ctx)
+{
+	ARG_UNUSED(req_ctx);
+
+	return false;
+}
+#endif /* CONFIG_REST_CLIENT_CONN_POOL */
+
 static void rest_client_http_response_cb(struct http_response *rsp,
 					  enum http_final_call final_data,
 					  void *user_data)
@@ -263,11 +469,17 @@ clean_up:
 }
 
 static void rest_client_close_connection(struct rest_client_req_context *const req_ctx,
-					 struct rest_client_resp_context *const resp_ctx)
+					 struct rest_client_resp_context *const resp_ctx,
+					 bool reusable)
 {
 	int ret;
 
 	if (!req_ctx->keep_alive) {
+		if (reusable && conn_pool_put(req_ctx)) {
+			req_ctx->connect_socket = REST_CLIENT_SCKT_CONNECT;
+			return;
+		}
+
 		ret = close(req_ctx->connect_socket);
 		if (ret) {
 			LOG_WRN("Failed to close socket, error: %d", errno);
@@ -292,11 +504,54 @@ static void rest_client_init_request(struct rest_client_req_context *const req_c
 	req->method = req_ctx->http_method;
 }
 
+static int rest_client_http_req_send(struct http_request *http_req,
+				     struct rest_client_req_context *const req_ctx,
+				     struct rest_client_resp_context *const resp_ctx)
+{
+	/* Assign the user provided receive buffer into the http request */
+	http_req->recv_buf = req_ctx->resp_buff;
+	http_req->recv_buf_len = req_ctx->resp_buff_len;
+
+	memset(http_req->recv_buf, 0, http_req->recv_buf_len);
+
+	/* Ensure receive buffer stays NULL terminated */
+	--http_req->recv_buf_len;
+
+	resp_ctx->response = NULL;
+	resp_ctx->response_len = 0;
+	resp_ctx->total_response_len = 0;
+	resp_ctx->used_socket_id = req_ctx->connect_socket;
+	resp_ctx->http_status_code_str[0] = '\0';
+
+	return http_client_req(req_ctx->connect_socket, http_req, req_ctx->timeout_ms, resp_ctx);
+}
+
+/* Requests that can be sent again without changing the result on the server. */
+static bool rest_client_method_is_idempotent(enum http_method method)
+{
+	switch (method) {
+	case HTTP_GET:
+	case HTTP_HEAD:
+	case HTTP_PUT:
+	case HTTP_DELETE:
+	case HTTP_OPTIONS:
+		return true;
+	default:
+		return false;
+	}
+}
+
 static int rest_client_do_api_call(struct http_request *http_req,
 				   struct rest_client_req_context *const req_ctx,
 				   struct rest_client_resp_context *const resp_ctx)
 {
 	int err = 0;
+	bool pooled = false;
+
+	if (req_ctx->connect_socket < 0 && !req_ctx->keep_alive) {
+		req_ctx->connect_socket = conn_pool_take(req_ctx);
+		pooled = (req_ctx->connect_socket >= 0);
+	}
 
 	if (req_ctx->connect_socket < 0) {
 		err = rest_client_sckt_connect(&req_ctx->connect_socket,
@@ -310,22 +565,31 @@ static int rest_client_do_api_call(struct http_request *http_req,
 		}
 	}
 
-	/* Assign the user provided receive buffer into the http request */
-	http_req->recv_buf = req_ctx->resp_buff;
-	http_req->recv_buf_len = req_ctx->resp_buff_len;
+	err = rest_client_http_req_send(http_req, req_ctx, resp_ctx);
+	if (err < 0 && pooled && !resp_ctx->total_response_len &&
+	    rest_client_method_is_idempotent(http_req->method)) {
+		/* The server may close an idle connection at any time. Nothing was received,
+		 * so send the request again over a new connection. The server may still have
+		 * received the request, so this is only done for idempotent methods.
+		 */
+		LOG_DBG("Pooled socket %d failed, error: %d, reconnecting",
+			req_ctx->connect_socket, err);
 
-	memset(http_req->recv_buf, 0, http_req->recv_buf_len);
+		(void)close(req_ctx->connect_socket);
 
-	/* Ensure receive buffer stays NULL terminated */
-	--http_req->recv_buf_len;
+		err = rest_client_sckt_connect(&req_ctx->connect_socket,
+						http_req->host,
+						req_ctx->port,
+						req_ctx->sec_tag,
+						req_ctx->tls_peer_verify,
+						&req_ctx->timeout_ms);
+		if (err) {
+			return err;
+		}
 
-	resp_ctx->response = NULL;
-	resp_ctx->response_len = 0;
-	resp_ctx->total_response_len = 0;
-	resp_ctx->used_socket_id = req_ctx->connect_socket;
-	resp_ctx->http_status_code_str[0] = '\0';
+		err = rest_client_http_req_send(http_req, req_ctx, resp_ctx);
+	}
 
-	err = http_client_req(req_ctx->connect_socket, http_req, req_ctx->timeout_ms, resp_ctx);
 	if (err < 0) {
 		LOG_ERR("http_client_req() error: %d", err);
 	} else if (resp_ctx->total_response_len >= req_ctx->resp_buff_len) {
@@ -366,6 +630,8 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 
 	struct http_request http_req;
 	int ret;
+	/* Only connections opened by the library can be pooled. */
+	bool poolable = (req_ctx->connect_socket < 0);
 
 	rest_client_init_request(req_ctx, &http_req);
 
@@ -409,7 +675,26 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 clean_up:
 	if (req_ctx->connect_socket != REST_CLIENT_SCKT_CONNECT) {
 		/* Socket was not closed yet: */
-		rest_client_close_connection(req_ctx, resp_ctx);
+		rest_client_close_connection(req_ctx, resp_ctx,
+					     poolable && !ret &&
+					     http_should_keep_alive(&http_req.internal.parser));
 	}
 	return ret;
 }
+
+void rest_client_conn_pool_flush(void)
+{
+#if defined(CONFIG_REST_CLIENT_CONN_POOL)
+	k_mutex_lock(&conn_pool_mtx, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		if (conn_pool[i].idle) {
+			conn_pool_entry_close(&conn_pool[i]);
+		}
+	}
+
+	k_mutex_unlock(&conn_pool_mtx);
+
+	(void)k_work_cancel_delayable(&conn_pool_idle_work);
+#endif
+}
@@ -9,6 +9,8 @@
 #include <zephyr/sys/util.h>
 #include <errno.h>
 
+#include "record_local.h"
+
 /* Resolve the value of record location flags of the NFC NDEF record
  * within an NFC NDEF message.
  */
@@ -79,6 +81,66 @@ int nfc_ndef_msg_encode(struct nfc_ndef_msg_desc const *ndef_msg_desc,
 	return 0;
 }
 
+int nfc_ndef_msg_encode_part(struct nfc_ndef_msg_desc const *ndef_msg_desc,
+			     uint32_t offset,
+			     uint8_t *buffer,
+			     uint32_t *len)
+{
+	uint32_t record_offset = 0;
+	uint32_t written = 0;
+
+	if (!ndef_msg_desc || !ndef_msg_desc->record || !buffer || !len) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0;
+	     (i < ndef_msg_desc->record_count) && (written < *len);
+	     i++) {
+		struct nfc_ndef_record_desc const *record =
+						ndef_msg_desc->record[i];
+		enum nfc_ndef_record_location record_location;
+		uint32_t payload_len;
+		uint32_t record_len;
+		int err;
+
+		record_location =
+			 record_location_get(i, ndef_msg_desc->record_count);
+
+		/* The payload length is calculated once and reused when the
+		 * record is encoded. The records preceding the part are not
+		 * encoded.
+		 */
+		err = nfc_ndef_record_len_get(record, &record_len,
+					      &payload_len);
+		if (err) {
+			return err;
+		}
+
+		if ((offset + written) < (record_offset + record_len)) {
+			uint32_t part_len = *len - written;
+
+			err = nfc_ndef_record_encode_part_internal(
+						record,
+						record_location,
+						payload_len,
+						offset + written - record_offset,
+						&buffer[written],
+						&part_len);
+			if (err) {
+				return err;
+			}
+
+			written += part_len;
+		}
+
+		record_offset += record_len;
+	}
+
+	*len = written;
+
+	return 0;
+}
+
 void nfc_ndef_msg_clear(struct nfc_ndef_msg_desc *msg)
 {
 	msg->record_count = 0;
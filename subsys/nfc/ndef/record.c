@@ -7,13 +7,33 @@
 #include <string.h>
 #include <errno.h>
 #include <nfc/ndef/record.h>
+#include <nfc/ndef/msg.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "record_local.h"
 
 /* Sum of sizes of fields: TNF-flags, Type Length, Payload Length in long
  * NDEF record.
  */
 #define NDEF_RECORD_BASE_LONG_SIZE (2 + NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE)
 
+/* Part of an encoded NDEF record requested by the caller. The record fields
+ * are processed in order and only their bytes within the part are written.
+ */
+struct record_part {
+	/* Offset of the part within the record. */
+	uint32_t offset;
+	/* Destination of the part. */
+	uint8_t *buffer;
+	/* Requested length of the part. */
+	uint32_t len;
+	/* Offset of the currently processed field within the record. */
+	uint32_t pos;
+	/* Number of bytes written to the destination. */
+	uint32_t written;
+};
+
 static uint32_t record_header_size_calc(
 			struct nfc_ndef_record_desc const *ndef_record_desc)
 {
@@ -122,6 +142,227 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 	return 0;
 }
 
+int nfc_ndef_record_len_get(struct nfc_ndef_record_desc const *ndef_record_desc,
+			    uint32_t *record_len,
+			    uint32_t *payload_len)
+{
+	*payload_len = 0;
+
+	if (ndef_record_desc->tnf != TNF_EMPTY) {
+		int err;
+
+		if (!ndef_record_desc->payload_constructor) {
+			return -EINVAL;
+		}
+
+		err = ndef_record_desc->payload_constructor(
+					ndef_record_desc->payload_descriptor,
+					NULL,
+					payload_len);
+		if (err) {
+			return err;
+		}
+	}
+
+	*record_len = record_header_size_calc(ndef_record_desc) + *payload_len;
+
+	return 0;
+}
+
+/* Get the range of the field that lies within the requested part.
+ * Return false if the field and the part do not overlap.
+ */
+static bool field_part_get(struct record_part *part, uint32_t field_len,
+			   uint32_t *start, uint32_t *end)
+{
+	*start = MAX(part->pos, part->offset);
+	*end = MIN(part->pos + field_len, part->offset + part->len);
+
+	return *start < *end;
+}
+
+static void field_part_copy(struct record_part *part, uint8_t const *field,
+			    uint32_t field_len)
+{
+	uint32_t start;
+	uint32_t end;
+
+	if (field_part_get(part, field_len, &start, &end)) {
+		memcpy(&part->buffer[start - part->offset],
+		       &field[start - part->pos],
+		       end - start);
+		part->written = end - part->offset;
+	}
+
+	part->pos += field_len;
+}
+
+static int payload_part_generate(
+			struct nfc_ndef_record_desc const *ndef_record_desc,
+			uint32_t offset,
+			uint8_t *buffer,
+			uint32_t len)
+{
+	uint8_t payload[CONFIG_NFC_NDEF_RECORD_ENCODE_PART_BUF_SIZE];
+	uint32_t payload_len = sizeof(payload);
+	int err;
+
+	err = ndef_record_desc->payload_constructor(
+					ndef_record_desc->payload_descriptor,
+					payload,
+					&payload_len);
+	if (err) {
+		return err;
+	}
+
+	if ((offset + len) > payload_len) {
+		return -EIO;
+	}
+
+	memcpy(buffer, &payload[offset], len);
+
+	return 0;
+}
+
+static int payload_part_encode(struct record_part *part,
+			       struct nfc_ndef_record_desc const *ndef_record_desc,
+			       uint32_t payload_len)
+{
+	payload_constructor_t constructor = ndef_record_desc->payload_constructor;
+	uint32_t start;
+	uint32_t end;
+	uint32_t len;
+	uint8_t *dst;
+	int err;
+
+	if (!field_part_get(part, payload_len, &start, &end)) {
+		part->pos += payload_len;
+		return 0;
+	}
+
+	dst = &part->buffer[start - part->offset];
+	len = end - start;
+
+	if (constructor == (payload_constructor_t)nfc_ndef_bin_payload_memcopy) {
+		struct nfc_ndef_bin_payload_desc const *bin_desc =
+			ndef_record_desc->payload_descriptor;
+
+		memcpy(dst, &bin_desc->payload[start - part->pos], len);
+		err = 0;
+	} else if (IS_ENABLED(CONFIG_NFC_NDEF_MSG) &&
+		   (constructor == (payload_constructor_t)nfc_ndef_msg_encode)) {
+		err = nfc_ndef_msg_encode_part(ndef_record_desc->payload_descriptor,
+					       start - part->pos,
+					       dst,
+					       &len);
+		if (!err && (len != (end - start))) {
+			err = -EIO;
+		}
+	} else if (len == payload_len) {
+		/* The whole payload is requested, so it is constructed
+		 * directly in the destination.
+		 */
+		err = constructor(ndef_record_desc->payload_descriptor, dst, &len);
+		if (!err && (len != payload_len)) {
+			err = -EIO;
+		}
+	} else {
+		err = payload_part_generate(ndef_record_desc, start - part->pos,
+					    dst, len);
+	}
+
+	if (err) {
+		return err;
+	}
+
+	part->written = end - part->offset;
+	part->pos += payload_len;
+
+	return 0;
+}
+
+int nfc_ndef_record_encode_part_internal(
+			struct nfc_ndef_record_desc const *ndef_record_desc,
+			enum nfc_ndef_record_location const record_location,
+			uint32_t payload_len,
+			uint32_t offset,
+			uint8_t *buffer,
+			uint32_t *len)
+{
+	uint8_t header[NDEF_RECORD_BASE_LONG_SIZE + NDEF_RECORD_ID_LEN_SIZE];
+	uint32_t header_len = 0;
+	struct record_part part;
+	int err;
+
+	/* TNF + flags, TYPE LENGTH, PAYLOAD LENGTH and ID LENGTH fields. */
+	header[header_len] = record_location | ndef_record_desc->tnf;
+	if (ndef_record_desc->id_length > 0) {
+		header[header_len] |= NDEF_RECORD_IL_MASK;
+	}
+	header_len++;
+	header[header_len++] = ndef_record_desc->type_length;
+	sys_put_be32(payload_len, &header[header_len]);
+	header_len += NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE;
+	if (ndef_record_desc->id_length > 0) {
+		header[header_len++] = ndef_record_desc->id_length;
+	}
+
+	part.offset = offset;
+	part.buffer = buffer;
+	part.len = *len;
+	part.pos = 0;
+	part.written = 0;
+
+	field_part_copy(&part, header, header_len);
+	field_part_copy(&part, ndef_record_desc->type,
+			ndef_record_desc->type_length);
+	field_part_copy(&part, ndef_record_desc->id,
+			ndef_record_desc->id_length);
+
+	err = payload_part_encode(&part, ndef_record_desc, payload_len);
+	if (err) {
+		return err;
+	}
+
+	*len = part.written;
+
+	return 0;
+}
+
+int nfc_ndef_record_encode_part(
+			struct nfc_ndef_record_desc const *ndef_record_desc,
+			enum nfc_ndef_record_location const record_location,
+			uint32_t offset,
+			uint8_t *buffer,
+			uint32_t *len)
+{
+	uint32_t payload_len;
+	uint32_t record_len;
+	int err;
+
+	if (!ndef_record_desc || !buffer || !len) {
+		return -EINVAL;
+	}
+
+	/* verify location range */
+	if (record_location & (~NDEF_RECORD_LOCATION_MASK)) {
+		return -EINVAL;
+	}
+
+	err = nfc_ndef_record_len_get(ndef_record_desc, &record_len,
+				      &payload_len);
+	if (err) {
+		return err;
+	}
+
+	return nfc_ndef_record_encode_part_internal(ndef_record_desc,
+						    record_location,
+						    payload_len,
+						    offset,
+						    buffer,
+						    len);
+}
+
 int nfc_ndef_bin_payload_memcopy(
 			struct nfc_ndef_bin_payload_desc *payload_descriptor,
 			uint8_t *buffer,
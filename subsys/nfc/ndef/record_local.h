@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef NFC_NDEF_RECORD_LOCAL_H_
+#define NFC_NDEF_RECORD_LOCAL_H_
+
+/**@file
+ * @defgroup nfc_ndef_record_local NDEF record generator (internal)
+ * @{
+ * @brief    Internal part of the generator for NFC NDEF records.
+ */
+
+#include <stdint.h>
+#include <zephyr/types.h>
+#include <nfc/ndef/record.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Function for calculating the length of an NDEF record.
+ *
+ *  The payload constructor of the record is called once to get the payload
+ *  length.
+ *
+ *  @param[in] ndef_record_desc Pointer to the record descriptor.
+ *  @param[out] record_len Length of the encoded record.
+ *  @param[out] payload_len Length of the record payload.
+ *
+ *  @retval 0 If the operation was successful.
+ *            Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_record_len_get(struct nfc_ndef_record_desc const *ndef_record_desc,
+			    uint32_t *record_len,
+			    uint32_t *payload_len);
+
+/** @brief Function for encoding a part of an NDEF record with a known
+ *         payload length.
+ *
+ *  This internal function works like @ref nfc_ndef_record_encode_part, but
+ *  it uses the payload length calculated by the caller and does not
+ *  validate the arguments.
+ *
+ *  This function should not be used directly.
+ *
+ *  @param[in] ndef_record_desc Pointer to the record descriptor.
+ *  @param[in] record_location Location of the record within the NDEF message.
+ *  @param[in] payload_len Length of the record payload.
+ *  @param[in] offset Offset of the part within the record.
+ *  @param[out] buffer Pointer to the part destination.
+ *  @param[in,out] len As input: requested length of the part.
+ *                     As output: size of the encoded part.
+ *
+ *  @retval 0 If the operation was successful.
+ *            Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_record_encode_part_internal(
+			struct nfc_ndef_record_desc const *ndef_record_desc,
+			enum nfc_ndef_record_location const record_location,
+			uint32_t payload_len,
+			uint32_t offset,
+			uint8_t *buffer,
+			uint32_t *len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NFC_NDEF_RECORD_LOCAL_H_ */
@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#include "osal_ops.h"
+#include "list.h"
+#include "queue.h"
+#include "hal_api.h"
+#include "fmac_api.h"
+#include "fmac_tx.h"
+#include "fmac_peer.h"
+
+/* Byte credit a peer gets on each turn, that is, the A-MPDU length per token. */
+#define QUANTUM 3000
+#define MAX_TX_AGGREGATION 16
+#define TX_DESC 0
+
+/* Number of frames kept queued for backlogged peers. */
+#define BACKLOG 32
+#define ROUNDS 200
+
+int tx_curr_peer_opp_get(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, unsigned int ac);
+size_t _tx_pending_process(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, unsigned int desc,
+			   unsigned int ac);
+enum wifi_nrf_status tx_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, void *nwb,
+				unsigned int ac, unsigned int peer_id);
+int pending_frames_count(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, int peer_id);
+
+struct test_nbuf {
+	unsigned int len;
+	unsigned char data[];
+};
+
+struct test_llist_node {
+	sys_dnode_t head;
+	void *data;
+};
+
+struct test_llist {
+	sys_dlist_t head;
+	unsigned int len;
+};
+
+static struct wifi_nrf_fmac_priv fpriv;
+static struct wifi_nrf_fmac_dev_ctx fmac_dev_ctx;
+static struct wifi_nrf_fmac_vif_ctx vif_ctx;
+static struct tx_pkt_info pkt_info;
+static int tx_lock;
+
+static unsigned int nbufs_allocated;
+static unsigned int llist_len_calls;
+
+/* Bytes sent to each peer, including the TX buffer headroom. */
+static unsigned int bytes_sent[MAX_SW_PEERS];
+
+static void *test_mem_zalloc(size_t size)
+{
+	return k_calloc(size, sizeof(char));
+}
+
+static void *test_spinlock_alloc(void)
+{
+	return &tx_lock;
+}
+
+static void test_spinlock_nop(void *lock)
+{
+	ARG_UNUSED(lock);
+}
+
+static int test_log(const char *fmt, va_list args)
+{
+	ARG_UNUSED(fmt);
+	ARG_UNUSED(args);
+
+	return 0;
+}
+
+static void *test_llist_node_alloc(void)
+{
+	return k_calloc(sizeof(struct test_llist_node), sizeof(char));
+}
+
+static void *test_llist_node_data_get(void *node)
+{
+	return ((struct test_llist_node *)node)->data;
+}
+
+static void test_llist_node_data_set(void *node, void *data)
+{
+	((struct test_llist_node *)node)->data = data;
+}
+
+static void *test_llist_alloc(void)
+{
+	return k_calloc(sizeof(struct test_llist), sizeof(char));
+}
+
+static void test_llist_init(void *llist)
+{
+	struct test_llist *list = llist;
+
+	sys_dlist_init(&list->head);
+	list->len = 0;
+}
+
+static void test_llist_add_node_tail(void *llist, void *llist_node)
+{
+	struct test_llist *list = llist;
+	struct test_llist_node *node = llist_node;
+
+	sys_dlist_append(&list->head, &node->head);
+	list->len++;
+}
+
+static void *test_llist_get_node_head(void *llist)
+{
+	return sys_dlist_peek_head(&((struct test_llist *)llist)->head);
+}
+
+static void *test_llist_get_node_nxt(void *llist, void *llist_node)
+{
+	return sys_dlist_peek_next(&((struct test_llist *)llist)->head,
+				   &((struct test_llist_node *)llist_node)->head);
+}
+
+static void test_llist_del_node(void *llist, void *llist_node)
+{
+	sys_dlist_remove(&((struct test_llist_node *)llist_node)->head);
+	((struct test_llist *)llist)->len--;
+}
+
+static unsigned int test_llist_len(void *llist)
+{
+	llist_len_calls++;
+
+	return ((struct test_llist *)llist)->len;
+}
+
+static void test_nbuf_free(void *nbuf)
+{
+	nbufs_allocated--;
+	k_free(nbuf);
+}
+
+static unsigned int test_nbuf_data_size(void *nbuf)
+{
+	return ((struct test_nbuf *)nbuf)->len;
+}
+
+static void *test_nbuf_data_get(void *nbuf)
+{
+	return ((struct test_nbuf *)nbuf)->data;
+}
+
+static const struct wifi_nrf_osal_ops test_ops = {
+	.mem_alloc = k_malloc,
+	.mem_zalloc = test_mem_zalloc,
+	.mem_free = k_free,
+	.mem_cpy = memcpy,
+	.mem_set = memset,
+
+	.spinlock_alloc = test_spinlock_alloc,
+	.spinlock_free = test_spinlock_nop,
+	.spinlock_init = test_spinlock_nop,
+	.spinlock_take = test_spinlock_nop,
+	.spinlock_rel = test_spinlock_nop,
+
+	.log_dbg = test_log,
+	.log_info = test_log,
+	.log_err = test_log,
+
+	.llist_node_alloc = test_llist_node_alloc,
+	.llist_node_free = k_free,
+	.llist_node_data_get = test_llist_node_data_get,
+	.llist_node_data_set = test_llist_node_data_set,
+
+	.llist_alloc = test_llist_alloc,
+	.llist_free = k_free,
+	.llist_init = test_llist_init,
+	.llist_add_node_tail = test_llist_add_node_tail,
+	.llist_get_node_head = test_llist_get_node_head,
+	.llist_get_node_nxt = test_llist_get_node_nxt,
+	.llist_del_node = test_llist_del_node,
+	.llist_len = test_llist_len,
+
+	.nbuf_free = test_nbuf_free,
+	.nbuf_data_size = test_nbuf_data_size,
+	.nbuf_data_get = test_nbuf_data_get,
+};
+
+const struct wifi_nrf_osal_ops *get_os_ops(void)
+{
+	return &test_ops;
+}
+
+/* The HAL and the UMAC commands are not used by the scheduler. */
+struct host_rpu_msg *umac_cmd_alloc(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, int type,
+				    int size)
+{
+	return NULL;
+}
+
+enum wifi_nrf_status wifi_nrf_hal_data_cmd_send(struct wifi_nrf_hal_dev_ctx *hal_ctx,
+						enum WIFI_NRF_HAL_MSG_TYPE cmd_type,
+						void *data_cmd,
+						unsigned int data_cmd_size,
+						unsigned int desc_id,
+						unsigned int pool_id)
+{
+	return WIFI_NRF_STATUS_FAIL;
+}
+
+unsigned long wifi_nrf_hal_buf_map_tx(struct wifi_nrf_hal_dev_ctx *hal_ctx, unsigned long buf,
+				      unsigned int buf_len, unsigned int desc_id,
+				      unsigned int token, unsigned int buf_indx)
+{
+	return 0;
+}
+
+unsigned long wifi_nrf_hal_buf_unmap_tx(struct wifi_nrf_hal_dev_ctx *hal_ctx,
+					unsigned int desc_id)
+{
+	return 0;
+}
+
+enum wifi_nrf_status hal_rpu_mem_write(struct wifi_nrf_hal_dev_ctx *hal_ctx,
+				       unsigned int rpu_mem_addr, void *host_addr,
+				       unsigned int len)
+{
+	return WIFI_NRF_STATUS_SUCCESS;
+}
+
+/* Queue a frame of frame_len bytes, TX buffer headroom included, for a peer. */
+static void frame_enqueue(unsigned int peer_id, unsigned int frame_len)
+{
+	unsigned int len = frame_len - TX_BUF_HEADROOM;
+	struct test_nbuf *nbuf;
+
+	nbuf = k_calloc(sizeof(*nbuf) + len, sizeof(char));
+	zassert_not_null(nbuf);
+
+	nbuf->len = len;
+	/* Destination and source addresses */
+	nbuf->data[0] = peer_id;
+	nbuf->data[NRF_WIFI_ETH_ADDR_LEN] = 0xAA;
+	nbufs_allocated++;
+
+	zassert_equal(tx_enqueue(&fmac_dev_ctx, nbuf, WIFI_NRF_FMAC_AC_BE, peer_id),
+		      WIFI_NRF_STATUS_SUCCESS);
+}
+
+static void backlog_fill(unsigned int peer_id, unsigned int frame_len)
+{
+	while (fmac_dev_ctx.tx_config.pend_q_len[peer_id][WIFI_NRF_FMAC_AC_BE] < BACKLOG) {
+		frame_enqueue(peer_id, frame_len);
+	}
+}
+
+/* Run the scheduler for one TX descriptor and account the frames it picked. */
+static size_t tx_run(void)
+{
+	struct test_nbuf *nbuf;
+	size_t frames;
+	unsigned int peer_id;
+
+	frames = _tx_pending_process(&fmac_dev_ctx, TX_DESC, WIFI_NRF_FMAC_AC_BE);
+	peer_id = pkt_info.peer_id;
+
+	while ((nbuf = wifi_nrf_utils_list_del_head(fpriv.opriv, pkt_info.pkt))) {
+		bytes_sent[peer_id] += TX_BUF_HEADROOM + nbuf->len;
+		test_nbuf_free(nbuf);
+	}
+
+	return frames;
+}
+
+static void *suite_setup(void)
+{
+	fpriv.opriv = wifi_nrf_osal_init();
+	zassert_not_null(fpriv.opriv);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&fmac_dev_ctx, 0, sizeof(fmac_dev_ctx));
+	memset(&vif_ctx, 0, sizeof(vif_ctx));
+	memset(bytes_sent, 0, sizeof(bytes_sent));
+
+	fpriv.avail_ampdu_len_per_token = QUANTUM;
+	fpriv.data_config.max_tx_aggregation = MAX_TX_AGGREGATION;
+
+	vif_ctx.if_type = NRF_WIFI_IFTYPE_AP;
+	fmac_dev_ctx.fpriv = &fpriv;
+	fmac_dev_ctx.vif_ctx[0] = &vif_ctx;
+	fmac_dev_ctx.tx_config.tx_lock = &tx_lock;
+	fmac_dev_ctx.tx_config.wakeup_client_q = wifi_nrf_utils_q_alloc(fpriv.opriv);
+	fmac_dev_ctx.tx_config.pkt_info_p = &pkt_info;
+
+	pkt_info.pkt = wifi_nrf_utils_list_alloc(fpriv.opriv);
+
+	for (int i = 0; i < MAX_SW_PEERS; i++) {
+		fmac_dev_ctx.tx_config.peers[i].peer_id = (i < MAX_PEERS) ? i : -1;
+
+		for (int ac = 0; ac < WIFI_NRF_FMAC_AC_MAX; ac++) {
+			fmac_dev_ctx.tx_config.data_pending_txq[i][ac] =
+				wifi_nrf_utils_q_alloc(fpriv.opriv);
+		}
+	}
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < MAX_PEERS; i++) {
+		tx_peer_pend_q_flush(&fmac_dev_ctx, i);
+	}
+
+	for (int i = 0; i < MAX_SW_PEERS; i++) {
+		for (int ac = 0; ac < WIFI_NRF_FMAC_AC_MAX; ac++) {
+			wifi_nrf_utils_q_free(fpriv.opriv,
+					      fmac_dev_ctx.tx_config.data_pending_txq[i][ac]);
+		}
+	}
+
+	wifi_nrf_utils_list_free(fpriv.opriv, pkt_info.pkt);
+	wifi_nrf_utils_q_free(fpriv.opriv, fmac_dev_ctx.tx_config.wakeup_client_q);
+
+	zassert_equal(nbufs_allocated, 0, "Frames leaked");
+}
+
+ZTEST(nrf700x_tx, test_drr_fair_bytes)
+{
+	/* Full size frames, small frames and frames that do not divide the quantum */
+	static const unsigned int frame_len[] = { 1500, 100, 700 };
+	unsigned int total = 0;
+
+	for (int round = 0; round < ROUNDS; round++) {
+		for (int i = 0; i < ARRAY_SIZE(frame_len); i++) {
+			backlog_fill(i, frame_len[i]);
+		}
+
+		zassert_true(tx_run() > 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(frame_len); i++) {
+		total += bytes_sent[i];
+	}
+
+	/* Backlogged peers get the same number of bytes, whatever their frame size. A peer may
+	 * be ahead of the others by the quantum and one frame, as it can overdraw its credit
+	 * by a frame.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(frame_len); i++) {
+		unsigned int share = total / ARRAY_SIZE(frame_len);
+
+		zassert_within(bytes_sent[i], share, QUANTUM + frame_len[0],
+			       "Peer %d sent %u bytes out of %u", i, bytes_sent[i], total);
+	}
+}
+
+ZTEST(nrf700x_tx, test_drr_idle_peer_loses_credit)
+{
+	fmac_dev_ctx.tx_config.curr_peer_opp[WIFI_NRF_FMAC_AC_BE] = MAX_PEERS - 1;
+
+	frame_enqueue(0, 100);
+	backlog_fill(1, 1500);
+
+	/* Peer 0 empties its queue on its turn and does not keep the unused credit. */
+	zassert_equal(tx_run(), 1);
+	zassert_equal(bytes_sent[0], 100);
+	zassert_equal(fmac_dev_ctx.tx_config.drr_deficit[0][WIFI_NRF_FMAC_AC_BE], 0);
+	zassert_false(fmac_dev_ctx.tx_config.pend_peer_map[WIFI_NRF_FMAC_AC_BE] & BIT(0));
+
+	/* Peer 1 keeps the turn until its credit is used up. */
+	zassert_equal(tx_run(), 1);
+	zassert_equal(tx_run(), 1);
+	zassert_equal(bytes_sent[1], QUANTUM);
+	zassert_equal(fmac_dev_ctx.tx_config.drr_deficit[1][WIFI_NRF_FMAC_AC_BE], 0);
+	zassert_equal(fmac_dev_ctx.tx_config.curr_peer_opp[WIFI_NRF_FMAC_AC_BE], 1);
+}
+
+ZTEST(nrf700x_tx, test_drr_skips_power_save_peer)
+{
+	backlog_fill(0, 1500);
+	backlog_fill(1, 1500);
+
+	fmac_dev_ctx.tx_config.peers[0].ps_state = NRF_WIFI_CLIENT_PS_MODE;
+
+	for (int round = 0; round < ROUNDS; round++) {
+		zassert_true(tx_run() > 0);
+		backlog_fill(1, 1500);
+	}
+
+	zassert_equal(bytes_sent[0], 0);
+	zassert_equal(bytes_sent[1], ROUNDS * 1500);
+}
+
+ZTEST(nrf700x_tx, test_per_frame_cost)
+{
+	size_t frames;
+
+	/* The scheduler uses the tracked queue lengths and only looks up the length of the
+	 * descriptor's frame list once, however many frames are queued or aggregated.
+	 */
+	for (int i = 0; i < MAX_PEERS; i++) {
+		backlog_fill(i, 100);
+	}
+
+	llist_len_calls = 0;
+	frames = tx_run();
+
+	zassert_equal(frames, MAX_TX_AGGREGATION);
+	zassert_equal(llist_len_calls, 1);
+
+	/* Peer 1 had the turn and has credit left. */
+	llist_len_calls = 0;
+	zassert_equal(tx_curr_peer_opp_get(&fmac_dev_ctx, WIFI_NRF_FMAC_AC_BE), 1);
+	zassert_equal(llist_len_calls, 0);
+}
+
+ZTEST(nrf700x_tx, test_peer_remove_resets_scheduler_state)
+{
+	backlog_fill(2, 1500);
+
+	/* Leave peer 2 with pending frames and unused credit. */
+	zassert_equal(tx_run(), 1);
+	zassert_equal(fmac_dev_ctx.tx_config.curr_peer_opp[WIFI_NRF_FMAC_AC_BE], 2);
+	zassert_true(fmac_dev_ctx.tx_config.drr_deficit[2][WIFI_NRF_FMAC_AC_BE] > 0);
+
+	wifi_nrf_fmac_peer_remove(&fmac_dev_ctx, 0, 2);
+
+	zassert_equal(nbufs_allocated, 0);
+	zassert_equal(pending_frames_count(&fmac_dev_ctx, 2), 0);
+	zassert_equal(fmac_dev_ctx.tx_config.drr_deficit[2][WIFI_NRF_FMAC_AC_BE], 0);
+	zassert_false(fmac_dev_ctx.tx_config.pend_peer_map[WIFI_NRF_FMAC_AC_BE] & BIT(2));
+	zassert_equal(tx_curr_peer_opp_get(&fmac_dev_ctx, WIFI_NRF_FMAC_AC_BE), -1);
+
+	/* A new peer with the same ID starts with a fresh quantum. */
+	fmac_dev_ctx.tx_config.peers[2].peer_id = 2;
+	frame_enqueue(2, 1500);
+	frame_enqueue(2, 1500);
+	frame_enqueue(2, 1500);
+
+	zassert_equal(tx_curr_peer_opp_get(&fmac_dev_ctx, WIFI_NRF_FMAC_AC_BE), 2);
+	zassert_equal(fmac_dev_ctx.tx_config.drr_deficit[2][WIFI_NRF_FMAC_AC_BE], QUANTUM);
+}
+
+ZTEST_SUITE(nrf700x_tx, NULL, suite_setup, before, after, NULL);
@@ -8,6 +8,18 @@
 #include <errno.h>
 #include "data_fifo.h"
 
+#define STRESS_BLOCKS_NUM 8
+#define STRESS_BLOCK_SIZE_MAX 64
+#define STRESS_ITERATIONS 10000
+#define BENCHMARK_ITERATIONS 10000
+#define PRODUCER_STACK_SIZE 2048
+
+/* Used from a second thread, so it cannot be placed on the stack of the test */
+DATA_FIFO_SPSC_DEFINE(stress_fifo, STRESS_BLOCKS_NUM, STRESS_BLOCK_SIZE_MAX);
+
+static K_THREAD_STACK_DEFINE(producer_stack, PRODUCER_STACK_SIZE);
+static struct k_thread producer_thread;
+
 /* Catch asserts to fail test */
 void assert_post_action(const char *file, unsigned int line)
 {
@@ -189,4 +201,279 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "_last_filled_get did not return -ENOMSG");
+
+	/* Run several times around the ring */
+	for (uint32_t i = 0; i < 10; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		memset(data_ptr, i, i + 1);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal_ptr(data_ptr_read, data_ptr, "wrong block returned");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+		zassert_equal(((uint8_t *)data_ptr_read)[i], i, "data contents are not identical");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, &data_ptr_read);
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_too_many)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	for (uint32_t i = 0; i < 4; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	internal_test_remaining_elements(&data_fifo, 4, 4, __LINE__);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(20));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not time out");
+
+	/* A block that has been read is not vacant before it is freed */
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, 0, "_last_filled_get did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not ENOMEM");
+
+	data_fifo_block_free(&data_fifo, &data_ptr_read);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	zassert_equal_ptr(data_ptr, data_ptr_read, "freed block not reused");
+
+	internal_test_remaining_elements(&data_fifo, 4, 3, __LINE__);
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "data_fifo_empty did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr_1;
+	uint8_t *data_ptr_2;
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_1, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 1);
+	zassert_equal(ret, -ESPIPE, "block_lock did not return -ESPIPE");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_1, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 2, 2, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_too_much_data)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr;
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 129);
+	zassert_equal(ret, -ENOMEM, "block_lock did not return -ENOMEM");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 0);
+	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
+}
+
+/* Every block carries its sequence number and a size derived from it. Both sides
+ * yield after a different number of blocks and whenever they cannot continue, so
+ * that the FIFO is found both full and empty while the other side is using it.
+ */
+static void stress_producer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t *data_ptr;
+	size_t size;
+	int ret;
+
+	for (uint32_t i = 0; i < STRESS_ITERATIONS;) {
+		ret = data_fifo_pointer_first_vacant_get(&stress_fifo, (void **)&data_ptr,
+							 K_NO_WAIT);
+		if (ret == -ENOMEM) {
+			k_yield();
+			continue;
+		}
+
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		size = sizeof(uint32_t) * (1 + i % (STRESS_BLOCK_SIZE_MAX / sizeof(uint32_t)));
+		for (size_t j = 0; j < size / sizeof(uint32_t); j++) {
+			data_ptr[j] = i;
+		}
+
+		ret = data_fifo_block_lock(&stress_fifo, (void **)&data_ptr, size);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+		i++;
+
+		if ((i % 7) == 0) {
+			k_yield();
+		}
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_stress)
+{
+	uint32_t *data_ptr;
+	size_t size;
+	uint32_t num_alloced;
+	uint32_t num_locked;
+	uint32_t full_count = 0;
+	int ret;
+
+	ret = data_fifo_init(&stress_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			stress_producer, NULL, NULL, NULL, k_thread_priority_get(k_current_get()),
+			0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < STRESS_ITERATIONS;) {
+		ret = data_fifo_num_used_get(&stress_fifo, &num_alloced, &num_locked);
+		zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+		zassert_true(num_locked <= num_alloced, "more locked than alloced blocks");
+		zassert_true(num_alloced <= STRESS_BLOCKS_NUM, "too many alloced blocks");
+
+		if (num_alloced == STRESS_BLOCKS_NUM) {
+			full_count++;
+		}
+
+		ret = data_fifo_pointer_last_filled_get(&stress_fifo, (void **)&data_ptr, &size,
+							K_NO_WAIT);
+		if (ret == -ENOMSG) {
+			k_yield();
+			continue;
+		}
+
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(size,
+			      sizeof(uint32_t) * (1 + i % (STRESS_BLOCK_SIZE_MAX / sizeof(uint32_t))),
+			      "data size incorrect for block %d", i);
+		for (size_t j = 0; j < size / sizeof(uint32_t); j++) {
+			zassert_equal(data_ptr[j], i, "block %d out of order", i);
+		}
+
+		data_fifo_block_free(&stress_fifo, (void **)&data_ptr);
+		i++;
+
+		if ((i % 5) == 0) {
+			k_yield();
+		}
+	}
+
+	k_thread_join(&producer_thread, K_FOREVER);
+
+	internal_test_remaining_elements(&stress_fifo, 0, 0, __LINE__);
+	zassert_true(full_count > 0, "FIFO never filled up");
+}
+
+static uint32_t benchmark_run(struct data_fifo *data_fifo)
+{
+	uint32_t start;
+	void *data_ptr;
+	size_t size;
+	int ret;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, &data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		ret = data_fifo_block_lock(data_fifo, &data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data_ptr, &size, K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		data_fifo_block_free(data_fifo, &data_ptr);
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_benchmark)
+{
+	DATA_FIFO_DEFINE(data_fifo, 8, 16);
+	DATA_FIFO_SPSC_DEFINE(data_fifo_spsc, 8, 16);
+
+	uint32_t cycles = benchmark_run(&data_fifo);
+	uint32_t cycles_spsc = benchmark_run(&data_fifo_spsc);
+
+	TC_PRINT("%d iterations of get, lock, get and free: %u cycles, %u cycles in SPSC mode\n",
+		 BENCHMARK_ITERATIONS, cycles, cycles_spsc);
+}
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
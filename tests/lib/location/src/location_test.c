@@ -25,6 +25,13 @@
 
 #define HTTPS_PORT 443
 
+/* Durations of the location stages set up through the mocks, and the accepted
+ * deviation of the elapsed times reported in the location details.
+ */
+#define TEST_CELLULAR_SCAN_TIME_MS 100
+#define TEST_CLOUD_REQUEST_TIME_MS 200
+#define TEST_ELAPSED_TIME_TOLERANCE_MS 10
+
 static struct location_event_data test_location_event_data = {0};
 static struct nrf_modem_gnss_pvt_data_frame test_pvt_data = {0};
 static struct rest_client_req_context rest_req_ctx = { 0 };
@@ -170,6 +177,21 @@ static void location_event_handler(const struct location_event_data *event_data)
 		TEST_ASSERT_EQUAL(test_location_event_data.location.datetime.ms,
 			event_data->location.datetime.ms);
 	}
+
+	/* Elapsed times are verified only in tests that set up the stage durations. */
+	if (event_data->id == LOCATION_EVT_LOCATION &&
+	    test_location_event_data.location.details.elapsed_time_method != 0) {
+		const struct location_data_details *expected =
+			&test_location_event_data.location.details;
+		const struct location_data_details *details = &event_data->location.details;
+
+		TEST_ASSERT_UINT32_WITHIN(TEST_ELAPSED_TIME_TOLERANCE_MS,
+			expected->elapsed_time_method, details->elapsed_time_method);
+		TEST_ASSERT_UINT32_WITHIN(TEST_ELAPSED_TIME_TOLERANCE_MS,
+			expected->cellular.elapsed_time_scan, details->cellular.elapsed_time_scan);
+		TEST_ASSERT_UINT32_WITHIN(TEST_ELAPSED_TIME_TOLERANCE_MS,
+			expected->elapsed_time_cloud_request, details->elapsed_time_cloud_request);
+	}
 	k_sem_give(&event_handler_called_sem);
 }
 
@@ -351,6 +373,15 @@ void cellular_rest_req_resp_handle(void)
 		sizeof(rest_resp_ctx));
 }
 
+static int rest_client_request_delayed(struct rest_client_req_context *req_ctx,
+				       struct rest_client_resp_context *resp_ctx,
+				       int cmock_num_calls)
+{
+	k_sleep(K_MSEC(TEST_CLOUD_REQUEST_TIME_MS));
+
+	return 0;
+}
+
 /* Test successful cellular location request utilizing HERE service.
  * Also try to make a location request while previous one is still pending.
  */
@@ -369,6 +400,12 @@ void test_location_cellular(void)
 	test_location_event_data.location.longitude = 23.896979;
 	test_location_event_data.location.accuracy = 750.0;
 	test_location_event_data.location.datetime.valid = false;
+	test_location_event_data.location.details.elapsed_time_method =
+		TEST_CELLULAR_SCAN_TIME_MS + TEST_CLOUD_REQUEST_TIME_MS;
+	test_location_event_data.location.details.cellular.elapsed_time_scan =
+		TEST_CELLULAR_SCAN_TIME_MS;
+	test_location_event_data.location.details.elapsed_time_cloud_request =
+		TEST_CLOUD_REQUEST_TIME_MS;
 
 	location_callback_called_expected = true;
 
@@ -380,6 +417,7 @@ void test_location_cellular(void)
 		(char *)cgact_resp_active, sizeof(cgact_resp_active));
 
 	cellular_rest_req_resp_handle();
+	__cmock_rest_client_request_AddCallback(rest_client_request_delayed);
 
 	/* Select cellular service to be used */
 	rest_req_ctx.url = "here.api"; /* Needs a fix once rest_req_ctx is verified */
@@ -396,6 +434,7 @@ void test_location_cellular(void)
 	k_sleep(K_MSEC(1));
 
 	/* Trigger NCELLMEAS response which further triggers the rest of the location calculation */
+	k_sleep(K_MSEC(TEST_CELLULAR_SCAN_TIME_MS));
 	at_monitor_dispatch(ncellmeas_resp);
 }
 
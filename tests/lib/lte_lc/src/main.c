@@ -381,21 +381,206 @@ void test_parse_ncellmeas(void)
 	TEST_ASSERT_EQUAL(0, cells.ncells_count);
 }
 
-void test_neighborcell_count_get(void)
+void test_parse_ncellmeas_too_many_neighbors(void)
 {
-	char *resp1 = "%NCELLMEAS: 1,2,3,4,5,6,7,8,9,10,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,"
-		      "1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,"
-		      "1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1000";
-	char *resp2 = "%NCELLMEAS: 1,2,3,4,5,6,7,8,9,10,1,2,3,4,5,1,2,3,4,5,1,2,3,4,5,1,2,3,1000";
-	char *resp3 = "%NCELLMEAS: 1,2,3,4,5,6,7,8,9,10,1000";
-	char *resp4 = "%NCELLMEAS: ";
-	char *resp5 = " ";
-
-	TEST_ASSERT_EQUAL(17, neighborcell_count_get(resp1));
-	TEST_ASSERT_EQUAL(3, neighborcell_count_get(resp2));
-	TEST_ASSERT_EQUAL(0, neighborcell_count_get(resp3));
-	TEST_ASSERT_EQUAL(0, neighborcell_count_get(resp4));
-	TEST_ASSERT_EQUAL(0, neighborcell_count_get(resp5));
+	int err;
+	/* 12 neighbors, two more than CONFIG_LTE_NEIGHBOR_CELLS_MAX. */
+	char *resp = "%NCELLMEAS: 0,\"021D140C\",\"24201\",\"0821\",65535,5300,449,50,15,10891,"
+		     "5300,1,46,8,0,5300,2,46,8,0,5300,3,46,8,0,5300,4,46,8,0,"
+		     "5300,5,46,8,0,5300,6,46,8,0,5300,7,46,8,0,5300,8,46,8,0,"
+		     "5300,9,46,8,0,5300,10,46,8,0,5300,11,46,8,0,5300,12,46,8,0,123456\r\n";
+	struct lte_lc_ncell ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = ncells,
+	};
+
+	err = parse_ncellmeas(resp, &cells);
+	TEST_ASSERT_EQUAL(-E2BIG, err);
+	TEST_ASSERT_EQUAL(35460108, cells.current_cell.id);
+	TEST_ASSERT_EQUAL(CONFIG_LTE_NEIGHBOR_CELLS_MAX, cells.ncells_count);
+	TEST_ASSERT_EQUAL(1, cells.neighbor_cells[0].phys_cell_id);
+	TEST_ASSERT_EQUAL(CONFIG_LTE_NEIGHBOR_CELLS_MAX,
+			  cells.neighbor_cells[CONFIG_LTE_NEIGHBOR_CELLS_MAX - 1].phys_cell_id);
+	TEST_ASSERT_EQUAL(123456, cells.current_cell.timing_advance_meas_time);
+}
+
+void test_parse_ncellmeas_invalid(void)
+{
+	int err;
+	/* Not a NCELLMEAS notification. */
+	char *resp1 = "%XMODEMSLEEP: 1,0";
+	/* Invalid PLMN. */
+	char *resp2 = "%NCELLMEAS: 0,\"021D140C\",\"24\",\"0821\",65535,5300,449,50,15,10891";
+	/* Truncated neighbor cell. */
+	char *resp3 = "%NCELLMEAS: 0,\"021D140C\",\"24201\",\"0821\",65535,5300,449,50,15,10891,"
+		      "5300,194,46";
+	/* Physical cell ID out of range. */
+	char *resp4 = "%NCELLMEAS: 0,\"021D140C\",\"24201\",\"0821\",65535,5300,70000,50,15,10891";
+	/* Empty RSRP. */
+	char *resp5 = "%NCELLMEAS: 0,\"021D140C\",\"24201\",\"0821\",65535,5300,449,,15,10891";
+	struct lte_lc_ncell ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = ncells,
+	};
+
+	err = parse_ncellmeas(resp1, &cells);
+	TEST_ASSERT_EQUAL(0, err);
+	TEST_ASSERT_EQUAL(LTE_LC_CELL_EUTRAN_ID_INVALID, cells.current_cell.id);
+
+	err = parse_ncellmeas(resp2, &cells);
+	TEST_ASSERT_EQUAL(-EBADMSG, err);
+	TEST_ASSERT_EQUAL(LTE_LC_CELL_EUTRAN_ID_INVALID, cells.current_cell.id);
+
+	err = parse_ncellmeas(resp3, &cells);
+	TEST_ASSERT_EQUAL(-ENODATA, err);
+
+	err = parse_ncellmeas(resp4, &cells);
+	TEST_ASSERT_EQUAL(-ERANGE, err);
+
+	err = parse_ncellmeas(resp5, &cells);
+	TEST_ASSERT_EQUAL(-EBADMSG, err);
+}
+
+void test_parse_ncellmeas_gci(void)
+{
+	int err;
+	char *resp1 = "%NCELLMEAS: 0,\"00011B07\",\"26295\",\"00B7\",10512,9034,2300,7,63,31,"
+		      "150344527,1,2,2300,8,60,29,0,2400,11,55,26,184,"
+		      "\"0011AB07\",\"26295\",\"00B7\",65535,0,2300,9,50,27,150344527,0,0,"
+		      "\"00011B08\",\"26201\",\"00B8\",65535,0,2300,10,45,25,150344527,0,0\r\n";
+	char *resp2 = "%NCELLMEAS: 1";
+	struct lte_lc_ncellmeas_params params = {
+		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_EXTENDED_LIGHT,
+		.gci_count = 5,
+	};
+	struct lte_lc_ncell ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+	struct lte_lc_cell gci_cells[5];
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = ncells,
+		.gci_cells = gci_cells,
+	};
+
+	err = parse_ncellmeas_gci(&params, resp1, &cells);
+	TEST_ASSERT_EQUAL(0, err);
+	TEST_ASSERT_EQUAL(262, cells.current_cell.mcc);
+	TEST_ASSERT_EQUAL(95, cells.current_cell.mnc);
+	TEST_ASSERT_EQUAL(0x00011B07, cells.current_cell.id);
+	TEST_ASSERT_EQUAL(0x00B7, cells.current_cell.tac);
+	TEST_ASSERT_EQUAL(10512, cells.current_cell.timing_advance);
+	TEST_ASSERT_EQUAL(9034, cells.current_cell.timing_advance_meas_time);
+	TEST_ASSERT_EQUAL(2300, cells.current_cell.earfcn);
+	TEST_ASSERT_EQUAL(7, cells.current_cell.phys_cell_id);
+	TEST_ASSERT_EQUAL(63, cells.current_cell.rsrp);
+	TEST_ASSERT_EQUAL(31, cells.current_cell.rsrq);
+	TEST_ASSERT_EQUAL(150344527, cells.current_cell.measurement_time);
+	TEST_ASSERT_EQUAL(2, cells.ncells_count);
+	TEST_ASSERT_EQUAL(2300, cells.neighbor_cells[0].earfcn);
+	TEST_ASSERT_EQUAL(8, cells.neighbor_cells[0].phys_cell_id);
+	TEST_ASSERT_EQUAL(2400, cells.neighbor_cells[1].earfcn);
+	TEST_ASSERT_EQUAL(184, cells.neighbor_cells[1].time_diff);
+	TEST_ASSERT_EQUAL(2, cells.gci_cells_count);
+	TEST_ASSERT_EQUAL(0x0011AB07, cells.gci_cells[0].id);
+	TEST_ASSERT_EQUAL(LTE_LC_CELL_TIMING_ADVANCE_INVALID, cells.gci_cells[0].timing_advance);
+	TEST_ASSERT_EQUAL(9, cells.gci_cells[0].phys_cell_id);
+	TEST_ASSERT_EQUAL(0x00011B08, cells.gci_cells[1].id);
+	TEST_ASSERT_EQUAL(1, cells.gci_cells[1].mnc);
+	TEST_ASSERT_EQUAL(LTE_LC_CELL_EUTRAN_ID_INVALID, cells.gci_cells[2].id);
+
+	/* Only as many GCI cells as requested are parsed. */
+	params.gci_count = 1;
+
+	err = parse_ncellmeas_gci(&params, resp1, &cells);
+	TEST_ASSERT_EQUAL(0, err);
+	TEST_ASSERT_EQUAL(0x00011B07, cells.current_cell.id);
+	TEST_ASSERT_EQUAL(2, cells.ncells_count);
+	TEST_ASSERT_EQUAL(0, cells.gci_cells_count);
+
+	err = parse_ncellmeas_gci(&params, resp2, &cells);
+	TEST_ASSERT_EQUAL(1, err);
+	TEST_ASSERT_EQUAL(LTE_LC_CELL_EUTRAN_ID_INVALID, cells.current_cell.id);
+	TEST_ASSERT_EQUAL(0, cells.ncells_count);
+	TEST_ASSERT_EQUAL(0, cells.gci_cells_count);
+}
+
+/* Feeds truncated and randomly corrupted copies of a valid response to the parser.
+ * The parser must not write past the neighbor cell array, whatever the input.
+ */
+void test_parse_ncellmeas_fuzz(void)
+{
+	const char *resp = "%NCELLMEAS: 0,\"021D140C\",\"24201\",\"0821\",65535,5300,"
+			   "449,50,15,10891,5300,194,46,8,0,1650,292,60,27,24,8061152878017748";
+	const char mutations[] = { ',', '"', '-', ' ', '0', '9', 'F', '\r', '\0' };
+	const size_t resp_len = strlen(resp);
+	struct lte_lc_ncell ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX + 1];
+	struct lte_lc_ncell guard;
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = ncells,
+	};
+	char buf[128];
+	uint32_t seed = 1;
+
+	memset(&guard, 0xAA, sizeof(guard));
+
+	for (size_t len = 0; len <= resp_len; len++) {
+		memcpy(buf, resp, len);
+		buf[len] = '\0';
+		ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX] = guard;
+
+		(void)parse_ncellmeas(buf, &cells);
+		TEST_ASSERT_TRUE(cells.ncells_count <= CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+		TEST_ASSERT_EQUAL_MEMORY(&guard, &ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX],
+					 sizeof(guard));
+	}
+
+	for (int i = 0; i < 10000; i++) {
+		int err;
+
+		strcpy(buf, resp);
+
+		for (int j = 0; j < 3; j++) {
+			/* Linear congruential generator, to keep the test deterministic. */
+			seed = seed * 1103515245 + 12345;
+			buf[(seed >> 8) % resp_len] = mutations[(seed >> 24) % sizeof(mutations)];
+		}
+
+		ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX] = guard;
+
+		err = parse_ncellmeas(buf, &cells);
+		TEST_ASSERT_TRUE(err <= 1);
+		TEST_ASSERT_TRUE(cells.ncells_count <= CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+		TEST_ASSERT_EQUAL_MEMORY(&guard, &ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX],
+					 sizeof(guard));
+	}
+}
+
+/* Reports the time it takes to parse a response with the maximum number of neighbor cells. */
+void test_parse_ncellmeas_benchmark(void)
+{
+	int err;
+	char *resp = "%NCELLMEAS: 0,\"021D140C\",\"24201\",\"0821\",65535,5300,449,50,15,10891,"
+		     "5300,1,46,8,0,5300,2,46,8,0,5300,3,46,8,0,5300,4,46,8,0,"
+		     "5300,5,46,8,0,5300,6,46,8,0,5300,7,46,8,0,5300,8,46,8,0,"
+		     "5300,9,46,8,0,5300,10,46,8,0,8061152878017748\r\n";
+	struct lte_lc_ncell ncells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+	struct lte_lc_cells_info cells = {
+		.neighbor_cells = ncells,
+	};
+	uint32_t start, cycles;
+	const int rounds = 1000;
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < rounds; i++) {
+		err = parse_ncellmeas(resp, &cells);
+		TEST_ASSERT_EQUAL(0, err);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	TEST_ASSERT_EQUAL(CONFIG_LTE_NEIGHBOR_CELLS_MAX, cells.ncells_count);
+
+	printf("parse_ncellmeas: %u cycles per response with %d neighbor cells\n",
+	       cycles / rounds, CONFIG_LTE_NEIGHBOR_CELLS_MAX);
 }
 
 void test_parse_psm(void)
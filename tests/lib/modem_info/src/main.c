@@ -12,6 +12,7 @@
 #include <zephyr/device.h>
 
 #include "modem_info.h"
+#include "at_cmd_parser.h"
 
 #include <zephyr/fff.h>
 
@@ -22,6 +23,20 @@ DEFINE_FFF_GLOBALS;
 FAKE_VALUE_FUNC(int, nrf_modem_at_notif_handler_set, nrf_modem_at_notif_handler_t);
 FAKE_VALUE_FUNC(int, at_params_list_init, struct at_param_list *, size_t);
 FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_scanf, const char *, const char *, ...);
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_cmd, void *, size_t, const char *, ...);
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_printf, const char *, ...);
+FAKE_VALUE_FUNC(int, at_parser_max_params_from_str, const char *, char **,
+		struct at_param_list *const, size_t);
+FAKE_VALUE_FUNC(uint32_t, at_params_valid_count_get, const struct at_param_list *);
+FAKE_VALUE_FUNC(int, at_params_unsigned_short_get, const struct at_param_list *, size_t,
+		uint16_t *);
+FAKE_VALUE_FUNC(int, at_params_string_get, const struct at_param_list *, size_t, char *,
+		size_t *);
+
+/* at_monitor_dispatch() is implemented in at_monitor library and
+ * we'll call it directly to fake received AT notifications
+ */
+extern void at_monitor_dispatch(const char *at_notif);
 
 #define FW_UUID_SIZE 37
 #define SVN_SIZE 3
@@ -33,6 +48,15 @@ FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_scanf, const char *, const char *, ...)
 #define EXAMPLE_RSRP_INVALID 255
 #define EXAMPLE_RSRP_VALID 160
 #define RSRP_OFFSET 140
+#define EXAMPLE_PARAM_STRING "1234567890"
+#define EXAMPLE_SUP_BAND "(1,2,3,4,5,8,12,13)"
+
+/* Different AT commands needed by modem_info_params_get(), with all parameters enabled. */
+#define PARAMS_GET_AT_CMD_COUNT 14
+/* AT commands of modem_info_params_get() whose results are cached:
+ * supported bands, ICCID, IMSI, modem firmware version and IMEI.
+ */
+#define PARAMS_GET_AT_CMD_CACHED_COUNT 5
 
 struct at_param at_params[10] = {};
 static struct at_param_list m_param_list = {
@@ -130,11 +154,58 @@ static int nrf_modem_at_scanf_custom_cesq_invalid(const char *cmd, const char *f
 }
 
 
+static int nrf_modem_at_cmd_custom(void *buf, size_t len, const char *fmt, va_list args)
+{
+	const char *rsp = "OK\r\n";
+
+	if (strcmp(fmt, "AT%%XCBAND=?") == 0) {
+		rsp = "%XCBAND: " EXAMPLE_SUP_BAND "\r\nOK\r\n";
+	} else if (strcmp(fmt, "AT+CGDCONT?") == 0) {
+		rsp = "+CGDCONT: 0,\"IP\",\"apn\",\"10.0.0.1\",0,0\r\nOK\r\n";
+	}
+
+	TEST_ASSERT_TRUE(strlen(rsp) < len);
+	strcpy(buf, rsp);
+
+	return 0;
+}
+
+static int at_params_string_get_custom(const struct at_param_list *list, size_t index,
+				       char *value, size_t *len)
+{
+	size_t str_len = strlen(EXAMPLE_PARAM_STRING);
+
+	TEST_ASSERT_TRUE(str_len <= *len);
+	memcpy(value, EXAMPLE_PARAM_STRING, str_len);
+	*len = str_len;
+
+	return 0;
+}
+
+static int at_cmd_count_get(const char *cmd)
+{
+	int count = 0;
+
+	for (int i = 0; i < MIN(nrf_modem_at_cmd_fake.call_count, FFF_ARG_HISTORY_LEN); i++) {
+		if (strcmp(nrf_modem_at_cmd_fake.arg2_history[i], cmd) == 0) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
 void setUp(void)
 {
 	RESET_FAKE(nrf_modem_at_notif_handler_set);
 	RESET_FAKE(at_params_list_init);
 	RESET_FAKE(nrf_modem_at_scanf);
+	RESET_FAKE(nrf_modem_at_cmd);
+	RESET_FAKE(nrf_modem_at_printf);
+	RESET_FAKE(at_parser_max_params_from_str);
+	RESET_FAKE(at_params_valid_count_get);
+	RESET_FAKE(at_params_unsigned_short_get);
+	RESET_FAKE(at_params_string_get);
 }
 
 void tearDown(void)
@@ -147,6 +218,16 @@ int at_params_list_init_custom(struct at_param_list *list, size_t max_params_cou
 	return EXIT_SUCCESS;
 }
 
+static void at_cmd_fakes_setup(void)
+{
+	at_params_list_init_fake.custom_fake = at_params_list_init_custom;
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom;
+	at_params_string_get_fake.custom_fake = at_params_string_get_custom;
+
+	/* Also clears the cached modem information. */
+	TEST_ASSERT_EQUAL(0, modem_info_init());
+}
+
 void test_modem_info_init_success(void)
 {
 	int ret;
@@ -406,6 +487,145 @@ void test_modem_info_get_rsrp_success(void)
 	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
 }
 
+void test_modem_info_params_get_batched(void)
+{
+	int ret;
+	struct modem_param_info modem_param;
+
+	at_cmd_fakes_setup();
+	modem_info_params_init(&modem_param);
+
+	ret = modem_info_params_get(&modem_param);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	/* Each AT command is sent once, and its response is parsed once. */
+	TEST_ASSERT_EQUAL(PARAMS_GET_AT_CMD_COUNT, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+COPS?"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CEREG?"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT%%XSYSTEMMODE?"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CGDCONT?"));
+
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_SUP_BAND, modem_param.network.sup_band.value_string);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING, modem_param.network.apn.value_string);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING,
+				 modem_param.network.ip_address.value_string);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING,
+				 modem_param.network.cellid_hex.value_string);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING, modem_param.device.imei.value_string);
+}
+
+void test_modem_info_params_get_cached(void)
+{
+	int ret;
+	struct modem_param_info modem_param;
+
+	at_cmd_fakes_setup();
+	modem_info_params_init(&modem_param);
+
+	ret = modem_info_params_get(&modem_param);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(PARAMS_GET_AT_CMD_COUNT, nrf_modem_at_cmd_fake.call_count);
+
+	memset(&modem_param, 0, sizeof(modem_param));
+	modem_info_params_init(&modem_param);
+
+	ret = modem_info_params_get(&modem_param);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(2 * PARAMS_GET_AT_CMD_COUNT - PARAMS_GET_AT_CMD_CACHED_COUNT,
+			  nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CGSN"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CGMR"));
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CEREG?"));
+
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_SUP_BAND, modem_param.network.sup_band.value_string);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING, modem_param.device.imei.value_string);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING, modem_param.device.modem_fw.value_string);
+}
+
+void test_modem_info_string_get_cached(void)
+{
+	int ret;
+	char buf[MODEM_INFO_MAX_RESPONSE_SIZE];
+
+	at_cmd_fakes_setup();
+
+	ret = modem_info_string_get(MODEM_INFO_IMEI, buf, sizeof(buf));
+	TEST_ASSERT_EQUAL(strlen(EXAMPLE_PARAM_STRING), ret);
+
+	ret = modem_info_string_get(MODEM_INFO_IMEI, buf, sizeof(buf));
+	TEST_ASSERT_EQUAL(strlen(EXAMPLE_PARAM_STRING), ret);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_PARAM_STRING, buf);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+
+	/* The cached value does not fit. */
+	ret = modem_info_string_get(MODEM_INFO_IMEI, buf, strlen(EXAMPLE_PARAM_STRING));
+	TEST_ASSERT_EQUAL(-EMSGSIZE, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+
+	/* Information that can change is not cached. */
+	ret = modem_info_string_get(MODEM_INFO_CELLID, buf, sizeof(buf));
+	TEST_ASSERT_EQUAL(strlen(EXAMPLE_PARAM_STRING), ret);
+	ret = modem_info_string_get(MODEM_INFO_CELLID, buf, sizeof(buf));
+	TEST_ASSERT_EQUAL(strlen(EXAMPLE_PARAM_STRING), ret);
+	TEST_ASSERT_EQUAL(3, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_cache_xsim_invalidate(void)
+{
+	char buf[MODEM_INFO_MAX_RESPONSE_SIZE];
+
+	at_cmd_fakes_setup();
+
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_ICCID, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_IMEI, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_cmd_fake.call_count);
+
+	at_monitor_dispatch("%XSIM: 1\r\n");
+	k_sleep(K_MSEC(1));
+
+	/* SIM information is read again, device information is still cached. */
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_ICCID, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_IMEI, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_EQUAL(3, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CRSM=176,12258,0,0,10"));
+}
+
+void test_modem_info_cache_cereg_invalidate(void)
+{
+	char buf[MODEM_INFO_MAX_RESPONSE_SIZE];
+
+	at_cmd_fakes_setup();
+
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_IMSI, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+
+	/* Registration status changes do not affect the SIM information. */
+	at_monitor_dispatch("+CEREG: 1,\"0A0B\",\"01020304\",7\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_IMSI, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+
+	/* UICC failure. */
+	at_monitor_dispatch("+CEREG: 90\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_TRUE(modem_info_string_get(MODEM_INFO_IMSI, buf, sizeof(buf)) > 0);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_params_batch_get_invalid(void)
+{
+	struct lte_param param = {
+		.type = MODEM_INFO_COUNT,
+	};
+	struct lte_param *params[] = { &param };
+
+	TEST_ASSERT_EQUAL(-EINVAL, modem_info_params_batch_get(NULL, 1));
+	TEST_ASSERT_EQUAL(-EINVAL, modem_info_params_batch_get(params, ARRAY_SIZE(params)));
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_cmd_fake.call_count);
+}
+
 /* It is required to be added to each test. That is because unity's
  * main may return nonzero, while zephyr's main currently must
  * return 0 in all cases (other values are reserved).
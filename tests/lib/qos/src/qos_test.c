@@ -19,6 +19,18 @@
 static uint8_t *var = "some text";
 #define DUMMY_SIZE sizeof(var)
 
+/* Upper bound of the timeout before the given notification of a message. */
+#define TIMEOUT_MAX_GET(notified_count)								\
+	(MIN(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS << ((notified_count) - 1),		\
+	     CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_MAX_SECONDS) *					\
+	 (100 + CONFIG_QOS_MESSAGE_NOTIFY_JITTER_PERCENT) / 100)
+
+/* Lower bound of the timeout before the given notification of a message. */
+#define TIMEOUT_MIN_GET(notified_count)								\
+	(MIN(CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_SECONDS << ((notified_count) - 1),		\
+	     CONFIG_QOS_MESSAGE_NOTIFY_TIMEOUT_MAX_SECONDS) *					\
+	 (100 - CONFIG_QOS_MESSAGE_NOTIFY_JITTER_PERCENT) / 100)
+
 static uint8_t callback_count;
 
 /* Function used to verify internal context variables. */
@@ -30,6 +42,7 @@ static void ctx_verify(struct ctx *expected)
 			  expected->timeout_handler_work.work.handler);
 	TEST_ASSERT_EQUAL(ctx.pending_list.head, expected->pending_list.head);
 	TEST_ASSERT_EQUAL(ctx.pending_list.tail, expected->pending_list.tail);
+	TEST_ASSERT_EQUAL(ctx.free_list.head == NULL, expected->free_list.head == NULL);
 	TEST_ASSERT_EQUAL(ctx.initialized, expected->initialized);
 	TEST_ASSERT_EQUAL(ctx.message_id_next, expected->message_id_next);
 }
@@ -43,6 +56,9 @@ static void dut_event_handler(const struct qos_evt *evt)
 	case QOS_EVT_MESSAGE_REMOVED_FROM_LIST:
 		callback_count++;
 		break;
+	case QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH:
+		callback_count += evt->batch.count;
+		break;
 	default:
 		TEST_FAIL();
 		break;
@@ -56,6 +72,11 @@ static void dut_event_handler_expired(const struct qos_evt *evt)
 		return;
 	}
 
+	if (evt->type == QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH) {
+		callback_count += evt->batch.count;
+		return;
+	}
+
 	TEST_FAIL();
 }
 
@@ -91,6 +112,9 @@ static void init(void)
 
 	/* Verify that internal variables has been initialized. */
 	expected.app_evt_handler = &dut_event_handler;
+	expected.pending_list.head = &ctx.pending_list;
+	expected.pending_list.tail = &ctx.pending_list;
+	expected.free_list.head = &ctx.free_list;
 	expected.initialized = true;
 	expected.timeout_handler_work.work.handler = &timeout_handler_work_fn;
 
@@ -138,7 +162,7 @@ void test_message_add(void)
 	TEST_ASSERT_EQUAL(2, callback_count);
 
 	/* Verify that internal list contains no entries. */
-	TEST_ASSERT_TRUE(sys_slist_is_empty(&ctx.pending_list));
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
 
 	/* Fill pending list */
 	callback_count = 0;
@@ -156,7 +180,7 @@ void test_message_add(void)
 	TEST_ASSERT_EQUAL(-ENOMEM, qos_message_add(&message));
 
 	/* Check number of list entries populated. */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		count++;
 	};
 
@@ -197,7 +221,7 @@ void test_message_remove(void)
 	TEST_ASSERT_EQUAL(-ENODATA, qos_message_remove(QOS_MESSAGE_ID_BASE));
 
 	/* Check number of list entries populated. */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		count++;
 	};
 
@@ -226,7 +250,7 @@ void test_message_remove_all(void)
 	/* Verify that the internal list has been emptied and the internal delayed
 	 * work is not running.
 	 */
-	TEST_ASSERT_TRUE(sys_slist_is_empty(&ctx.pending_list));
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
 	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, callback_count);
 	TEST_ASSERT_FALSE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
 }
@@ -310,9 +334,10 @@ void test_message_timeout_work(void)
 	callback_count = 0;
 	ctx.app_evt_handler = &dut_event_handler_expired;
 
-	/* Manually run the internal work. */
-	timeout_handler_work_fn(NULL);
-	k_work_cancel_delayable(&ctx.timeout_handler_work);
+	/* Manually advance the internal timer past the first timeout of every message. The extra
+	 * second covers messages that were added after the uptime crossed a second boundary.
+	 */
+	timer_process(ctx.wheel.tick + TIMEOUT_MAX_GET(1) + 1);
 
 	/* Expect QOS_EVT_MESSAGE_TIMER_EXPIRED to be returned for every message in list. */
 	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, callback_count);
@@ -321,14 +346,14 @@ void test_message_timeout_work(void)
 	ctx.app_evt_handler = &dut_event_handler_removed;
 
 	/* Set every list item to the maximum allowed notified count. */
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
 		node->message.notified_count = CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX;
 	};
 
-	timeout_handler_work_fn(NULL);
-	k_work_cancel_delayable(&ctx.timeout_handler_work);
+	timer_process(ctx.wheel.tick + TIMEOUT_MAX_GET(2) + 1);
 
 	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, callback_count);
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
 
 	/* Subsequent calls should not trigger callbacks because the list is empty. */
 	callback_count = 0;
@@ -336,6 +361,103 @@ void test_message_timeout_work(void)
 	timeout_handler_work_fn(NULL);
 
 	TEST_ASSERT_EQUAL(0, callback_count);
+	TEST_ASSERT_FALSE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
+}
+
+void test_message_timeout_backoff(void)
+{
+	struct qos_data message = {
+		.heap_allocated = true,
+		.data.buf = var,
+		.data.len = DUMMY_SIZE,
+		.id = qos_message_id_get_next(),
+		.type = TEST_MESSAGE_TYPE,
+		.flags = QOS_FLAG_RELIABILITY_ACK_REQUIRED
+	};
+
+	for (int i = 0; i < CONFIG_QOS_PENDING_MESSAGES_MAX; i++) {
+		TEST_ASSERT_FALSE(qos_message_add(&message));
+		message.id = qos_message_id_get_next();
+	}
+
+	k_work_cancel_delayable(&ctx.timeout_handler_work);
+	callback_count = 0;
+
+	/* Each message is notified once its own timeout has passed, and the time until the
+	 * next notification grows with every notification.
+	 */
+	for (int i = 1; i < CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX; i++) {
+		timer_process(ctx.wheel.tick + TIMEOUT_MIN_GET(i) - 1);
+		TEST_ASSERT_EQUAL(0, callback_count);
+
+		timer_process(ctx.wheel.tick + (TIMEOUT_MAX_GET(i) - TIMEOUT_MIN_GET(i)) + 2);
+		TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, callback_count);
+
+		callback_count = 0;
+	}
+
+	/* Messages that have been notified the maximum number of times are removed. */
+	timer_process(ctx.wheel.tick + TIMEOUT_MAX_GET(CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) + 1);
+
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, callback_count);
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
+}
+
+void test_message_backoff_get(void)
+{
+	for (int i = 1; i < 16; i++) {
+		uint32_t timeout = backoff_get(i);
+
+		TEST_ASSERT_GREATER_OR_EQUAL(TIMEOUT_MIN_GET(i), timeout);
+		TEST_ASSERT_LESS_OR_EQUAL(TIMEOUT_MAX_GET(i), timeout);
+	}
+}
+
+void test_message_remove_out_of_order(void)
+{
+	struct qos_data message = {
+		.heap_allocated = true,
+		.data.buf = var,
+		.data.len = DUMMY_SIZE,
+		.type = TEST_MESSAGE_TYPE,
+		.flags = QOS_FLAG_RELIABILITY_ACK_REQUIRED
+	};
+
+	for (int i = 0; i < CONFIG_QOS_PENDING_MESSAGES_MAX; i++) {
+		message.id = QOS_MESSAGE_ID_BASE + i;
+		TEST_ASSERT_FALSE(qos_message_add(&message));
+	}
+
+	/* Remove every other message, then the rest. */
+	for (int i = 0; i < CONFIG_QOS_PENDING_MESSAGES_MAX; i += 2) {
+		TEST_ASSERT_EQUAL(0, qos_message_remove(QOS_MESSAGE_ID_BASE + i));
+		TEST_ASSERT_EQUAL(-ENODATA, qos_message_remove(QOS_MESSAGE_ID_BASE + i));
+	}
+
+	for (int i = 1; i < CONFIG_QOS_PENDING_MESSAGES_MAX; i += 2) {
+		TEST_ASSERT_EQUAL(0, qos_message_remove(QOS_MESSAGE_ID_BASE + i));
+	}
+
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
+
+	/* Entries of removed messages are reused. IDs that map to the same position in the
+	 * internal lookup table can be removed in any order.
+	 */
+	for (int i = 0; i < CONFIG_QOS_PENDING_MESSAGES_MAX; i++) {
+		message.id = QOS_MESSAGE_ID_BASE + i * QOS_ID_TABLE_SIZE;
+		TEST_ASSERT_FALSE(qos_message_add(&message));
+	}
+
+	for (int i = CONFIG_QOS_PENDING_MESSAGES_MAX - 1; i >= 0; i -= 2) {
+		TEST_ASSERT_EQUAL(0, qos_message_remove(QOS_MESSAGE_ID_BASE + i * QOS_ID_TABLE_SIZE));
+	}
+
+	for (int i = CONFIG_QOS_PENDING_MESSAGES_MAX - 2; i >= 0; i -= 2) {
+		TEST_ASSERT_EQUAL(0, qos_message_remove(QOS_MESSAGE_ID_BASE + i * QOS_ID_TABLE_SIZE));
+	}
+
+	TEST_ASSERT_TRUE(sys_dlist_is_empty(&ctx.pending_list));
+	TEST_ASSERT_FALSE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
 }
 
 /* It is required to be added to each test. That is because unity's
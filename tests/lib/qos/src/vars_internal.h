@@ -4,26 +4,65 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
-#include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 #include <qos.h>
 
+#define QOS_WHEEL_LEVELS 2
+#define QOS_WHEEL_SLOTS 32
+#define QOS_ID_TABLE_SIZE (2 * CONFIG_QOS_PENDING_MESSAGES_MAX)
+
 struct qos_metadata {
-	/* Mandatory variable used to construct a linked list. */
-	sys_snode_t header;
+	/* Node in the list of pending messages, or in the list of free entries. */
+	sys_dnode_t header;
+
+	/* Node in a timing wheel slot. */
+	sys_dnode_t timer_node;
+
+	/* Timing wheel tick when the message is notified next. */
+	uint32_t deadline;
 
-	/* Message associated with each node in the linked list. */
+	/* Timing wheel level and slot that the message is in. */
+	uint8_t level;
+	uint8_t slot;
+
+	/* Message associated with the entry. */
 	struct qos_data message;
 };
 
+struct qos_wheel {
+	/* Lists of messages that are due in each slot. */
+	sys_dlist_t slots[QOS_WHEEL_LEVELS][QOS_WHEEL_SLOTS];
+
+	/* Bitmask of non-empty slots for each level. */
+	uint32_t occupied[QOS_WHEEL_LEVELS];
+
+	/* Last tick that has been processed. */
+	uint32_t tick;
+};
+
 extern struct ctx {
 	/* Library event handler. Used in callbacks to the caller. */
 	qos_evt_handler_t app_evt_handler;
 
-	/* Internal array of pending messages. Used in combination with linked list. */
+	/* Internal array of pending messages. */
 	struct qos_metadata list_internal[CONFIG_QOS_PENDING_MESSAGES_MAX];
 
-	/* Linked list used to keep track of pending messages. */
-	sys_slist_t pending_list;
+	/* List of pending messages, in the order that they were added. */
+	sys_dlist_t pending_list;
+
+	/* List of unused entries in list_internal. */
+	sys_dlist_t free_list;
+
+	/* Index + 1 of the entries in list_internal, hashed by message ID. */
+	uint16_t id_table[QOS_ID_TABLE_SIZE];
+
+	/* Timing wheel with the deadlines of the pending messages. */
+	struct qos_wheel wheel;
+
+#if defined(CONFIG_QOS_MESSAGE_TIMER_EXPIRED_BATCH)
+	/* Messages notified in a single QOS_EVT_MESSAGE_TIMER_EXPIRED_BATCH event. */
+	struct qos_data batch[CONFIG_QOS_PENDING_MESSAGES_MAX];
+#endif
 
 	/* Variable used to prevent multiple library initializations. */
 	bool initialized;
@@ -36,3 +75,5 @@ extern struct ctx {
 } ctx;
 
 extern void timeout_handler_work_fn(struct k_work *work);
+extern void timer_process(uint32_t now);
+extern uint32_t backoff_get(uint16_t notified_count);
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <stdbool.h>
+#include <string.h>
+#include <qos.h>
+
+/* Include header that exposes internal variables in QoS library. */
+#include "vars_internal.h"
+#include "qos_spill.h"
+#include "settings_mock.h"
+
+/* Test message type. */
+#define TEST_MESSAGE_TYPE 1
+
+/* Number of messages added on top of a full pending list. */
+#define SPILL_COUNT 3
+
+/* Dummy payload. */
+static uint8_t payload[] = "some text";
+
+static uint8_t new_count;
+static uint8_t removed_count;
+
+/* Payloads of restored messages that have not been freed yet. */
+static int heap_payloads;
+
+/* ID of the last message notified with QOS_EVT_MESSAGE_NEW. */
+static uint16_t new_id;
+
+static void dut_event_handler(const struct qos_evt *evt)
+{
+	switch (evt->type) {
+	case QOS_EVT_MESSAGE_NEW:
+		new_count++;
+		new_id = evt->message.id;
+
+		TEST_ASSERT_EQUAL(TEST_MESSAGE_TYPE, evt->message.type);
+		TEST_ASSERT_EQUAL(sizeof(payload), evt->message.data.len);
+		TEST_ASSERT_EQUAL_MEMORY(payload, evt->message.data.buf, sizeof(payload));
+
+		/* Restored messages carry a copy of the payload allocated by the library. */
+		if (evt->message.heap_allocated) {
+			TEST_ASSERT_NOT_EQUAL(payload, evt->message.data.buf);
+			heap_payloads++;
+		}
+		break;
+	case QOS_EVT_MESSAGE_REMOVED_FROM_LIST:
+		removed_count++;
+
+		if (evt->message.heap_allocated) {
+			k_free(evt->message.data.buf);
+			heap_payloads--;
+		}
+		break;
+	case QOS_EVT_MESSAGE_TIMER_EXPIRED:
+		break;
+	default:
+		TEST_FAIL();
+		break;
+	}
+}
+
+static void counters_reset(void)
+{
+	new_count = 0;
+	removed_count = 0;
+}
+
+/* Add messages with consecutive IDs, starting at QOS_MESSAGE_ID_BASE. */
+static void messages_add(size_t count)
+{
+	struct qos_data message = {
+		.data.buf = payload,
+		.data.len = sizeof(payload),
+		.type = TEST_MESSAGE_TYPE,
+		.flags = QOS_FLAG_RELIABILITY_ACK_REQUIRED
+	};
+
+	for (size_t i = 0; i < count; i++) {
+		message.id = qos_message_id_get_next();
+		TEST_ASSERT_EQUAL(0, qos_message_add(&message));
+	}
+}
+
+static size_t pending_count(void)
+{
+	struct qos_metadata *node = NULL;
+	size_t count = 0;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ctx.pending_list, node, header) {
+		count++;
+	}
+
+	return count;
+}
+
+/* Reinitialize the library with the stored messages kept, as after a reboot. */
+static void reinit(void)
+{
+	k_work_cancel_delayable(&ctx.timeout_handler_work);
+	memset(&ctx, 0, sizeof(struct ctx));
+	ctx.message_id_next = QOS_MESSAGE_ID_BASE;
+
+	TEST_ASSERT_EQUAL(0, qos_init(dut_event_handler));
+}
+
+void setUp(void)
+{
+	reinit();
+}
+
+void tearDown(void)
+{
+	qos_message_remove_all();
+	settings_mock_clear();
+	counters_reset();
+	heap_payloads = 0;
+}
+
+void test_spill_on_overflow(void)
+{
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX);
+
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, new_count);
+	TEST_ASSERT_EQUAL(0, qos_spill_count());
+
+	/* Messages that do not fit in the pending list are stored, and the caller can free
+	 * their payload right away.
+	 */
+	counters_reset();
+	messages_add(SPILL_COUNT);
+
+	TEST_ASSERT_EQUAL(0, new_count);
+	TEST_ASSERT_EQUAL(SPILL_COUNT, removed_count);
+	TEST_ASSERT_EQUAL(SPILL_COUNT, qos_spill_count());
+	TEST_ASSERT_EQUAL(SPILL_COUNT, settings_mock_count());
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, pending_count());
+}
+
+void test_spill_message_too_large(void)
+{
+	static uint8_t large[CONFIG_QOS_SPILL_MESSAGE_SIZE_MAX + 1];
+	struct qos_data message = {
+		.data.buf = large,
+		.data.len = sizeof(large),
+		.type = TEST_MESSAGE_TYPE,
+		.flags = QOS_FLAG_RELIABILITY_ACK_REQUIRED
+	};
+
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX);
+	counters_reset();
+
+	message.id = qos_message_id_get_next();
+	TEST_ASSERT_EQUAL(-ENOMEM, qos_message_add(&message));
+	TEST_ASSERT_EQUAL(1, removed_count);
+	TEST_ASSERT_EQUAL(0, qos_spill_count());
+	TEST_ASSERT_EQUAL(0, settings_mock_count());
+}
+
+void test_spill_restore_on_ack(void)
+{
+	uint16_t restored_id;
+
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT);
+	counters_reset();
+
+	/* Acknowledging a message makes room for the oldest stored message. */
+	TEST_ASSERT_EQUAL(0, qos_message_remove(QOS_MESSAGE_ID_BASE));
+
+	TEST_ASSERT_EQUAL(1, removed_count);
+	TEST_ASSERT_EQUAL(1, new_count);
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX, new_id);
+	TEST_ASSERT_EQUAL(1, heap_payloads);
+	TEST_ASSERT_EQUAL(SPILL_COUNT - 1, qos_spill_count());
+	TEST_ASSERT_EQUAL(SPILL_COUNT - 1, settings_mock_count());
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, pending_count());
+
+	/* The payload of the restored message is freed when it is acknowledged, and the next
+	 * stored message takes its place.
+	 */
+	restored_id = new_id;
+	TEST_ASSERT_EQUAL(0, qos_message_remove(restored_id));
+	TEST_ASSERT_EQUAL(restored_id + 1, new_id);
+	TEST_ASSERT_EQUAL(1, heap_payloads);
+	TEST_ASSERT_EQUAL(SPILL_COUNT - 2, qos_spill_count());
+
+	qos_message_remove_all();
+	TEST_ASSERT_EQUAL(0, heap_payloads);
+}
+
+void test_spill_restore_on_notify_all(void)
+{
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX);
+
+	/* Move all pending messages to the spill queue. */
+	counters_reset();
+	TEST_ASSERT_EQUAL(0, qos_message_spill_all());
+
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, removed_count);
+	TEST_ASSERT_EQUAL(0, pending_count());
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, qos_spill_count());
+	TEST_ASSERT_FALSE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
+
+	/* Notifying all messages restores the stored messages in order. */
+	counters_reset();
+	qos_message_notify_all();
+
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, new_count);
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX - 1, new_id);
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, heap_payloads);
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, pending_count());
+	TEST_ASSERT_EQUAL(0, qos_spill_count());
+	TEST_ASSERT_EQUAL(0, settings_mock_count());
+	TEST_ASSERT_TRUE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
+
+	/* All restored payloads are freed when the messages are removed. */
+	qos_message_remove_all();
+	TEST_ASSERT_EQUAL(0, heap_payloads);
+}
+
+void test_spill_restore_on_init(void)
+{
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT);
+	TEST_ASSERT_EQUAL(0, qos_message_spill_all());
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT, qos_spill_count());
+
+	/* The stored messages are found after a reboot, and as many as fit are restored. */
+	counters_reset();
+	reinit();
+
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, new_count);
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX - 1, new_id);
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, pending_count());
+	TEST_ASSERT_EQUAL(SPILL_COUNT, qos_spill_count());
+	TEST_ASSERT_EQUAL(SPILL_COUNT, settings_mock_count());
+	TEST_ASSERT_TRUE(k_work_delayable_is_pending(&ctx.timeout_handler_work));
+
+	/* The remaining messages are restored as the restored ones are acknowledged. */
+	for (int i = 0; i < SPILL_COUNT; i++) {
+		TEST_ASSERT_EQUAL(0, qos_message_remove(QOS_MESSAGE_ID_BASE + i));
+	}
+
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT - 1,
+			  new_id);
+	TEST_ASSERT_EQUAL(0, qos_spill_count());
+	TEST_ASSERT_EQUAL(0, settings_mock_count());
+
+	qos_message_remove_all();
+	TEST_ASSERT_EQUAL(0, heap_payloads);
+}
+
+void test_spill_id_after_restore(void)
+{
+	uint16_t id;
+
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT);
+	TEST_ASSERT_EQUAL(0, qos_message_spill_all());
+
+	/* After a reboot, new IDs follow the IDs of the restored and stored messages. */
+	reinit();
+
+	id = qos_message_id_get_next();
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT, id);
+
+	/* IDs held by pending or stored messages are skipped. */
+	ctx.message_id_next = QOS_MESSAGE_ID_BASE;
+
+	id = qos_message_id_get_next();
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT, id);
+
+	/* Acknowledging a new message does not remove a restored one. */
+	counters_reset();
+	TEST_ASSERT_EQUAL(-ENODATA, qos_message_remove(id));
+	TEST_ASSERT_EQUAL(0, removed_count);
+	TEST_ASSERT_EQUAL(CONFIG_QOS_PENDING_MESSAGES_MAX, pending_count());
+
+	qos_message_remove_all();
+	TEST_ASSERT_EQUAL(0, heap_payloads);
+}
+
+void test_spill_id_after_restore_wrap(void)
+{
+	uint16_t id;
+
+	/* The stored messages get the last IDs before the count is reset and the first ones
+	 * after it.
+	 */
+	ctx.message_id_next = UINT16_MAX - 2;
+
+	messages_add(CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT);
+	TEST_ASSERT_EQUAL(0, qos_message_spill_all());
+
+	reinit();
+
+	id = qos_message_id_get_next();
+	TEST_ASSERT_EQUAL(QOS_MESSAGE_ID_BASE + CONFIG_QOS_PENDING_MESSAGES_MAX + SPILL_COUNT - 2,
+			  id);
+
+	qos_message_remove_all();
+	TEST_ASSERT_EQUAL(0, heap_payloads);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
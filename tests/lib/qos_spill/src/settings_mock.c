@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+
+#include "settings_mock.h"
+
+#define SETTINGS_MOCK_NAME_LEN_MAX 32
+
+/* Settings backend that keeps the entries in RAM, so that they outlive a reinitialization of
+ * the QoS library in the same way as entries stored in flash.
+ */
+struct settings_mock_entry {
+	sys_snode_t node;
+	char name[SETTINGS_MOCK_NAME_LEN_MAX];
+	uint8_t *val;
+	size_t val_len;
+};
+
+static sys_slist_t entries;
+
+static ssize_t settings_mock_read_fn(void *back_end, void *data, size_t len)
+{
+	struct settings_mock_entry *entry = back_end;
+
+	len = MIN(len, entry->val_len);
+	memcpy(data, entry->val, len);
+
+	return len;
+}
+
+static int settings_mock_load(struct settings_store *cs, const struct settings_load_arg *arg)
+{
+	struct settings_mock_entry *entry, *next;
+	int err;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&entries, entry, next, node) {
+		/* Entries outside of the requested subtree are skipped by the settings
+		 * subsystem.
+		 */
+		err = settings_call_set_handler(entry->name, entry->val_len,
+						settings_mock_read_fn, entry, arg);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static struct settings_mock_entry *entry_find(const char *name)
+{
+	struct settings_mock_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&entries, entry, node) {
+		if (strcmp(entry->name, name) == 0) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void entry_free(struct settings_mock_entry *entry)
+{
+	sys_slist_find_and_remove(&entries, &entry->node);
+	k_free(entry->val);
+	k_free(entry);
+}
+
+static int settings_mock_save(struct settings_store *cs, const char *name, const char *value,
+			      size_t val_len)
+{
+	struct settings_mock_entry *entry = entry_find(name);
+
+	TEST_ASSERT_LESS_THAN(SETTINGS_MOCK_NAME_LEN_MAX, strlen(name));
+
+	if (entry != NULL) {
+		entry_free(entry);
+	}
+
+	/* Saving an empty value deletes the entry. */
+	if (val_len == 0) {
+		return 0;
+	}
+
+	entry = k_malloc(sizeof(*entry));
+	TEST_ASSERT_NOT_NULL(entry);
+
+	entry->val = k_malloc(val_len);
+	TEST_ASSERT_NOT_NULL(entry->val);
+
+	strcpy(entry->name, name);
+	memcpy(entry->val, value, val_len);
+	entry->val_len = val_len;
+
+	sys_slist_append(&entries, &entry->node);
+
+	return 0;
+}
+
+static struct settings_store_itf settings_mock_itf = {
+	.csi_load = settings_mock_load,
+	.csi_save = settings_mock_save,
+};
+
+static struct settings_store settings_mock_store = {
+	.cs_itf = &settings_mock_itf
+};
+
+int settings_backend_init(void)
+{
+	sys_slist_init(&entries);
+
+	settings_dst_register(&settings_mock_store);
+	settings_src_register(&settings_mock_store);
+
+	return 0;
+}
+
+size_t settings_mock_count(void)
+{
+	size_t count = 0;
+	struct settings_mock_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&entries, entry, node) {
+		count++;
+	}
+
+	return count;
+}
+
+void settings_mock_clear(void)
+{
+	struct settings_mock_entry *entry, *next;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&entries, entry, next, node) {
+		entry_free(entry);
+	}
+}
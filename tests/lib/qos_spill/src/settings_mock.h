@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SETTINGS_MOCK_H__
+#define SETTINGS_MOCK_H__
+
+#include <stddef.h>
+
+/* Number of entries held by the settings mock. */
+size_t settings_mock_count(void);
+
+/* Remove all entries held by the settings mock. */
+void settings_mock_clear(void);
+
+#endif /* SETTINGS_MOCK_H__ */
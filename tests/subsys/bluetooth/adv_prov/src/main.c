@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/bluetooth/hci_vs.h>
+
+#include <bluetooth/adv_prov.h>
+#include <bluetooth/adv_prov/tx_power.h>
+
+#define TEST_TX_POWER		-8
+#define TEST_TX_POWER_CHANGED	4
+
+#define TEST_DATA_TYPE		BT_DATA_MANUFACTURER_DATA
+
+NET_BUF_POOL_DEFINE(hci_pool, 2, sizeof(struct bt_hci_rp_vs_read_tx_power_level), 0, NULL);
+
+static int8_t controller_tx_power;
+static int hci_send_err;
+static size_t hci_send_cnt;
+
+static uint8_t provider_value;
+static int provider_err;
+static size_t provider_cnt;
+
+struct net_buf *bt_hci_cmd_create(uint16_t opcode, uint8_t param_len)
+{
+	zassert_equal(opcode, BT_HCI_OP_VS_READ_TX_POWER_LEVEL);
+
+	return net_buf_alloc(&hci_pool, K_NO_WAIT);
+}
+
+int bt_hci_cmd_send_sync(uint16_t opcode, struct net_buf *buf, struct net_buf **rsp)
+{
+	struct bt_hci_rp_vs_read_tx_power_level *rp;
+
+	zassert_equal(opcode, BT_HCI_OP_VS_READ_TX_POWER_LEVEL);
+	net_buf_unref(buf);
+	hci_send_cnt++;
+
+	if (hci_send_err) {
+		return hci_send_err;
+	}
+
+	*rsp = net_buf_alloc(&hci_pool, K_NO_WAIT);
+	zassert_not_null(*rsp);
+
+	rp = net_buf_add(*rsp, sizeof(*rp));
+	memset(rp, 0, sizeof(*rp));
+	rp->tx_power_level = controller_tx_power;
+
+	return 0;
+}
+
+static int get_data(struct bt_data *sd, const struct bt_le_adv_prov_adv_state *state,
+		    struct bt_le_adv_prov_feedback *fb)
+{
+	static uint8_t value;
+
+	ARG_UNUSED(state);
+	ARG_UNUSED(fb);
+
+	provider_cnt++;
+
+	if (provider_err) {
+		return provider_err;
+	}
+
+	value = provider_value;
+
+	sd->type = TEST_DATA_TYPE;
+	sd->data_len = sizeof(value);
+	sd->data = &value;
+
+	return 0;
+}
+
+BT_LE_ADV_PROV_SD_PROVIDER_REGISTER_CACHED(test_cached, get_data);
+
+static int8_t ad_tx_power_get(const struct bt_le_adv_prov_adv_state *state)
+{
+	struct bt_data ad[1];
+	size_t ad_len = ARRAY_SIZE(ad);
+	struct bt_le_adv_prov_feedback fb;
+
+	zassert_equal(bt_le_adv_prov_get_ad_prov_cnt(), ARRAY_SIZE(ad));
+	zassert_ok(bt_le_adv_prov_get_ad(ad, &ad_len, state, &fb));
+	zassert_equal(ad_len, 1);
+	zassert_equal(ad[0].type, BT_DATA_TX_POWER);
+	zassert_equal(ad[0].data_len, sizeof(int8_t));
+
+	return (int8_t)ad[0].data[0];
+}
+
+static uint8_t sd_value_get(const struct bt_le_adv_prov_adv_state *state)
+{
+	struct bt_data sd[1];
+	size_t sd_len = ARRAY_SIZE(sd);
+	struct bt_le_adv_prov_feedback fb;
+
+	zassert_equal(bt_le_adv_prov_get_sd_prov_cnt(), ARRAY_SIZE(sd));
+	zassert_ok(bt_le_adv_prov_get_sd(sd, &sd_len, state, &fb));
+	zassert_equal(sd_len, 1);
+	zassert_equal(sd[0].type, TEST_DATA_TYPE);
+
+	return sd[0].data[0];
+}
+
+static void before_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	controller_tx_power = TEST_TX_POWER;
+	hci_send_err = 0;
+	hci_send_cnt = 0;
+
+	provider_value = 1;
+	provider_err = 0;
+	provider_cnt = 0;
+
+	bt_le_adv_prov_tx_power_invalidate();
+	BT_LE_ADV_PROV_PROVIDER_INVALIDATE(test_cached);
+}
+
+ZTEST(adv_prov_cache, test_tx_power_cache_hit)
+{
+	struct bt_le_adv_prov_adv_state state = {
+		.new_adv_session = true,
+	};
+
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+	zassert_equal(hci_send_cnt, 1);
+
+	/* Advertising data updates during the advertising session use the cached TX power. */
+	state.new_adv_session = false;
+	controller_tx_power = TEST_TX_POWER_CHANGED;
+
+	for (size_t i = 0; i < 3; i++) {
+		zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+		zassert_false(bt_le_adv_prov_ad_changed());
+	}
+
+	zassert_equal(hci_send_cnt, 1);
+}
+
+ZTEST(adv_prov_cache, test_tx_power_invalidate)
+{
+	struct bt_le_adv_prov_adv_state state = {
+		.new_adv_session = true,
+	};
+
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+
+	state.new_adv_session = false;
+	controller_tx_power = TEST_TX_POWER_CHANGED;
+	bt_le_adv_prov_tx_power_invalidate();
+
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER_CHANGED);
+	zassert_equal(hci_send_cnt, 2);
+	zassert_true(bt_le_adv_prov_ad_changed());
+
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER_CHANGED);
+	zassert_equal(hci_send_cnt, 2);
+}
+
+ZTEST(adv_prov_cache, test_tx_power_new_session_and_rpa_rotation)
+{
+	struct bt_le_adv_prov_adv_state state = {
+		.new_adv_session = true,
+	};
+
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+	zassert_equal(hci_send_cnt, 2);
+
+	state.new_adv_session = false;
+	state.rpa_rotated = true;
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+	zassert_equal(hci_send_cnt, 3);
+}
+
+ZTEST(adv_prov_cache, test_tx_power_error_not_cached)
+{
+	struct bt_le_adv_prov_adv_state state = {
+		.new_adv_session = true,
+	};
+	struct bt_data ad[1];
+	size_t ad_len = ARRAY_SIZE(ad);
+	struct bt_le_adv_prov_feedback fb;
+
+	hci_send_err = -EIO;
+	zassert_equal(bt_le_adv_prov_get_ad(ad, &ad_len, &state, &fb), -EIO);
+	zassert_true(bt_le_adv_prov_ad_changed());
+
+	/* The TX power is read again during the next update. */
+	hci_send_err = 0;
+	state.new_adv_session = false;
+	zassert_equal(ad_tx_power_get(&state), TEST_TX_POWER);
+	zassert_equal(hci_send_cnt, 2);
+}
+
+ZTEST(adv_prov_cache, test_cached_provider)
+{
+	struct bt_le_adv_prov_adv_state state = {
+		.new_adv_session = true,
+	};
+
+	zassert_equal(sd_value_get(&state), 1);
+	zassert_equal(provider_cnt, 1);
+
+	state.new_adv_session = false;
+	provider_value = 2;
+	zassert_equal(sd_value_get(&state), 1);
+	zassert_equal(provider_cnt, 1);
+	zassert_false(bt_le_adv_prov_sd_changed());
+
+	/* Provider invalidates its data. */
+	BT_LE_ADV_PROV_PROVIDER_INVALIDATE(test_cached);
+	zassert_equal(sd_value_get(&state), 2);
+	zassert_equal(provider_cnt, 2);
+	zassert_true(bt_le_adv_prov_sd_changed());
+
+	/* Pairing mode and grace period changes refresh the data. */
+	provider_value = 3;
+	state.pairing_mode = true;
+	zassert_equal(sd_value_get(&state), 3);
+	zassert_equal(provider_cnt, 3);
+
+	provider_value = 4;
+	state.in_grace_period = true;
+	zassert_equal(sd_value_get(&state), 4);
+	zassert_equal(provider_cnt, 4);
+
+	zassert_equal(sd_value_get(&state), 4);
+	zassert_equal(provider_cnt, 4);
+}
+
+ZTEST(adv_prov_cache, test_cached_provider_no_data)
+{
+	struct bt_le_adv_prov_adv_state state = {
+		.new_adv_session = true,
+	};
+	struct bt_data sd[1];
+	size_t sd_len = ARRAY_SIZE(sd);
+	struct bt_le_adv_prov_feedback fb;
+
+	/* Lack of data is cached like the data. */
+	provider_err = -ENOENT;
+	zassert_ok(bt_le_adv_prov_get_sd(sd, &sd_len, &state, &fb));
+	zassert_equal(sd_len, 0);
+
+	state.new_adv_session = false;
+	provider_err = 0;
+	sd_len = ARRAY_SIZE(sd);
+	zassert_ok(bt_le_adv_prov_get_sd(sd, &sd_len, &state, &fb));
+	zassert_equal(sd_len, 0);
+	zassert_equal(provider_cnt, 1);
+
+	BT_LE_ADV_PROV_PROVIDER_INVALIDATE(test_cached);
+	zassert_equal(sd_value_get(&state), 1);
+	zassert_equal(provider_cnt, 2);
+}
+
+ZTEST_SUITE(adv_prov_cache, NULL, NULL, before_fn, NULL, NULL);
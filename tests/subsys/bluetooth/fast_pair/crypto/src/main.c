@@ -77,6 +77,34 @@ ZTEST(suite_crypto, test_aes128_ecb)
 	zassert_mem_equal(result_buf, plaintext, sizeof(plaintext), "Invalid decryption result.");
 }
 
+ZTEST(suite_crypto, test_aes128_ecb_prepared_key)
+{
+	static const uint8_t plaintext[] = {0xF3, 0x0F, 0x4E, 0x78, 0x6C, 0x59, 0xA7, 0xBB, 0xF3,
+					    0x87, 0x3B, 0x5A, 0x49, 0xBA, 0x97, 0xEA};
+
+	static const uint8_t key[] = {0xA0, 0xBA, 0xF0, 0xBB, 0x95, 0x1F, 0xF7, 0xB6, 0xCF, 0x5E,
+				      0x3F, 0x45, 0x61, 0xC3, 0x32, 0x1D};
+
+	static const uint8_t ciphertext[] = {0xAC, 0x9A, 0x16, 0xF0, 0x95, 0x3A, 0x3F, 0x22, 0x3D,
+					     0xD1, 0x0C, 0xF5, 0x36, 0xE0, 0x9E, 0x9C};
+
+	struct fp_crypto_aes128_ecb_dec_key dec_key;
+	uint8_t result_buf[FP_CRYPTO_AES128_BLOCK_LEN];
+
+	zassert_ok(fp_crypto_aes128_ecb_dec_key_set(&dec_key, key), "Error during key preparation.");
+
+	/* The prepared key can be used multiple times. */
+	for (size_t i = 0; i < 2; i++) {
+		memset(result_buf, 0, sizeof(result_buf));
+		zassert_ok(fp_crypto_aes128_ecb_decrypt_prepared(result_buf, ciphertext, &dec_key),
+			   "Error during value decryption.");
+		zassert_mem_equal(result_buf, plaintext, sizeof(plaintext),
+				  "Invalid decryption result.");
+	}
+
+	fp_crypto_aes128_ecb_dec_key_clear(&dec_key);
+}
+
 ZTEST(suite_crypto, test_aes128_ctr)
 {
 	static const uint8_t plaintext[] = {0x53, 0x6F, 0x6D, 0x65, 0x6F, 0x6E, 0x65, 0x27, 0x73,
@@ -182,6 +210,17 @@ ZTEST(suite_crypto, test_aes_key_from_ecdh_shared_secret)
 	zassert_mem_equal(result_buf, aes_key, sizeof(aes_key), "Invalid resulting key.");
 }
 
+ZTEST(suite_crypto, test_bloom_filter_size)
+{
+	/* Filter size defined by the specification: s = 1.2 * n + 3 (rounded down). */
+	static const size_t expected_size[] = {0, 4, 5, 6, 7, 9, 10, 11, 12, 13, 15};
+
+	for (size_t n = 0; n < ARRAY_SIZE(expected_size); n++) {
+		zassert_equal(fp_crypto_account_key_filter_size(n), expected_size[n],
+			      "Invalid filter size for %zu Account Keys.", n);
+	}
+}
+
 ZTEST(suite_crypto, test_bloom_filter)
 {
 	static const uint16_t salt = 0xC7C8;
@@ -41,6 +41,17 @@ static int gfire_cnt;
 static struct tm *fired_tm;
 static int galloc_cnt;
 
+/* Scene numbers of the fired actions, in the order they were fired. */
+static uint16_t fired_scene[BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT];
+static int fired_scene_cnt;
+
+/* Offset of the local time from the time derived from uptime. */
+static int64_t clock_offset_ms;
+/* Time by which the local time moves ahead after the next fired action,
+ * as if the action had been handled that late.
+ */
+static int64_t fire_delay_ms;
+
 /* redefined mocks */
 uint8_t model_transition_encode(int32_t transition_time)
 {
@@ -85,6 +96,13 @@ int bt_mesh_scene_srv_set(struct bt_mesh_scene_srv *srv, uint16_t scene,
 		galloc_cnt++;
 	}
 
+	if (fired_scene_cnt < ARRAY_SIZE(fired_scene)) {
+		fired_scene[fired_scene_cnt++] = scene;
+	}
+
+	clock_offset_ms += fire_delay_ms;
+	fire_delay_ms = 0;
+
 	if (gfire_cnt == 0) {
 		k_sem_give(&action_fired);
 	}
@@ -123,7 +141,8 @@ int _bt_mesh_time_srv_update_handler(struct bt_mesh_model *model)
 
 int64_t bt_mesh_time_srv_mktime(struct bt_mesh_time_srv *srv, struct tm *timeptr)
 {
-	return (timeutil_timegm64(timeptr) - timeutil_timegm64(&start_tm)) * 1000;
+	return (timeutil_timegm64(timeptr) - timeutil_timegm64(&start_tm)) * 1000 -
+	       clock_offset_ms;
 }
 
 struct tm *bt_mesh_time_srv_localtime(struct bt_mesh_time_srv *srv,
@@ -136,7 +155,7 @@ struct tm *bt_mesh_time_srv_localtime(struct bt_mesh_time_srv *srv,
 
 	int64_t tmp =  tai_to_ms(&tai);
 
-	tmp += uptime;
+	tmp += uptime + clock_offset_ms;
 	tai = tai_at(tmp);
 	tai_to_ts(&tai, &timeptr);
 
@@ -158,6 +177,9 @@ static void tc_setup(void *f)
 	gfire_cnt = 0;
 	galloc_cnt = 0;
 	fired_tm = NULL;
+	fired_scene_cnt = 0;
+	clock_offset_ms = 0;
+	fire_delay_ms = 0;
 
 	k_sem_reset(&action_fired);
 	zassert_not_null(_bt_mesh_scheduler_srv_cb.init,
@@ -175,19 +197,23 @@ static void tc_teardown(void *f)
 	_bt_mesh_scheduler_srv_cb.reset(&mock_sched_model);
 }
 
-static void action_put(const struct bt_mesh_schedule_entry *test_action)
+static void action_idx_put(uint8_t idx, const struct bt_mesh_schedule_entry *test_action)
 {
 	BT_MESH_MODEL_BUF_DEFINE(buf, BT_MESH_SCHEDULER_OP_ACTION_SET_UNACK,
 			BT_MESH_SCHEDULER_MSG_LEN_ACTION_SET);
 
-	scheduler_action_pack(&buf, 0, test_action);
-
-	start_time_adjust(&start_tm);
+	scheduler_action_pack(&buf, idx, test_action);
 
 	zassert_false(_bt_mesh_scheduler_setup_srv_op[1].func(&mock_sched_model, NULL, &buf),
 		"Cannot schedule test action.");
 }
 
+static void action_put(const struct bt_mesh_schedule_entry *test_action)
+{
+	start_time_adjust(&start_tm);
+	action_idx_put(0, test_action);
+}
+
 /* expected time in seconds */
 static void measurement_start(int64_t expected_time, int fire_cnt)
 {
@@ -823,4 +849,323 @@ ZTEST(scheduler_timing, test_exact_time_general_ovflw)
 	expected_tm_check(fired_tm, &expected, 1);
 }
 
+ZTEST(scheduler_timing, test_fixed_period_every_second)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_ANY_MINUTE,
+			.second = BT_MESH_SCHEDULER_ANY_SECOND,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_mon = 11;
+	start_tm.tm_mday = 31;
+	start_tm.tm_hour = 23;
+	start_tm.tm_min = 59;
+	start_tm.tm_sec = 58;
+
+	action_put(&test_action);
+	measurement_start(3, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 11, 31, 23, 59, 59)},
+		{TM_INIT(111, 0, 1, 0, 0, 0)},
+		{TM_INIT(111, 0, 1, 0, 0, 1)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_every_15_seconds)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_ANY_MINUTE,
+			.second = BT_MESH_SCHEDULER_EVERY_15_SECONDS,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_min = 59;
+	start_tm.tm_sec = 50;
+
+	action_put(&test_action);
+	measurement_start(40, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 1, 1, 0, 0)},
+		{TM_INIT(110, 0, 1, 1, 0, 15)},
+		{TM_INIT(110, 0, 1, 1, 0, 30)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_every_20_seconds)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_ANY_MINUTE,
+			.second = BT_MESH_SCHEDULER_EVERY_20_SECONDS,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_hour = 23;
+	start_tm.tm_min = 59;
+	start_tm.tm_sec = 30;
+
+	action_put(&test_action);
+	measurement_start(50, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 1, 23, 59, 40)},
+		{TM_INIT(110, 0, 2, 0, 0, 0)},
+		{TM_INIT(110, 0, 2, 0, 0, 20)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_every_minute)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_ANY_MINUTE,
+			.second = 30,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_hour = 23;
+	start_tm.tm_min = 59;
+
+	action_put(&test_action);
+	measurement_start(3 * 60, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 1, 23, 59, 30)},
+		{TM_INIT(110, 0, 2, 0, 0, 30)},
+		{TM_INIT(110, 0, 2, 0, 1, 30)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_every_15_minutes)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_EVERY_15_MINUTES,
+			.second = 10,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_hour = 23;
+	start_tm.tm_min = 50;
+
+	action_put(&test_action);
+	measurement_start(45 * 60, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 2, 0, 0, 10)},
+		{TM_INIT(110, 0, 2, 0, 15, 10)},
+		{TM_INIT(110, 0, 2, 0, 30, 10)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_every_20_minutes)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_EVERY_20_MINUTES,
+			.second = 0,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_hour = 23;
+	start_tm.tm_min = 30;
+
+	action_put(&test_action);
+	measurement_start(50 * 60, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 1, 23, 40, 0)},
+		{TM_INIT(110, 0, 2, 0, 0, 0)},
+		{TM_INIT(110, 0, 2, 0, 20, 0)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_hourly)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = 30,
+			.second = 0,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_mday = 31;
+	start_tm.tm_hour = 23;
+
+	action_put(&test_action);
+	measurement_start(3 * 60 * 60, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 31, 23, 30, 0)},
+		{TM_INIT(110, 1, 1, 0, 30, 0)},
+		{TM_INIT(110, 1, 1, 1, 30, 0)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_daily)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = 6,
+			.minute = 30,
+			.second = 15,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	start_tm.tm_mday = 30;
+	start_tm.tm_hour = 12;
+
+	action_put(&test_action);
+	measurement_start(60ll * 60ll * 24ll * 3ll, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 31, 6, 30, 15)},
+		{TM_INIT(110, 1, 1, 6, 30, 15)},
+		{TM_INIT(110, 1, 2, 6, 30, 15)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_fixed_period_late_fire)
+{
+	const struct bt_mesh_schedule_entry test_action = {
+			.year = BT_MESH_SCHEDULER_ANY_YEAR,
+			.month  = ANY_MONTH,
+			.day = BT_MESH_SCHEDULER_ANY_DAY,
+			.hour = BT_MESH_SCHEDULER_ANY_HOUR,
+			.minute = BT_MESH_SCHEDULER_ANY_MINUTE,
+			.second = BT_MESH_SCHEDULER_EVERY_15_SECONDS,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+			.scene_number = 1
+	};
+
+	/* The first action is handled 100 seconds late, so the next one is
+	 * planned by the calendar stages from 00:01:55.
+	 */
+	fire_delay_ms = 100 * MSEC_PER_SEC;
+
+	action_put(&test_action);
+	measurement_start(60, 3);
+
+	struct tm expected[3] = {
+		{TM_INIT(110, 0, 1, 0, 0, 15)},
+		{TM_INIT(110, 0, 1, 0, 2, 0)},
+		{TM_INIT(110, 0, 1, 0, 2, 15)}
+	};
+
+	expected_tm_check(fired_tm, expected, 3);
+}
+
+ZTEST(scheduler_timing, test_equal_time_order)
+{
+	struct bt_mesh_schedule_entry test_action = {
+			.year = 10,
+			.month  = ANY_MONTH,
+			.day = 1,
+			.hour = 0,
+			.minute = 0,
+			.second = 30,
+			.day_of_week = ANY_DAY_OF_WEEK,
+			.action = BT_MESH_SCHEDULER_SCENE_RECALL,
+			.transition_time = 0,
+	};
+	struct tm expected[BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT];
+
+	start_time_adjust(&start_tm);
+
+	/* Add the entries out of index order. The entries with the same time
+	 * are fired in the index order.
+	 */
+	for (int i = 0; i < BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT; i++) {
+		uint8_t idx = (i * 7) % BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT;
+
+		test_action.scene_number = idx + 1;
+		action_idx_put(idx, &test_action);
+	}
+
+	measurement_start(30, BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT);
+
+	for (int i = 0; i < BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT; i++) {
+		expected[i] = (struct tm) {
+			TM_INIT(110, 0, 1, 0, 0, 30)
+		};
+
+		zassert_equal(fired_scene[i], i + 1,
+			      "scene %d is fired on step %d instead of scene %d",
+			      fired_scene[i], i + 1, i + 1);
+	}
+
+	zassert_equal(fired_scene_cnt, BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT);
+	expected_tm_check(fired_tm, expected, BT_MESH_SCHEDULER_ACTION_ENTRY_COUNT);
+}
+
 ZTEST_SUITE(scheduler_timing, NULL, NULL, tc_setup, tc_teardown, NULL);
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RTC_STUB_H_
+#define NRF_RTC_STUB_H_
+
+#include <zephyr/types.h>
+
+#define NRF_RTC_INPUT_FREQ 32768
+#define NRF_RTC_COUNTER_MAX 0xFFFFFFUL
+
+#define NRF_RTC0 NULL
+
+/* Current RTC counter value, set by the test. */
+extern uint32_t rtc_counter_stub;
+
+static inline uint32_t nrf_rtc_counter_get(const void *p_reg)
+{
+	(void)p_reg;
+
+	return rtc_counter_stub;
+}
+
+#endif /* NRF_RTC_STUB_H_ */
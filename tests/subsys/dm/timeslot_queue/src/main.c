@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+
+#include "timeslot_queue.h"
+#include "time.h"
+
+#define QUEUE_LENGTH        CONFIG_DM_TIMESLOT_QUEUE_LENGTH
+#define COUNT_SAME_PEER     CONFIG_DM_TIMESLOT_QUEUE_COUNT_SAME_PEER
+#define RANGING_OFFSET_US   CONFIG_DM_RANGING_OFFSET_US
+
+#define WINDOW_LEN_US       4000
+#define TIMESLOT_LEN_US     6000
+/* Start delay step that keeps two timeslots apart. */
+#define SLOT_STEP_US        20000
+
+#define FAIR_PEER_COUNT     (QUEUE_LENGTH / COUNT_SAME_PEER)
+
+#define SIM_PEER_COUNT      64
+#define SIM_RANGING_COUNT   20000
+#define SIM_IDLE_STEP_US    1000
+
+uint32_t rtc_counter_stub;
+
+static void time_set(uint32_t tick)
+{
+	rtc_counter_stub = tick % (RTC_COUNTER_MAX + 1);
+}
+
+static void request_init(struct dm_request *req, uint8_t peer_id, uint32_t start_delay_us)
+{
+	memset(req, 0, sizeof(*req));
+	req->role = DM_ROLE_INITIATOR;
+	req->bt_addr.type = BT_ADDR_LE_RANDOM;
+	req->bt_addr.a.val[0] = peer_id;
+	req->ranging_mode = DM_RANGING_MODE_RTT;
+	req->start_delay_us = start_delay_us;
+}
+
+static int request_add(uint8_t peer_id, uint32_t start_delay_us)
+{
+	struct dm_request req;
+
+	request_init(&req, peer_id, start_delay_us);
+
+	return timeslot_queue_append(&req, rtc_counter_stub, WINDOW_LEN_US, TIMESLOT_LEN_US);
+}
+
+static uint8_t head_peer_get(void)
+{
+	struct timeslot_request *req = timeslot_queue_peek();
+
+	zassert_not_null(req, "Queue is empty");
+
+	return req->dm_req.bt_addr.a.val[0];
+}
+
+static void queue_flush(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	time_set(0);
+	while (timeslot_queue_peek()) {
+		timeslot_queue_remove_first();
+	}
+}
+
+ZTEST(suite_dm_timeslot_queue, test_start_time_order)
+{
+	zassert_ok(request_add(1, 3 * SLOT_STEP_US));
+	zassert_ok(request_add(2, 1 * SLOT_STEP_US));
+	zassert_ok(request_add(3, 2 * SLOT_STEP_US));
+
+	zassert_equal(head_peer_get(), 2);
+	timeslot_queue_remove_first();
+	zassert_equal(head_peer_get(), 3);
+	timeslot_queue_remove_first();
+	zassert_equal(head_peer_get(), 1);
+	timeslot_queue_remove_first();
+	zassert_is_null(timeslot_queue_peek());
+}
+
+ZTEST(suite_dm_timeslot_queue, test_start_time_order_wrap)
+{
+	/* The first timeslot starts before the RTC counter wraps, the second one after. */
+	time_set(RTC_COUNTER_MAX - US_TO_RTC_TICKS(RANGING_OFFSET_US + SLOT_STEP_US));
+
+	zassert_ok(request_add(1, 2 * SLOT_STEP_US));
+	zassert_ok(request_add(2, 0));
+
+	zassert_equal(head_peer_get(), 2);
+	timeslot_queue_remove_first();
+	zassert_equal(head_peer_get(), 1);
+	zassert_true(timeslot_queue_peek()->start_time < rtc_counter_stub);
+}
+
+ZTEST(suite_dm_timeslot_queue, test_overlap)
+{
+	zassert_ok(request_add(1, 0));
+	zassert_ok(request_add(2, 2 * SLOT_STEP_US));
+
+	/* Same start as an already scheduled timeslot. */
+	zassert_equal(request_add(3, 0), -EBUSY);
+	/* Too close after the first and before the second timeslot. */
+	zassert_equal(request_add(3, TIMESLOT_LEN_US), -EBUSY);
+	zassert_equal(request_add(3, 2 * SLOT_STEP_US - TIMESLOT_LEN_US), -EBUSY);
+	/* Fits between the two timeslots. */
+	zassert_ok(request_add(3, SLOT_STEP_US));
+	/* Starts before the tail of the queue, but overlaps the head. */
+	zassert_equal(request_add(4, SLOT_STEP_US / 2), -EBUSY);
+}
+
+ZTEST(suite_dm_timeslot_queue, test_same_peer_limit)
+{
+	for (int i = 0; i < COUNT_SAME_PEER; i++) {
+		zassert_ok(request_add(1, i * SLOT_STEP_US));
+	}
+
+	zassert_equal(request_add(1, COUNT_SAME_PEER * SLOT_STEP_US), -EAGAIN);
+	zassert_ok(request_add(2, COUNT_SAME_PEER * SLOT_STEP_US));
+
+	/* Removing a timeslot of the peer frees up room for another one. */
+	timeslot_queue_remove_first();
+	zassert_ok(request_add(1, (COUNT_SAME_PEER + 1) * SLOT_STEP_US));
+}
+
+ZTEST(suite_dm_timeslot_queue, test_rng_seed)
+{
+	struct dm_request req;
+
+	request_init(&req, 1, 0);
+	req.rng_seed = 10;
+
+	zassert_ok(timeslot_queue_append(&req, rtc_counter_stub, WINDOW_LEN_US, TIMESLOT_LEN_US));
+	zassert_equal(req.rng_seed, 11);
+	zassert_equal(timeslot_queue_peek()->dm_req.rng_seed, 11);
+
+	zassert_equal(timeslot_queue_append(&req, rtc_counter_stub, WINDOW_LEN_US,
+					    TIMESLOT_LEN_US), -EBUSY);
+	zassert_equal(req.rng_seed, 11);
+}
+
+ZTEST(suite_dm_timeslot_queue, test_full_queue)
+{
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		zassert_ok(request_add(i, i * SLOT_STEP_US));
+	}
+
+	/* Every peer has a single timeslot, so there is nothing to take over. */
+	zassert_equal(request_add(QUEUE_LENGTH, QUEUE_LENGTH * SLOT_STEP_US), -ENOMEM);
+}
+
+ZTEST(suite_dm_timeslot_queue, test_full_queue_fairness)
+{
+	const int peer_count = FAIR_PEER_COUNT;
+	int scheduled[FAIR_PEER_COUNT + 1];
+	struct timeslot_request *req;
+
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		zassert_ok(request_add(i % peer_count, i * SLOT_STEP_US));
+	}
+
+	/* The new peer takes over the last timeslot of one of the busy peers. */
+	zassert_ok(request_add(peer_count, QUEUE_LENGTH * SLOT_STEP_US));
+	zassert_ok(request_add(peer_count, (QUEUE_LENGTH + 1) * SLOT_STEP_US));
+
+	memset(scheduled, 0, sizeof(scheduled));
+	while ((req = timeslot_queue_peek()) != NULL) {
+		scheduled[req->dm_req.bt_addr.a.val[0]]++;
+		timeslot_queue_remove_first();
+	}
+
+	zassert_equal(scheduled[peer_count], 2);
+	for (int i = 0; i < peer_count; i++) {
+		zassert_true(scheduled[i] >= COUNT_SAME_PEER - 1);
+	}
+}
+
+ZTEST(suite_dm_timeslot_queue, test_deadline_drop)
+{
+	zassert_ok(request_add(1, 0));
+	zassert_ok(request_add(2, SLOT_STEP_US));
+	zassert_ok(request_add(3, 2 * SLOT_STEP_US));
+
+	/* The first timeslot has started already. */
+	time_set(US_TO_RTC_TICKS(RANGING_OFFSET_US) + 1);
+	zassert_equal(head_peer_get(), 2);
+
+	/* All timeslots have started already. */
+	time_set(US_TO_RTC_TICKS(RANGING_OFFSET_US + 3 * SLOT_STEP_US));
+	zassert_is_null(timeslot_queue_peek());
+
+	/* The peers can be scheduled again. */
+	zassert_ok(request_add(1, 0));
+}
+
+/* Every peer keeps a single ranging request pending, like the DM module does
+ * with CONFIG_DM_TIMESLOT_RESCHEDULE. Requests that cannot be scheduled are
+ * retried when the next timeslot is processed. The order in which the peers
+ * send their requests changes after every timeslot.
+ */
+ZTEST(suite_dm_timeslot_queue, test_ranging_rate)
+{
+	static uint32_t ranging_count[SIM_PEER_COUNT];
+	static bool pending[SIM_PEER_COUNT];
+	uint64_t now_us = 0;
+	uint32_t min_count = UINT32_MAX;
+	uint32_t max_count = 0;
+	uint32_t rejected = 0;
+	uint32_t elapsed_s;
+
+	memset(ranging_count, 0, sizeof(ranging_count));
+	memset(pending, 0, sizeof(pending));
+
+	for (uint32_t done = 0; done < SIM_RANGING_COUNT;) {
+		struct timeslot_request *req;
+
+		time_set(US_TO_RTC_TICKS(now_us));
+
+		for (int n = 0; n < SIM_PEER_COUNT; n++) {
+			int i = (done + n) % SIM_PEER_COUNT;
+
+			if (pending[i]) {
+				continue;
+			}
+
+			/* Spread the peers with a start delay that depends on the peer. */
+			if (request_add(i, (i * 7919) % (4 * SLOT_STEP_US)) == 0) {
+				pending[i] = true;
+			} else {
+				rejected++;
+			}
+		}
+
+		req = timeslot_queue_peek();
+		if (!req) {
+			now_us += SIM_IDLE_STEP_US;
+			continue;
+		}
+
+		uint8_t peer = req->dm_req.bt_addr.a.val[0];
+
+		now_us += TICKS_TO_US(time_distance_get(rtc_counter_stub, req->start_time));
+		now_us += req->timeslot_length_us;
+		timeslot_queue_remove_first();
+
+		pending[peer] = false;
+		ranging_count[peer]++;
+		done++;
+	}
+
+	elapsed_s = now_us / USEC_PER_SEC;
+	zassert_true(elapsed_s > 0);
+
+	TC_PRINT("%u rangings in %u s, %u requests rejected\n",
+		 SIM_RANGING_COUNT, elapsed_s, rejected);
+
+	for (int i = 0; i < SIM_PEER_COUNT; i++) {
+		TC_PRINT("peer %2d: %5u rangings, %u.%02u rangings/s\n", i, ranging_count[i],
+			 ranging_count[i] / elapsed_s, (ranging_count[i] * 100 / elapsed_s) % 100);
+
+		min_count = MIN(min_count, ranging_count[i]);
+		max_count = MAX(max_count, ranging_count[i]);
+	}
+
+	/* No peer is starved and the rate is evenly shared between the peers. */
+	zassert_true(min_count > 0);
+	zassert_true(max_count <= 2 * min_count, "Unfair schedule: min %u, max %u",
+		     min_count, max_count);
+}
+
+ZTEST_SUITE(suite_dm_timeslot_queue, NULL, NULL, queue_flush, NULL, NULL);
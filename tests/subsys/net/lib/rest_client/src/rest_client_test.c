@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <net/rest_client.h>
+
+#include "zephyr/net/cmock_socket.h"
+#include "zephyr/net/http/cmock_client.h"
+
+#define TEST_HOST		"api.test-host.com"
+#define TEST_HOST_OTHER		"api.other-test-host.com"
+#define TEST_HOST_THIRD		"api.third-test-host.com"
+#define TEST_PORT		443
+#define TEST_SEC_TAG		16842753
+#define TEST_URL		"/v1/test"
+
+#define TEST_RESP_HEADERS	"HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\n"
+#define TEST_RESP_BODY		"{}"
+
+#define TEST_FIRST_FD		10
+#define TEST_IDLE_TIMEOUT_MS	(CONFIG_REST_CLIENT_CONN_POOL_IDLE_TIMEOUT * MSEC_PER_SEC)
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+static char resp_buf[256];
+
+static int next_fd;
+static int socket_count;
+static int connect_count;
+static int close_count;
+static int last_closed_fd;
+static int poll_ret;
+static int http_req_fail_count;
+static bool server_keep_alive;
+
+/* The HTTP parser is not part of the test, the stub tells whether the server keeps
+ * the connection open.
+ */
+int http_should_keep_alive(const struct http_parser *parser)
+{
+	ARG_UNUSED(parser);
+
+	return server_keep_alive;
+}
+
+/* Stubs */
+static int socket_stub(int family, int type, int proto, int num_calls)
+{
+	socket_count++;
+
+	return next_fd++;
+}
+
+static int connect_stub(int sock, const struct sockaddr *addr, socklen_t addrlen, int num_calls)
+{
+	/* Every connect performs a full TCP and TLS handshake. */
+	connect_count++;
+
+	return 0;
+}
+
+static int close_stub(int sock, int num_calls)
+{
+	close_count++;
+	last_closed_fd = sock;
+
+	return 0;
+}
+
+static int getaddrinfo_stub(const char *host, const char *service,
+			    const struct zsock_addrinfo *hints, struct zsock_addrinfo **res,
+			    int num_calls)
+{
+	static struct sockaddr test_sa = { .sa_family = AF_INET };
+	static struct zsock_addrinfo test_ai = {
+		.ai_family = AF_INET,
+		.ai_addr = &test_sa,
+		.ai_addrlen = sizeof(struct sockaddr_in),
+	};
+
+	*res = &test_ai;
+
+	return 0;
+}
+
+static int poll_stub(struct pollfd *fds, int nfds, int timeout, int num_calls)
+{
+	fds[0].revents = poll_ret ? POLLIN : 0;
+
+	return poll_ret;
+}
+
+static int http_client_req_stub(int sock, struct http_request *req, int32_t timeout,
+				void *user_data, int num_calls)
+{
+	struct http_response rsp = { 0 };
+	size_t hdr_len = strlen(TEST_RESP_HEADERS);
+	size_t body_len = strlen(TEST_RESP_BODY);
+
+	if (http_req_fail_count) {
+		http_req_fail_count--;
+		return -ECONNRESET;
+	}
+
+	memcpy(req->recv_buf, TEST_RESP_HEADERS, hdr_len);
+	memcpy(req->recv_buf + hdr_len, TEST_RESP_BODY, body_len);
+
+	rsp.body_found = 1;
+	rsp.body_frag_start = req->recv_buf + hdr_len;
+	rsp.data_len = hdr_len + body_len;
+	rsp.processed = body_len;
+	rsp.http_status_code = REST_CLIENT_HTTP_STATUS_OK;
+	strcpy(rsp.http_status, "OK");
+
+	req->response(&rsp, HTTP_DATA_FINAL, user_data);
+
+	return hdr_len + body_len;
+}
+
+void setUp(void)
+{
+	next_fd = TEST_FIRST_FD;
+	socket_count = 0;
+	connect_count = 0;
+	close_count = 0;
+	last_closed_fd = -1;
+	poll_ret = 0;
+	http_req_fail_count = 0;
+	server_keep_alive = true;
+
+	__cmock_getaddrinfo_Stub(getaddrinfo_stub);
+	__cmock_freeaddrinfo_Ignore();
+	__cmock_inet_ntop_IgnoreAndReturn(NULL);
+	__cmock_socket_Stub(socket_stub);
+	__cmock_setsockopt_IgnoreAndReturn(0);
+	__cmock_connect_Stub(connect_stub);
+	__cmock_close_Stub(close_stub);
+	__cmock_poll_Stub(poll_stub);
+	__cmock_http_client_req_Stub(http_client_req_stub);
+}
+
+void tearDown(void)
+{
+	rest_client_conn_pool_flush();
+}
+
+/* Helper functions */
+static int request_method_send(const char *host, int sec_tag, enum http_method method,
+			       struct rest_client_resp_context *resp)
+{
+	struct rest_client_req_context req;
+
+	rest_client_request_defaults_set(&req);
+	req.http_method = method;
+	req.host = host;
+	req.port = TEST_PORT;
+	req.sec_tag = sec_tag;
+	req.url = TEST_URL;
+	req.resp_buff = resp_buf;
+	req.resp_buff_len = sizeof(resp_buf);
+
+	memset(resp, 0, sizeof(*resp));
+
+	return rest_client_request(&req, resp);
+}
+
+static int request_send(const char *host, int sec_tag, struct rest_client_resp_context *resp)
+{
+	return request_method_send(host, sec_tag, HTTP_GET, resp);
+}
+
+/* Test that consecutive requests to the same destination use a single connection. */
+void test_conn_pool_reuse(void)
+{
+	struct rest_client_resp_context resp;
+
+	for (int i = 0; i < 5; i++) {
+		TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+		TEST_ASSERT_EQUAL(REST_CLIENT_HTTP_STATUS_OK, resp.http_status_code);
+		TEST_ASSERT_EQUAL_STRING(TEST_RESP_BODY, resp.response);
+		TEST_ASSERT_EQUAL(TEST_FIRST_FD, resp.used_socket_id);
+		TEST_ASSERT_FALSE(resp.used_socket_is_alive);
+	}
+
+	TEST_ASSERT_EQUAL(1, socket_count);
+	TEST_ASSERT_EQUAL(1, connect_count);
+	TEST_ASSERT_EQUAL(0, close_count);
+
+	rest_client_conn_pool_flush();
+
+	TEST_ASSERT_EQUAL(1, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, last_closed_fd);
+}
+
+/* Test that the connection is closed when the server does not allow keep-alive. */
+void test_conn_pool_server_closes(void)
+{
+	struct rest_client_resp_context resp;
+
+	server_keep_alive = false;
+
+	for (int i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	}
+
+	TEST_ASSERT_EQUAL(3, connect_count);
+	TEST_ASSERT_EQUAL(3, close_count);
+}
+
+/* Test that connections are pooled per destination. */
+void test_conn_pool_destination(void)
+{
+	struct rest_client_resp_context resp;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG + 1, &resp));
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST_OTHER, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(3, connect_count);
+
+	/* The connection to the first destination was the least recently used one. */
+	TEST_ASSERT_EQUAL(1, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, last_closed_fd);
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG + 1, &resp));
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST_OTHER, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(3, connect_count);
+	TEST_ASSERT_EQUAL(1, close_count);
+}
+
+/* Test that a pooled connection closed by the server is not used. */
+void test_conn_pool_stale_conn(void)
+{
+	struct rest_client_resp_context resp;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+
+	/* The socket is readable, the server has closed the connection. */
+	poll_ret = 1;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(2, connect_count);
+	TEST_ASSERT_EQUAL(1, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, last_closed_fd);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD + 1, resp.used_socket_id);
+}
+
+/* Test that the request is sent again over a new connection if the pooled one fails. */
+void test_conn_pool_retry(void)
+{
+	struct rest_client_resp_context resp;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+
+	http_req_fail_count = 1;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(REST_CLIENT_HTTP_STATUS_OK, resp.http_status_code);
+	TEST_ASSERT_EQUAL(2, connect_count);
+	TEST_ASSERT_EQUAL(1, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, last_closed_fd);
+}
+
+/* Test that a request that is not idempotent is not sent again if the pooled connection
+ * fails, as the server may already have processed it.
+ */
+void test_conn_pool_no_retry_post(void)
+{
+	struct rest_client_resp_context resp;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+
+	http_req_fail_count = 1;
+
+	TEST_ASSERT_EQUAL(-ECONNRESET,
+			  request_method_send(TEST_HOST, TEST_SEC_TAG, HTTP_POST, &resp));
+	TEST_ASSERT_EQUAL(1, connect_count);
+	TEST_ASSERT_EQUAL(1, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, last_closed_fd);
+
+	/* The failed connection is not pooled. */
+	TEST_ASSERT_EQUAL(0, request_method_send(TEST_HOST, TEST_SEC_TAG, HTTP_PATCH, &resp));
+	TEST_ASSERT_EQUAL(2, connect_count);
+}
+
+/* Test that a failing new connection is not retried nor pooled. */
+void test_conn_pool_new_conn_error(void)
+{
+	struct rest_client_resp_context resp;
+
+	http_req_fail_count = 1;
+
+	TEST_ASSERT_EQUAL(-ECONNRESET, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(1, connect_count);
+	TEST_ASSERT_EQUAL(1, close_count);
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(2, connect_count);
+}
+
+/* Test that idle connections are closed after the idle timeout. */
+void test_conn_pool_idle_timeout(void)
+{
+	struct rest_client_resp_context resp;
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(0, close_count);
+
+	k_sleep(K_MSEC(TEST_IDLE_TIMEOUT_MS / 2));
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST_THIRD, TEST_SEC_TAG, &resp));
+
+	k_sleep(K_MSEC(TEST_IDLE_TIMEOUT_MS / 2 + 100));
+	TEST_ASSERT_EQUAL(1, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, last_closed_fd);
+
+	k_sleep(K_MSEC(TEST_IDLE_TIMEOUT_MS / 2));
+	TEST_ASSERT_EQUAL(2, close_count);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD + 1, last_closed_fd);
+
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(3, connect_count);
+}
+
+/* Test that connections managed by the caller are not pooled. */
+void test_conn_pool_caller_keep_alive(void)
+{
+	struct rest_client_req_context req;
+	struct rest_client_resp_context resp = { 0 };
+
+	rest_client_request_defaults_set(&req);
+	req.host = TEST_HOST;
+	req.port = TEST_PORT;
+	req.sec_tag = TEST_SEC_TAG;
+	req.url = TEST_URL;
+	req.resp_buff = resp_buf;
+	req.resp_buff_len = sizeof(resp_buf);
+	req.keep_alive = true;
+
+	TEST_ASSERT_EQUAL(0, rest_client_request(&req, &resp));
+	TEST_ASSERT_TRUE(resp.used_socket_is_alive);
+	TEST_ASSERT_EQUAL(TEST_FIRST_FD, req.connect_socket);
+
+	/* The caller closes its own socket by sending the last request without keep-alive. */
+	req.keep_alive = false;
+
+	TEST_ASSERT_EQUAL(0, rest_client_request(&req, &resp));
+	TEST_ASSERT_EQUAL(REST_CLIENT_SCKT_CONNECT, req.connect_socket);
+	TEST_ASSERT_EQUAL(1, connect_count);
+	TEST_ASSERT_EQUAL(1, close_count);
+
+	/* Nothing was pooled. */
+	TEST_ASSERT_EQUAL(0, request_send(TEST_HOST, TEST_SEC_TAG, &resp));
+	TEST_ASSERT_EQUAL(2, connect_count);
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include <nfc/ndef/msg.h>
+#include <nfc/ndef/record.h>
+#include <nfc/ndef/text_rec.h>
+
+#define BIN_PAYLOAD_LEN		300
+#define NESTED_BIN_PAYLOAD_LEN	5
+#define MSG_BUF_SIZE		1024
+
+/* Maximum number of payload constructor calls for a record per encoded part:
+ * one to get the payload length and one to generate the payload.
+ */
+#define CONSTRUCTOR_CALLS_MAX	2
+
+static const uint8_t bin_type[] = "application/octet-stream";
+static const uint8_t bin_id[] = {'b', 'i', 'n'};
+static const uint8_t nested_type[] = {'H', 's'};
+static const uint8_t nested_id[] = {'n'};
+static const uint8_t en_code[] = {'e', 'n'};
+static const uint8_t text[] = "Hello World! This text is split into many parts.";
+static const uint8_t counted_text[] = "Payload constructor calls are counted.";
+static const uint8_t counted_id[] = {'c', 'n', 't'};
+
+static uint8_t bin_payload[BIN_PAYLOAD_LEN];
+static uint8_t nested_bin_payload[NESTED_BIN_PAYLOAD_LEN];
+
+static uint8_t reference[MSG_BUF_SIZE];
+static uint32_t reference_len;
+static uint8_t buffer[MSG_BUF_SIZE];
+
+static size_t constructor_calls;
+
+static int counted_payload_encode(struct nfc_ndef_text_rec_payload *payload_desc,
+				  uint8_t *buff, uint32_t *len)
+{
+	constructor_calls++;
+
+	return nfc_ndef_text_rec_payload_encode(payload_desc, buff, len);
+}
+
+NFC_NDEF_RECORD_BIN_DATA_DEF(bin_rec, TNF_MEDIA_TYPE,
+			     bin_id, sizeof(bin_id),
+			     bin_type, sizeof(bin_type) - 1,
+			     bin_payload, sizeof(bin_payload));
+
+NFC_NDEF_TEXT_RECORD_DESC_DEF(text_rec, UTF_8, en_code, sizeof(en_code),
+			      text, sizeof(text) - 1);
+
+NFC_NDEF_RECORD_BIN_DATA_DEF(nested_bin_rec, TNF_MEDIA_TYPE,
+			     NULL, 0,
+			     bin_type, sizeof(bin_type) - 1,
+			     nested_bin_payload, sizeof(nested_bin_payload));
+
+NFC_NDEF_TEXT_RECORD_DESC_DEF(nested_text_rec, UTF_8, en_code, sizeof(en_code),
+			      text, sizeof(text) - 1);
+
+NFC_NDEF_MSG_DEF(nested_msg, 2);
+
+NFC_NDEF_NESTED_NDEF_MSG_RECORD_DEF(nested_rec, TNF_WELL_KNOWN,
+				    nested_id, sizeof(nested_id),
+				    nested_type, sizeof(nested_type),
+				    &NFC_NDEF_MSG(nested_msg));
+
+static struct nfc_ndef_text_rec_payload counted_payload = {
+	.utf = UTF_8,
+	.lang_code = en_code,
+	.lang_code_len = sizeof(en_code),
+	.data = counted_text,
+	.data_len = sizeof(counted_text) - 1,
+};
+
+NFC_NDEF_GENERIC_RECORD_DESC_DEF(counted_rec, TNF_WELL_KNOWN,
+				 counted_id, sizeof(counted_id),
+				 nfc_ndef_text_rec_type_field,
+				 NFC_NDEF_TEXT_REC_TYPE_LENGTH,
+				 counted_payload_encode,
+				 &counted_payload);
+
+NFC_NDEF_MSG_DEF(msg, 4);
+
+/* Encode the message in chunks of the given size and compare the result with
+ * the message encoded at once.
+ */
+static void msg_encode_in_chunks(uint32_t chunk_size)
+{
+	uint32_t offset = 0;
+
+	memset(buffer, 0, sizeof(buffer));
+
+	while (offset < reference_len) {
+		uint32_t len = chunk_size;
+		uint32_t expected_len = MIN(chunk_size, reference_len - offset);
+
+		constructor_calls = 0;
+
+		zassert_ok(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg), offset,
+						    &buffer[offset], &len),
+			   "Encoding failed, chunk size %u, offset %u",
+			   chunk_size, offset);
+		zassert_equal(len, expected_len,
+			      "Invalid length, chunk size %u, offset %u",
+			      chunk_size, offset);
+		zassert_true(constructor_calls <= CONSTRUCTOR_CALLS_MAX,
+			     "%zu constructor calls, chunk size %u, offset %u",
+			     constructor_calls, chunk_size, offset);
+
+		offset += len;
+	}
+
+	zassert_mem_equal(buffer, reference, reference_len,
+			  "Invalid message, chunk size %u", chunk_size);
+}
+
+static void record_encode_in_chunks(struct nfc_ndef_record_desc const *record)
+{
+	uint8_t record_ref[MSG_BUF_SIZE];
+	uint32_t record_len = sizeof(record_ref);
+
+	zassert_ok(nfc_ndef_record_encode(record, NDEF_MIDDLE_RECORD,
+					  record_ref, &record_len));
+
+	for (uint32_t chunk_size = 1; chunk_size <= record_len; chunk_size++) {
+		memset(buffer, 0, sizeof(buffer));
+
+		for (uint32_t offset = 0; offset < record_len; ) {
+			uint32_t len = chunk_size;
+
+			zassert_ok(nfc_ndef_record_encode_part(record,
+							       NDEF_MIDDLE_RECORD,
+							       offset,
+							       &buffer[offset],
+							       &len));
+			zassert_equal(len, MIN(chunk_size, record_len - offset));
+
+			offset += len;
+		}
+
+		zassert_mem_equal(buffer, record_ref, record_len,
+				  "Invalid record, chunk size %u", chunk_size);
+	}
+}
+
+static void *ndef_setup(void)
+{
+	for (size_t i = 0; i < sizeof(bin_payload); i++) {
+		bin_payload[i] = i;
+	}
+
+	for (size_t i = 0; i < sizeof(nested_bin_payload); i++) {
+		nested_bin_payload[i] = 0xA0 + i;
+	}
+
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(nested_msg),
+				&NFC_NDEF_RECORD_BIN_DATA(nested_bin_rec)));
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(nested_msg),
+				&NFC_NDEF_TEXT_RECORD_DESC(nested_text_rec)));
+
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg),
+				&NFC_NDEF_RECORD_BIN_DATA(bin_rec)));
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg),
+				&NFC_NDEF_TEXT_RECORD_DESC(text_rec)));
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg),
+				&NFC_NDEF_NESTED_NDEF_MSG_RECORD(nested_rec)));
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg),
+				&NFC_NDEF_GENERIC_RECORD_DESC(counted_rec)));
+
+	reference_len = sizeof(reference);
+	zassert_ok(nfc_ndef_msg_encode(&NFC_NDEF_MSG(msg), reference,
+				       &reference_len));
+
+	return NULL;
+}
+
+ZTEST(nfc_ndef_encode_part, test_msg_all_chunk_sizes)
+{
+	for (uint32_t chunk_size = 1; chunk_size <= reference_len; chunk_size++) {
+		msg_encode_in_chunks(chunk_size);
+	}
+}
+
+ZTEST(nfc_ndef_encode_part, test_msg_record_boundaries)
+{
+	uint32_t boundary = 0;
+
+	for (uint32_t i = 0; i < NFC_NDEF_MSG(msg).record_count; i++) {
+		uint32_t record_len = sizeof(buffer);
+		uint32_t len;
+
+		zassert_ok(nfc_ndef_record_encode(NFC_NDEF_MSG(msg).record[i],
+						  NDEF_MIDDLE_RECORD, NULL,
+						  &record_len));
+
+		/* Part that starts at the first byte of the record. */
+		len = 1;
+		zassert_ok(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg), boundary,
+						    buffer, &len));
+		zassert_equal(len, 1);
+		zassert_equal(buffer[0], reference[boundary]);
+
+		/* Part that spans the last byte of the record and the first
+		 * byte of the next record.
+		 */
+		boundary += record_len;
+		len = 2;
+		zassert_ok(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg),
+						    boundary - 1, buffer, &len));
+		zassert_equal(len, MIN(2, reference_len - boundary + 1));
+		zassert_mem_equal(buffer, &reference[boundary - 1], len);
+	}
+
+	zassert_equal(boundary, reference_len);
+}
+
+ZTEST(nfc_ndef_encode_part, test_msg_end)
+{
+	uint32_t len = sizeof(buffer);
+
+	/* Part that is longer than the rest of the message. */
+	zassert_ok(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg), 1, buffer, &len));
+	zassert_equal(len, reference_len - 1);
+	zassert_mem_equal(buffer, &reference[1], len);
+
+	/* Parts that start at or after the end of the message. */
+	len = sizeof(buffer);
+	zassert_ok(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg), reference_len,
+					    buffer, &len));
+	zassert_equal(len, 0);
+
+	len = sizeof(buffer);
+	zassert_ok(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg),
+					    reference_len + 1, buffer, &len));
+	zassert_equal(len, 0);
+}
+
+ZTEST(nfc_ndef_encode_part, test_record_all_chunk_sizes)
+{
+	record_encode_in_chunks(&NFC_NDEF_RECORD_BIN_DATA(bin_rec));
+	record_encode_in_chunks(&NFC_NDEF_TEXT_RECORD_DESC(text_rec));
+	record_encode_in_chunks(&NFC_NDEF_NESTED_NDEF_MSG_RECORD(nested_rec));
+	record_encode_in_chunks(&NFC_NDEF_GENERIC_RECORD_DESC(counted_rec));
+}
+
+ZTEST(nfc_ndef_encode_part, test_invalid_args)
+{
+	uint32_t len = sizeof(buffer);
+
+	zassert_equal(nfc_ndef_msg_encode_part(NULL, 0, buffer, &len), -EINVAL);
+	zassert_equal(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg), 0, NULL, &len),
+		      -EINVAL);
+	zassert_equal(nfc_ndef_msg_encode_part(&NFC_NDEF_MSG(msg), 0, buffer, NULL),
+		      -EINVAL);
+	zassert_equal(nfc_ndef_record_encode_part(&NFC_NDEF_RECORD_BIN_DATA(bin_rec),
+						  NDEF_RECORD_LOCATION_MASK + 1,
+						  0, buffer, &len),
+		      -EINVAL);
+}
+
+ZTEST_SUITE(nfc_ndef_encode_part, NULL, ndef_setup, NULL, NULL, NULL);